@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+/* Resident mode (LLK_RESIDENT): the TRISCs stay booted in a dispatch loop instead of running a
+ * single kernel and parking. The host posts a command into an L1 mailbox shared by all TRISCs,
+ * every TRISC runs the selected kernel once and reports completion through its usual mailbox.
+ * The host only reloads the ELFs when the build changes. Globals are reinitialised before every
+ * command, but the shared Tensix state (dest section, semaphores) must be left clean by each kernel.
+ */
+namespace llk_dispatch
+{
+
+constexpr std::uint32_t COMMAND_ADDRESS = 0x19F80; // just below the TRISC mailboxes
+constexpr std::uint32_t MAX_ARGS        = 14;
+constexpr std::uint32_t KERNEL_EXIT     = 0xFFFFFFFF;
+constexpr std::uint32_t KERNEL_UNKNOWN  = 0xBAD; // mailbox value for a kernel id the image does not link
+
+struct command_t
+{
+    std::uint32_t sequence;  // bumped by the host for every command, written last; 0 after boot
+    std::uint32_t kernel_id; // index into kernel_table, KERNEL_EXIT leaves the dispatch loop
+    std::uint32_t args[MAX_ARGS];
+};
+
+static_assert(sizeof(command_t) == 64, "Host side (helpers/device.py) assumes a 16 word command");
+
+inline volatile command_t* command()
+{
+    return reinterpret_cast<volatile command_t*>(COMMAND_ADDRESS);
+}
+
+// Runtime argument of the command being executed, lets one image serve many cases
+inline std::uint32_t runtime_arg(std::uint32_t index)
+{
+    return command()->args[index];
+}
+
+using kernel_entry_t = void (*)();
+
+// Images linking several kernels define the table with LLK_KERNEL_TABLE, otherwise run_kernel is the only
+// kernel, with id 0. Any other id is answered with KERNEL_UNKNOWN and the loop waits for the next command.
+extern const kernel_entry_t kernel_table[] __attribute__((weak));
+extern const std::uint32_t kernel_table_size __attribute__((weak));
+
+} // namespace llk_dispatch
+
+// clang-format off
+#define LLK_KERNEL_TABLE(...)                                                                 \
+    extern const llk_dispatch::kernel_entry_t llk_dispatch::kernel_table[] = {__VA_ARGS__};  \
+    extern const std::uint32_t llk_dispatch::kernel_table_size =                              \
+        sizeof(llk_dispatch::kernel_table) / sizeof(llk_dispatch::kernel_table[0]);
+// clang-format on
@@ -103,4 +103,18 @@ enum class SfpuType
     asinh,
     acosh,
     reduce,
+    typecast,
+    rope,
+    piecewise,
+    gather_rows,
+    gather_columns,
+    scatter_rows,
+    scatter_add_rows,
+    linear_scan,
+    div_int32,
+    argmax,
+    argmin,
+    hardswish,
+    softsign,
+    tanhshrink,
 };
@@ -8,16 +8,19 @@
 
 #include "ckernel.h"
 
-// FIXME: this shouldn't be statically allocated
-constexpr uint32_t PERF_INPUT_A = 0x1A000;
-constexpr uint32_t PERF_INPUT_B = PERF_INPUT_A + 16 * 4096;
-constexpr uint32_t PERF_INPUT_C = PERF_INPUT_B + 16 * 4096;
-constexpr uint32_t PERF_OUTPUT  = PERF_INPUT_C + 16 * 4096;
+// Perf buffer placed by the host L1 arena (helpers/l1_layout.py), build.h declares
+// PERF_INPUT_A, PERF_INPUT_B, PERF_INPUT_C and PERF_OUTPUT for perf runs
+struct PerfBuffer
+{
+    uint32_t base;
+    uint32_t tile_size;
+    uint32_t tile_count;
+};
 
-constexpr uint32_t PERF_ADDRESS(uint32_t buffer, uint32_t tile)
+constexpr uint32_t PERF_ADDRESS(const PerfBuffer& buffer, uint32_t tile)
 {
-    uint32_t address = buffer + (tile % 16) * 4096; // Loop every 16 tiles, to prevent escaping memory
-    return address / 16 - 1;                        // Correct the L1 Address for Tensix
+    uint32_t address = buffer.base + (tile % buffer.tile_count) * buffer.tile_size; // tiles past the buffer reuse it from the start
+    return address / 16 - 1;                                                         // Correct the L1 Address for Tensix
 }
 
 enum class PerfRunType
@@ -10,6 +10,7 @@
 #include <cstring>
 
 #include "ckernel.h"
+#include "profiler_layout.h"
 
 // Logic to convert zone name -> 16bit numeric id
 #define Stringize(L)       #L
@@ -47,11 +48,18 @@ constexpr std::uint16_t hashString16(const char (&s)[N])
 namespace llk_profiler
 {
 
-constexpr uint32_t ENTRY_TYPE_SHAMT = 28;
-constexpr uint32_t ENTRY_ID_SHAMT   = ENTRY_TYPE_SHAMT - 16;
-constexpr uint32_t ENTRY_META_SHAMT = ENTRY_ID_SHAMT;
-
-constexpr uint32_t ENTRY_META_MASK = ~((1 << ENTRY_META_SHAMT) - 1);
+/* Entries are 32-bit words: [31:28] type, [27:12] marker id, [11:0] cycles since the previous entry.
+ * When the delta does not fit, a SYNC entry carrying the full timestamp is written first and the entry
+ * itself gets delta 0. SYNC takes two words: [31:28] type, [27] bit 31 of the low timestamp word,
+ * [26:0] high timestamp word, followed by the low timestamp word with bit 31 cleared. A cleared bit 31
+ * marks the end of the buffer, which is why it is moved into the first word.
+ */
+constexpr uint32_t ENTRY_TYPE_SHAMT   = 28;
+constexpr uint32_t ENTRY_ID_SHAMT     = ENTRY_TYPE_SHAMT - 16;
+constexpr uint32_t ENTRY_DELTA_BITS   = ENTRY_ID_SHAMT;
+constexpr uint32_t SYNC_LOW_MSB_BIT   = 1 << (ENTRY_TYPE_SHAMT - 1);
+constexpr uint32_t SYNC_HIGH_MASK     = SYNC_LOW_MSB_BIT - 1;
+constexpr uint32_t SYNC_LOW_MSB_SHAMT = 31 - (ENTRY_TYPE_SHAMT - 1);
 
 constexpr uint32_t ENTRY_EXISTS_BIT = 0b1000 << ENTRY_TYPE_SHAMT;
 
@@ -60,23 +68,15 @@ enum class EntryType : uint32_t
     TIMESTAMP      = 0b1000,
     TIMESTAMP_DATA = 0b1001,
     ZONE_START     = 0b1010,
-    ZONE_END       = 0b1011
+    ZONE_END       = 0b1011,
+    SYNC           = 0b1100
 };
 
-// Initialize id of the core executing the kernel
-#if defined(LLK_TRISC_UNPACK)
-constexpr uint32_t TRISC_ID = 0;
-#elif defined(LLK_TRISC_MATH)
-constexpr uint32_t TRISC_ID = 1;
-#elif defined(LLK_TRISC_PACK)
-constexpr uint32_t TRISC_ID = 2;
-#else
-#error "Profiler can only be used on TRISC cores"
-#endif
+// Worst case words taken by one entry: SYNC + entry
+constexpr uint32_t ENTRY_MAX_WORDS = 3;
 
-constexpr uint32_t BUFFER_LENGTH = 0x400; // 1024 entries per core
-constexpr uint32_t NUM_CORES     = 3;     // TRISC cores: unpack, math, pack
-constexpr uint32_t BUFFERS_END   = 0x16E000;
+// NUM_CORES, BUFFER_LENGTH, BUFFERS_END, SYNC_CORE_MASK and CORE_ID of the core being compiled
+// come from profiler_layout.h, generated per arch by the test infra (ProfilerLayout)
 constexpr uint32_t BUFFERS_START = BUFFERS_END - (NUM_CORES * BUFFER_LENGTH * sizeof(uint32_t));
 
 constexpr uint32_t BARRIER_END   = BUFFERS_START;
@@ -87,19 +87,23 @@ using buffer_ptr_t  = uint32_t (*)[BUFFER_LENGTH];
 
 extern barrier_ptr_t barrier_ptr;
 extern buffer_ptr_t buffer;
-extern uint32_t write_idx;
 extern uint32_t open_zone_cnt;
+extern uint32_t last_timestamp;
+
+// The write cursor lives in tp for the whole kernel: the bare-metal ABI never allocates it, so entries are
+// appended without loading and storing a buffer index around each one of them
+register uint32_t* write_ptr asm("tp");
 
 __attribute__((always_inline)) inline void sync_threads()
 {
     auto& barrier = *barrier_ptr;
 
-    // wait for all the threads to set the barrier
-    barrier[TRISC_ID] = 1;
+    // wait for all the synced threads to set the barrier
+    barrier[CORE_ID] = 1;
     asm volatile("fence" ::: "memory");
     for (uint32_t i = 0; i < NUM_CORES; ++i)
     {
-        if (i == TRISC_ID)
+        if (i == CORE_ID || !((SYNC_CORE_MASK >> i) & 1))
         {
             continue;
         }
@@ -112,39 +116,65 @@ __attribute__((always_inline)) inline void sync_threads()
 
 __attribute__((always_inline)) inline void reset()
 {
-    barrier_ptr   = reinterpret_cast<barrier_ptr_t>(BARRIER_START);
-    buffer        = reinterpret_cast<buffer_ptr_t>(BUFFERS_START);
-    write_idx     = 0;
-    open_zone_cnt = 0;
-
-    memset(buffer[TRISC_ID], 0, BUFFER_LENGTH * sizeof(buffer[TRISC_ID][0]));
+    barrier_ptr    = reinterpret_cast<barrier_ptr_t>(BARRIER_START);
+    buffer         = reinterpret_cast<buffer_ptr_t>(BUFFERS_START);
+    write_ptr      = buffer[CORE_ID];
+    open_zone_cnt  = 0;
+    // half the clock period away, so the first entry always starts with a SYNC
+    last_timestamp = static_cast<uint32_t>(ckernel::read_wall_clock()) + (1u << 31);
+
+    memset(buffer[CORE_ID], 0, BUFFER_LENGTH * sizeof(buffer[CORE_ID][0]));
 }
 
 __attribute__((always_inline)) inline bool is_buffer_full()
 {
     // the buffer is considered full when there is not enough space to store:
-    // - timestamp with data (TIMESTAMP_DATA_ENTRY) (size = 16B)
-    // - new zone (ZONE_START_ENTRY + ZONE_END_ENTRY) (size = 16B)
+    // - timestamp with data (SYNC + TIMESTAMP_DATA + data) (size = 5 words)
+    // - new zone (ZONE_START + ZONE_END, each possibly with a SYNC) (size = 6 words)
     // after closing all of the currently open zones
-    return (BUFFER_LENGTH - (write_idx + open_zone_cnt)) < 4;
+    uint32_t write_idx = write_ptr - buffer[CORE_ID];
+    return (BUFFER_LENGTH - (write_idx + ENTRY_MAX_WORDS * open_zone_cnt)) < 2 * ENTRY_MAX_WORDS;
+}
+
+// The low wall clock word alone dates an entry, the high word is only read for a SYNC
+__attribute__((always_inline)) inline uint32_t read_timestamp()
+{
+    return ckernel::reg_read(RISCV_DEBUG_REG_WALL_CLOCK_L);
 }
 
-__attribute__((always_inline)) inline void write_entry(EntryType type, uint16_t id16)
+__attribute__((always_inline)) inline void write_sync(uint32_t timestamp_low)
 {
-    uint64_t timestamp      = ckernel::read_wall_clock();
-    uint32_t timestamp_high = static_cast<uint32_t>(timestamp >> 32);
+    // High word of timestamp_low, one less when the low word has wrapped since it was read
+    uint64_t now            = ckernel::read_wall_clock();
+    uint32_t timestamp_high = static_cast<uint32_t>(now >> 32) - (static_cast<uint32_t>(now) < timestamp_low);
+
+    uint32_t sync_meta = (static_cast<uint32_t>(EntryType::SYNC) << ENTRY_TYPE_SHAMT) | ((timestamp_low >> SYNC_LOW_MSB_SHAMT) & SYNC_LOW_MSB_BIT);
+    write_ptr[0]       = sync_meta | (timestamp_high & SYNC_HIGH_MASK);
+    write_ptr[1]       = timestamp_low & ~ENTRY_EXISTS_BIT;
+    write_ptr += 2;
+}
 
-    uint32_t type_numeric = static_cast<uint32_t>(type);
-    uint32_t meta         = (type_numeric << ENTRY_TYPE_SHAMT) | ((uint32_t)id16 << ENTRY_ID_SHAMT);
+// Only the delta, its range check and the store follow the timestamp read; the SYNC is off the common path
+__attribute__((always_inline)) inline void write_entry(EntryType type, uint16_t id16, uint32_t timestamp_low)
+{
+    uint32_t meta  = (static_cast<uint32_t>(type) << ENTRY_TYPE_SHAMT) | (static_cast<uint32_t>(id16) << ENTRY_ID_SHAMT);
+    uint32_t delta = timestamp_low - last_timestamp;
+    last_timestamp = timestamp_low;
+
+    if (__builtin_expect((delta >> ENTRY_DELTA_BITS) != 0, 0))
+    {
+        write_sync(timestamp_low);
+        delta = 0; // delta is 0 right after a SYNC
+    }
 
-    buffer[TRISC_ID][write_idx++] = meta | (timestamp_high & ~ENTRY_META_MASK);
-    buffer[TRISC_ID][write_idx++] = static_cast<uint32_t>(timestamp);
+    *write_ptr++ = meta | delta;
 }
 
 __attribute__((always_inline)) inline void write_data(uint64_t data)
 {
-    buffer[TRISC_ID][write_idx++] = static_cast<uint32_t>(data >> 32);
-    buffer[TRISC_ID][write_idx++] = static_cast<uint32_t>(data);
+    write_ptr[0] = static_cast<uint32_t>(data >> 32);
+    write_ptr[1] = static_cast<uint32_t>(data);
+    write_ptr += 2;
 }
 
 template <uint16_t id16>
@@ -159,21 +189,23 @@ public:
     zone_scoped& operator=(const zone_scoped&) = delete;
     zone_scoped& operator=(zone_scoped&&)      = delete;
 
+    // The zone's bookkeeping is kept out of it: done before the start is read and after the end is read
     inline __attribute__((always_inline)) zone_scoped()
     {
         if (!is_buffer_full())
         {
             is_opened = true;
-            write_entry(EntryType::ZONE_START, id16);
             ++open_zone_cnt;
+            write_entry(EntryType::ZONE_START, id16, read_timestamp());
         }
     }
 
-    ~zone_scoped()
+    inline __attribute__((always_inline)) ~zone_scoped()
     {
+        uint32_t timestamp_low = read_timestamp();
         if (is_opened)
         {
-            write_entry(EntryType::ZONE_END, id16);
+            write_entry(EntryType::ZONE_END, id16, timestamp_low);
             --open_zone_cnt;
         }
     }
@@ -183,7 +215,7 @@ __attribute__((always_inline)) inline void write_timestamp(uint16_t id16)
 {
     if (!is_buffer_full())
     {
-        write_entry(EntryType::TIMESTAMP, id16);
+        write_entry(EntryType::TIMESTAMP, id16, read_timestamp());
     }
 }
 
@@ -191,7 +223,7 @@ __attribute__((always_inline)) inline void write_timestamp(uint16_t id16, uint64
 {
     if (!is_buffer_full())
     {
-        write_entry(EntryType::TIMESTAMP_DATA, id16);
+        write_entry(EntryType::TIMESTAMP_DATA, id16, read_timestamp());
         write_data(data);
     }
 }
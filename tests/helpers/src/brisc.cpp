@@ -6,14 +6,37 @@
 
 #ifdef LLK_BOOT_MODE_BRISC
 #include "boot.h"
+#endif
+#include "profiler.h"
+
+#ifdef LLK_PROFILER
+
+namespace llk_profiler
+{
+barrier_ptr_t barrier_ptr = reinterpret_cast<barrier_ptr_t>(BARRIER_START);
+buffer_ptr_t buffer       = reinterpret_cast<buffer_ptr_t>(BUFFERS_START);
+uint32_t open_zone_cnt    = 0;
+uint32_t last_timestamp   = 0;
+
+} // namespace llk_profiler
+
 #endif
 
 int main()
 {
+#if defined(LLK_PROFILER)
+    // BRISC is not part of the TRISC barrier, it has finished by the time the kernels start
+    llk_profiler::reset();
+#endif
+
 #ifdef LLK_BOOT_MODE_BRISC
-    device_setup();
+    {
+        ZONE_SCOPED("DEVICE_SETUP")
+        device_setup();
+    }
 
     // Release reset of triscs here in order to achieve brisc <-> trisc synchronization
+    TIMESTAMP("TRISC_RELEASE")
     clear_trisc_soft_reset();
 #endif
 }
@@ -13,6 +13,10 @@
 #endif
 #include "profiler.h"
 
+#ifdef LLK_RESIDENT
+#include "dispatch.h"
+#endif
+
 #if defined(LLK_TRISC_UNPACK) && defined(LLK_BOOT_MODE_TRISC)
 #include "boot.h"
 #endif
@@ -23,8 +27,8 @@ namespace llk_profiler
 {
 barrier_ptr_t barrier_ptr = reinterpret_cast<barrier_ptr_t>(BARRIER_START);
 buffer_ptr_t buffer       = reinterpret_cast<buffer_ptr_t>(BUFFERS_START);
-uint32_t write_idx        = 0;
 uint32_t open_zone_cnt    = 0;
+uint32_t last_timestamp   = 0;
 
 } // namespace llk_profiler
 
@@ -32,23 +36,51 @@ uint32_t open_zone_cnt    = 0;
 
 void run_kernel();
 
-int main()
+#ifdef LLK_RESIDENT
+
+// Linker symbols of the local data the CRT initialises before main
+extern std::uint32_t __ldm_bss_start[];
+extern std::uint32_t __ldm_bss_end[];
+extern std::uint32_t __ldm_data_start[];
+extern std::uint32_t __ldm_data_end[];
+extern std::uint32_t __loader_init_start[];
+extern std::uint32_t __loader_init_end[];
+extern void (*__init_array_start[])();
+extern void (*__init_array_end[])();
+
+// Kernels expect the globals as the loader left them, redo the CRT initialisation before every command.
+// Only the core local state is restored here, together with the regfile/cfg state/dest offset reset in
+// execute(). Tensix state shared by the TRISCs (dest section, semaphores, dvalids) is not reset: one TRISC
+// cannot reinitialise it without racing the other two, so every kernel must leave it as it found it,
+// i.e. balance each math dest_section_done with a pack dest_section_done and release what it waits on.
+__attribute__((noinline)) static void restore_globals()
 {
-#if defined(LLK_TRISC_UNPACK) && defined(LLK_BOOT_MODE_TRISC)
-    device_setup();
+    std::fill(__ldm_bss_start, __ldm_bss_end, 0);
+    if (__loader_init_start != __loader_init_end)
+    {
+        std::copy(__loader_init_start, __loader_init_start + (__ldm_data_end - __ldm_data_start), __ldm_data_start);
+    }
+    for (auto init = __init_array_start; init != __init_array_end; ++init)
+    {
+        (*init)();
+    }
+    asm volatile("" ::: "memory");
+}
 
-    // Release the rest of the triscs
-    clear_trisc_soft_reset();
-#endif
+// nullptr for an id the image does not link
+static llk_dispatch::kernel_entry_t kernel_entry(std::uint32_t kernel_id)
+{
+    if (&llk_dispatch::kernel_table_size != nullptr)
+    {
+        return kernel_id < llk_dispatch::kernel_table_size ? llk_dispatch::kernel_table[kernel_id] : nullptr;
+    }
+    return kernel_id == 0 ? run_kernel : nullptr;
+}
 
-#if defined(LLK_TRISC_UNPACK)
-    volatile std::uint32_t* const mailbox = reinterpret_cast<volatile std::uint32_t*>(0x19FFC);
-#elif defined(LLK_TRISC_MATH)
-    volatile std::uint32_t* const mailbox = reinterpret_cast<volatile std::uint32_t*>(0x19FF8);
-#elif defined(LLK_TRISC_PACK)
-    volatile std::uint32_t* const mailbox = reinterpret_cast<volatile std::uint32_t*>(0x19FF4);
 #endif
 
+static void execute(void (*kernel)(), volatile std::uint32_t* mailbox)
+{
     std::fill(ckernel::regfile, ckernel::regfile + 64, 0);
 #ifndef ARCH_QUASAR
     ckernel::reset_cfg_state_id();
@@ -62,9 +94,58 @@ int main()
 
     {
         ZONE_SCOPED("KERNEL")
-        run_kernel();
+        kernel();
         ckernel::tensix_sync();
     }
 
     *mailbox = ckernel::KERNEL_COMPLETE; // 0x1
 }
+
+int main()
+{
+#if defined(LLK_TRISC_UNPACK) && defined(LLK_BOOT_MODE_TRISC)
+    device_setup();
+
+    // Release the rest of the triscs
+    clear_trisc_soft_reset();
+#endif
+
+#if defined(LLK_TRISC_UNPACK)
+    volatile std::uint32_t* const mailbox = reinterpret_cast<volatile std::uint32_t*>(0x19FFC);
+#elif defined(LLK_TRISC_MATH)
+    volatile std::uint32_t* const mailbox = reinterpret_cast<volatile std::uint32_t*>(0x19FF8);
+#elif defined(LLK_TRISC_PACK)
+    volatile std::uint32_t* const mailbox = reinterpret_cast<volatile std::uint32_t*>(0x19FF4);
+#endif
+
+#ifdef LLK_RESIDENT
+    volatile llk_dispatch::command_t* const command = llk_dispatch::command();
+    std::uint32_t sequence                          = 0;
+
+    while (true)
+    {
+        while (command->sequence == sequence)
+        {
+            asm volatile("fence" ::: "memory");
+        }
+        sequence = command->sequence;
+
+        if (command->kernel_id == llk_dispatch::KERNEL_EXIT)
+        {
+            break;
+        }
+
+        const llk_dispatch::kernel_entry_t kernel = kernel_entry(command->kernel_id);
+        if (kernel == nullptr)
+        {
+            *mailbox = llk_dispatch::KERNEL_UNKNOWN;
+            continue;
+        }
+
+        restore_globals();
+        execute(kernel, mailbox);
+    }
+#else
+    execute(run_kernel, mailbox);
+#endif
+}
@@ -214,6 +214,11 @@ def pytest_addoption(parser):
         default=5555,
         help="Integer number of the server port.",
     )
+    parser.addoption(
+        "--resident",
+        action="store_true",
+        help="Keep the TRISCs booted between tests, ELFs are only reloaded when the build changes.",
+    )
 
 
 # Skip decorators for specific architectures
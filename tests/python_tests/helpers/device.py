@@ -20,6 +20,7 @@ from ttexalens.tt_exalens_lib import (
 )
 
 from .format_config import DataFormat, FormatConfig
+from .l1_layout import L1Arena
 from .llk_params import DestAccumulation, Mailbox
 from .pack import (
     pack_bfp8_b,
@@ -32,6 +33,7 @@ from .pack import (
     pack_uint16,
     pack_uint32,
 )
+from .profiler import get_profiler_layout
 from .target_config import TestTargetConfig
 from .unpack import (
     unpack_bfp8_b,
@@ -136,7 +138,7 @@ def set_tensix_soft_reset(
 def collect_results(
     formats: FormatConfig,
     tile_count: int,
-    address: int = 0x1C000,
+    address: int,
     location: str = "0,0",
     sfpu: bool = False,
     tile_dimensions=[32, 32],
@@ -187,7 +189,94 @@ def exalens_device_setup(chip_arch, device_id=0, location="0,0"):
     debug_tensix.inject_instruction(ops.TT_OP_SEMINIT(1, 0, 4), 0)
 
 
-def run_elf_files(testname, boot_mode, device_id=0, location="0,0"):
+# Resident mode command block, see helpers/include/dispatch.h
+DISPATCH_COMMAND_ADDRESS = 0x19F80
+DISPATCH_MAX_ARGS = 14
+DISPATCH_KERNEL_EXIT = 0xFFFFFFFF
+DISPATCH_KERNEL_UNKNOWN = 0xBAD  # mailbox value for a kernel id the image does not link
+
+
+class ResidentDispatcher:
+    """
+    Host side of the TRISC dispatch loop (LLK_RESIDENT builds).
+
+    Remembers which build is booted, so a test with an identical build only has to
+    post a command instead of soft resetting the core and loading the ELFs again.
+    """
+
+    _image = None
+    _sequence = 0
+
+    @classmethod
+    def is_booted(cls, image) -> bool:
+        return cls._image is not None and cls._image == image
+
+    @classmethod
+    def booted(cls, image) -> None:
+        cls._image = image
+        cls._sequence = 0
+
+    @classmethod
+    def invalidate(cls) -> None:
+        cls._image = None
+
+    @classmethod
+    def dispatch(
+        cls, kernel_id: int = 0, args: list[int] | None = None, location="0,0"
+    ) -> None:
+        args = list(args or [])
+        if len(args) > DISPATCH_MAX_ARGS:
+            raise ValueError(
+                f"At most {DISPATCH_MAX_ARGS} runtime args are supported, got {len(args)}"
+            )
+
+        reset_mailboxes()
+        _reset_profiler(location)
+
+        # kernel id and args first, the dispatch loop wakes up on the sequence word
+        cls._sequence = (cls._sequence + 1) & 0xFFFFFFFF or 1
+        padding = [0] * (DISPATCH_MAX_ARGS - len(args))
+        write_words_to_device(
+            location, DISPATCH_COMMAND_ADDRESS + 4, [kernel_id, *args, *padding]
+        )
+        write_words_to_device(location, DISPATCH_COMMAND_ADDRESS, [cls._sequence])
+
+    @classmethod
+    def exit(cls, location="0,0") -> None:
+        """Leave the dispatch loop, the TRISCs park like after a regular run"""
+        if cls._image is None:
+            return
+        cls.dispatch(DISPATCH_KERNEL_EXIT, location=location)
+        cls.invalidate()
+
+
+def _reset_profiler(location="0,0", resident=False):
+    # Reset the profiler barrier and terminate every buffer, cores that do not run
+    # in this boot mode (e.g. BRISC) would otherwise leave a stale buffer behind
+    profiler_layout = get_profiler_layout()
+    write_words_to_device(
+        location, profiler_layout.barrier_start, [0] * len(profiler_layout.cores)
+    )
+    for buffer_address in profiler_layout.thread_buffers:
+        write_words_to_device(location, buffer_address, [0])
+
+    # The dispatch loop waits for a sequence number different from the one it boots with
+    if resident:
+        write_words_to_device(location, DISPATCH_COMMAND_ADDRESS, [0])
+
+
+def run_resident(testname, image, boot_mode, device_id=0, location="0,0"):
+    """Run a test on the resident TRISCs, booting its ELFs only when image differs from the booted one"""
+    if not ResidentDispatcher.is_booted(image):
+        run_elf_files(
+            testname, boot_mode, device_id=device_id, location=location, resident=True
+        )
+        ResidentDispatcher.booted(image)
+
+    ResidentDispatcher.dispatch(location=location)
+
+
+def run_elf_files(testname, boot_mode, device_id=0, location="0,0", resident=False):
     CHIP_ARCH = get_chip_architecture()
     LLK_HOME = os.environ.get("LLK_HOME")
     BUILD_DIR = Path(LLK_HOME) / "tests" / "build" / CHIP_ARCH.value
@@ -197,8 +286,9 @@ def run_elf_files(testname, boot_mode, device_id=0, location="0,0"):
     if CHIP_ARCH == ChipArchitecture.QUASAR and boot_mode != BootMode.TRISC:
         raise ValueError("Quasar only supports TRISC boot mode")
 
-    # Perform soft reset
+    # Perform soft reset, this also ends any resident dispatch loop
     set_tensix_soft_reset(1, location=location, device_id=device_id)
+    ResidentDispatcher.invalidate()
 
     # Load TRISC ELF files
     trisc_names = ["unpack", "math", "pack"]
@@ -216,9 +306,7 @@ def run_elf_files(testname, boot_mode, device_id=0, location="0,0"):
         if is_wormhole:
             write_words_to_device(location, trisc_start_addresses[i], [start_address])
 
-    # Reset the profiler barrier
-    TRISC_PROFILER_BARRIER_ADDRESS = 0x16AFF4
-    write_words_to_device(location, TRISC_PROFILER_BARRIER_ADDRESS, [0, 0, 0])
+    _reset_profiler(location, resident)
 
     match boot_mode:
         case BootMode.BRISC:
@@ -258,6 +346,7 @@ def write_stimuli_to_l1(
     buffer_C=None,
     stimuli_C_format: DataFormat = None,
     tile_count_C: int = None,
+    tile_count_res: int = None,
 ):
     """
     Write stimuli to L1 with support for 2 or 3 input tensors.
@@ -275,6 +364,8 @@ def write_stimuli_to_l1(
         buffer_C: Optional flattened tensor data for matrix C (for 3-input operations)
         stimuli_C_format: Optional DataFormat for matrix C
         tile_count_C: Optional number of tiles in matrix C
+        tile_count_res: Number of result tiles, defaults to test_config["tile_count_res"],
+            then to the largest input
 
     Returns:
         int: Address where result will be stored
@@ -282,12 +373,17 @@ def write_stimuli_to_l1(
 
     TILE_ELEMENTS = 1024
 
-    # Calculate L1 addresses
-    tile_size_A_bytes = stimuli_A_format.num_bytes_per_tile(TILE_ELEMENTS)
-    tile_size_B_bytes = stimuli_B_format.num_bytes_per_tile(TILE_ELEMENTS)
+    # Place the buffers in the L1 arena, the kernels get the addresses through build.h
+    tile_count_B = tile_count_A if tile_count_B is None else tile_count_B
+
+    arena = L1Arena()
+    buffer_A_l1 = arena.allocate_tiles("buffer_A", stimuli_A_format, tile_count_A)
+    buffer_B_l1 = arena.allocate_tiles("buffer_B", stimuli_B_format, tile_count_B)
 
-    buffer_A_address = 0x1A000
-    buffer_B_address = buffer_A_address + tile_size_A_bytes * tile_count_A
+    buffer_A_address = buffer_A_l1.address
+    buffer_B_address = buffer_B_l1.address
+    tile_size_A_bytes = buffer_A_l1.tile_size
+    tile_size_B_bytes = buffer_B_l1.tile_size
 
     # Handle optional third buffer
     if buffer_C is not None:
@@ -296,12 +392,25 @@ def write_stimuli_to_l1(
                 "If buffer_C is provided, stimuli_C_format and tile_count_C must also be provided"
             )
 
-        tile_size_C_bytes = stimuli_C_format.num_bytes_per_tile(TILE_ELEMENTS)
-        buffer_C_address = buffer_B_address + tile_size_B_bytes * tile_count_B
-        result_buffer_address = buffer_C_address + tile_size_C_bytes * tile_count_C
+        buffer_C_l1 = arena.allocate_tiles("buffer_C", stimuli_C_format, tile_count_C)
+        buffer_C_address = buffer_C_l1.address
+        tile_size_C_bytes = buffer_C_l1.tile_size
     else:
         buffer_C_address = None
-        result_buffer_address = buffer_B_address + tile_size_B_bytes * tile_count_B
+
+    # Kernels with more outputs than inputs (e.g. quotient and remainder) size the result explicitly
+    formats = test_config.get("formats")
+    result_format = formats.output_format if formats is not None else stimuli_A_format
+    if tile_count_res is None:
+        tile_count_res = test_config.get("tile_count_res")
+    result_tile_count = (
+        tile_count_res
+        if tile_count_res is not None
+        else max(tile_count_A, tile_count_B, tile_count_C or 0)
+    )
+    result_buffer_address = arena.allocate_tiles(
+        "buffer_Res", result_format, result_tile_count
+    ).address
 
     # Helper function to get packer
     def get_packer(data_format):
@@ -393,6 +502,7 @@ def write_stimuli_to_l1(
     if buffer_C_address is not None:
         test_config["buffer_C_address"] = buffer_C_address
     test_config["result_buffer_address"] = result_buffer_address
+    test_config["l1_arena"] = arena
 
     return result_buffer_address
 
@@ -506,8 +616,13 @@ def wait_until_tensix_complete(location, mailbox_addr, timeout=30, max_backoff=5
     backoff = 0.1  # Initial backoff time in seconds
 
     while time.time() - start_time < timeout:
-        if read_word_from_device(location, mailbox_addr.value) == KERNEL_COMPLETE:
+        status = read_word_from_device(location, mailbox_addr.value)
+        if status == KERNEL_COMPLETE:
             return
+        if status == DISPATCH_KERNEL_UNKNOWN:
+            raise RuntimeError(
+                f"{mailbox_addr.name} was dispatched a kernel id its image does not link"
+            )
 
         # Disable any waiting if running on simulator
         # this makes simulator tests run ever so slightly faster
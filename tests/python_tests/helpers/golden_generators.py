@@ -4,13 +4,18 @@ import math
 from typing import Optional
 
 import torch
+from helpers.chip_architecture import ChipArchitecture, get_chip_architecture
 from helpers.format_config import DataFormat
 from helpers.llk_params import (
     DestAccumulation,
+    GatherOperation,
+    IntDivRounding,
     MathFidelity,
     MathOperation,
     ReduceDimension,
     ReducePool,
+    RopeLayout,
+    TypecastRounding,
     format_dict,
 )
 from helpers.tilize_untilize import tilize_block, untilize
@@ -831,6 +836,12 @@ class UnarySFPUGolden:
             MathOperation.Exp: self._exp,
             MathOperation.Exp2: self._exp2,
             MathOperation.Hardsigmoid: self._hardsigmoid,
+            MathOperation.Hardswish: self._hardswish,
+            MathOperation.Hardtanh: self._hardtanh,
+            MathOperation.Sigmoid: self._sigmoid,
+            MathOperation.Sign: self._sign,
+            MathOperation.Softsign: self._softsign,
+            MathOperation.Tanhshrink: self._tanhshrink,
             MathOperation.Threshold: self._threshold,
             MathOperation.ReluMax: self._relu_max,
             MathOperation.ReluMin: self._relu_min,
@@ -1041,6 +1052,54 @@ class UnarySFPUGolden:
         )
         return torch.nn.functional.hardsigmoid(input_tensor).item()
 
+    def _hardswish(self, x):
+        input_tensor = (
+            x
+            if isinstance(x, torch.Tensor)
+            else torch.tensor(x, dtype=format_dict[self.data_format])
+        )
+        return torch.nn.functional.hardswish(input_tensor).item()
+
+    def _hardtanh(self, x, min_val=-1.0, max_val=1.0):
+        input_tensor = (
+            x
+            if isinstance(x, torch.Tensor)
+            else torch.tensor(x, dtype=format_dict[self.data_format])
+        )
+        return torch.nn.functional.hardtanh(input_tensor, min_val, max_val).item()
+
+    def _sigmoid(self, x):
+        input_tensor = (
+            x
+            if isinstance(x, torch.Tensor)
+            else torch.tensor(x, dtype=format_dict[self.data_format])
+        )
+        return torch.sigmoid(input_tensor).item()
+
+    def _sign(self, x):
+        input_tensor = (
+            x
+            if isinstance(x, torch.Tensor)
+            else torch.tensor(x, dtype=format_dict[self.data_format])
+        )
+        return torch.sign(input_tensor).item()
+
+    def _softsign(self, x):
+        input_tensor = (
+            x
+            if isinstance(x, torch.Tensor)
+            else torch.tensor(x, dtype=format_dict[self.data_format])
+        )
+        return torch.nn.functional.softsign(input_tensor).item()
+
+    def _tanhshrink(self, x):
+        input_tensor = (
+            x
+            if isinstance(x, torch.Tensor)
+            else torch.tensor(x, dtype=format_dict[self.data_format])
+        )
+        return torch.nn.functional.tanhshrink(input_tensor).item()
+
     def _threshold(self, x, t=5, v=10):
         input_tensor = (
             x
@@ -1159,6 +1218,8 @@ class BinarySFPUGolden(EltwiseBinaryGolden):
                 MathOperation.SfpuElwadd: self._add,
                 MathOperation.SfpuElwsub: self._sub,
                 MathOperation.SfpuElwmul: self._mul,
+                MathOperation.SfpuElwdiv: self._div,
+                MathOperation.SfpuElwpow: self._pow,
                 MathOperation.SfpuXlogy: self._xlogy,
                 MathOperation.SfpuElwRightShift: self._right_shift,
                 MathOperation.SfpuElwLeftShift: self._left_shift,
@@ -1179,14 +1240,20 @@ class BinarySFPUGolden(EltwiseBinaryGolden):
         return torch.tensor(result, dtype=format_dict[data_format])
 
     # Operation methods are covered by Eltwise Binary Golden
+    def _div(self, t1, t2):
+        return (t1.to(torch.float32) / t2.to(torch.float32)).item()
+
+    def _pow(self, t1, t2):
+        return torch.pow(t1.to(torch.float32), t2.to(torch.float32)).item()
+
     def _xlogy(self, x, y):
-        # Unable to model edge cases for Tensix behavior in golden.
+        # Models finite, positive y only, edge cases are not modelled for Tensix behavior in golden.
         # Tensix shows inconsistent patterns in handling non-finite results for xlogy, depending on the input,
         # data format (both input and output), and destination accumulation (dest_acc).
         # We need to work with the Tensix team to understand when and why certain results are returned,
         # what configuration dependencies exist, and how to handle them appropriately.
         # Without this understanding, discrepancies will occur between golden and Tensix results due to differing edge case handling.
-        pass
+        return (x.to(torch.float32) * torch.log(y.to(torch.float32))).item()
 
     def _right_shift(self, t1, t2):
         return torch.bitwise_right_shift(t1, t2).item()
@@ -1294,3 +1361,237 @@ class TilizeGolden:
             ]
 
         return result.flatten().to(torch_format)
+
+
+@register_golden
+class TypecastGolden:
+    """
+    Host reference for the SFPU typecast matrix. Float targets are rounded once from the exact source value,
+    integer targets are rounded to an integral value and saturated. Formats are DataFormats or TypecastFormat
+    names, so targets without a pack format (Int16) can be checked from their 32-bit Dest container.
+    Returns the (lower, upper) bounds a result may take, which only differ under stochastic rounding where the
+    result is one of the two neighbours of the exact value.
+    """
+
+    MANTISSA_BITS = {
+        "Float32": 23,
+        "Tf32": 10,
+        "Float16": 10,
+        "Float16_b": 7,
+    }
+
+    INT_RANGE = {
+        "Int32": (-(2**31), 2**31 - 1),
+        "UInt32": (0, 2**32 - 1),
+        "Int16": (-(2**15), 2**15 - 1),
+        "UInt16": (0, 2**16 - 1),
+        "Int8": (-128, 127),
+        "UInt8": (0, 255),
+    }
+
+    @classmethod
+    def int_range(cls, data_format):
+        # Wormhole keeps Int32 in sign-magnitude, which has no -2^31, so it saturates symmetrically
+        low, high = cls.INT_RANGE[str(data_format)]
+        if (
+            str(data_format) == "Int32"
+            and get_chip_architecture() == ChipArchitecture.WORMHOLE
+        ):
+            low = -high
+        return low, high
+
+    def __call__(self, operand, input_format, output_format, rounding):
+        values = torch.as_tensor(operand).to(torch.float64)
+        if rounding == TypecastRounding.Stochastic:
+            return (
+                self._convert(values, output_format, "zero"),
+                self._convert(values, output_format, "away"),
+            )
+        mode = "even" if rounding == TypecastRounding.NearestEven else "zero"
+        result = self._convert(values, output_format, mode)
+        return result, result
+
+    def _convert(self, values, output_format, mode):
+        # Integer sources up to 32 bits are exact in float64, so every target rounds once from the exact value
+        if str(output_format) in self.INT_RANGE:
+            low, high = self.int_range(output_format)
+            return torch.clamp(self._round_integral(values, mode), low, high)
+        return self._round_to_precision(
+            values, self.MANTISSA_BITS[str(output_format)], mode
+        )
+
+    @staticmethod
+    def _round_integral(values, mode):
+        if mode == "even":
+            return torch.round(values)
+        truncated = torch.trunc(values)
+        if mode == "zero":
+            return truncated
+        return truncated + torch.sign(values) * (values != truncated)
+
+    @classmethod
+    def _round_to_precision(cls, values, mantissa_bits, mode):
+        # Scale so the kept mantissa bits form the integral part, then round that
+        mantissa, exponent = torch.frexp(values)
+        scaled = torch.ldexp(mantissa, torch.tensor(mantissa_bits + 1))
+        return torch.ldexp(
+            cls._round_integral(scaled, mode), exponent - (mantissa_bits + 1)
+        )
+
+
+@register_golden
+class RopeGolden:
+    """
+    Rotary positional embedding of row-major x [rows, head_dim]. Every pair is rotated by the angle at
+    the column of its first element, as the kernel reads it. With inv_freq the angles are positions and
+    the angle is their float32 product, the product the SFPU forms before reducing it.
+    """
+
+    def __call__(self, x, angles, layout, output_format, inv_freq=None):
+        x = torch.as_tensor(x).to(torch.float64)
+        theta = torch.as_tensor(angles).to(torch.float32)
+        if inv_freq is not None:
+            theta = theta * torch.as_tensor(inv_freq).to(torch.float32)
+        theta = theta.to(torch.float64)
+
+        lo, hi = self.pairs(layout, x.shape[1])
+        sin, cos = torch.sin(theta[:, lo]), torch.cos(theta[:, lo])
+        result = x.clone()
+        result[:, lo] = x[:, lo] * cos - x[:, hi] * sin
+        result[:, hi] = x[:, lo] * sin + x[:, hi] * cos
+        return result.to(format_dict[output_format])
+
+    @staticmethod
+    def pairs(layout, head_dim):
+        """Columns of the first and second element of every pair"""
+        columns = torch.arange(head_dim)
+        if layout == RopeLayout.Interleaved:
+            return columns[0::2], columns[1::2]
+        return columns[: head_dim // 2], columns[head_dim // 2 :]
+
+
+@register_golden
+class GatherGolden:
+    """
+    Row gather and scatter of a row-major source with out-of-range indices skipped, into a zeroed output
+    of out_rows rows. Column gather works on columns and keeps the 32 rows of the source.
+    """
+
+    def __call__(self, operation, source, indices, out_rows, output_format):
+        source = torch.as_tensor(source).to(torch.float64)
+        indices = torch.as_tensor(indices).to(torch.int64)
+
+        if operation == GatherOperation.GatherColumns:
+            return self(
+                GatherOperation.GatherRows, source.T, indices, out_rows, output_format
+            ).T.contiguous()
+
+        if operation == GatherOperation.GatherRows:
+            result = torch.zeros(len(indices), source.shape[1], dtype=torch.float64)
+            valid = indices < source.shape[0]
+            result[valid] = source[indices[valid]]
+        else:
+            result = torch.zeros(out_rows, source.shape[1], dtype=torch.float64)
+            valid = indices < out_rows
+            rows, targets = source[valid], indices[valid]
+            if operation == GatherOperation.ScatterAddRows:
+                result.index_add_(0, targets, rows)
+            else:
+                # The kernel walks the rows in order, so the last row sent to an index wins
+                for row, target in zip(rows, targets.tolist()):
+                    result[target] = row
+        return result.to(format_dict[output_format])
+
+
+@register_golden
+class PoolGolden:
+    """
+    k x k pooling of x [channels, height, width] with stride, dilation and padding, one row of channels per
+    output position in row-major order. Max pooling also returns the index h * width + w of the max in each
+    channel's plane, as max_pool2d does. Average pooling divides by kernel * kernel with count_include_pad,
+    else by the number of window elements inside the input.
+    """
+
+    def __call__(
+        self,
+        pool,
+        x,
+        kernel,
+        stride,
+        dilation,
+        padding,
+        output_format,
+        count_include_pad=True,
+    ):
+        x = torch.as_tensor(x).to(torch.float64)
+        channels, height, width = x.shape
+
+        def windows(planes, pad_value):
+            """[planes, kernel * kernel, outputs]"""
+            padded = torch.nn.functional.pad(planes, (padding,) * 4, value=pad_value)
+            columns = torch.nn.functional.unfold(
+                padded.unsqueeze(0), kernel, dilation=dilation, stride=stride
+            )[0]
+            return columns.view(planes.shape[0], kernel * kernel, -1)
+
+        torch_format = format_dict[output_format]
+        if pool == ReducePool.Max:
+            values = windows(x, -math.inf)
+            positions = torch.arange(height * width, dtype=torch.float64)
+            positions = positions.view(1, height, width).expand(channels, -1, -1)
+            result, argmax = values.max(dim=1)
+            indices = windows(positions, -1.0).gather(1, argmax.unsqueeze(1))
+            return result.T.to(torch_format), indices.squeeze(1).T.to(torch.int64)
+
+        sums = windows(x, 0.0).sum(dim=1)
+        if count_include_pad:
+            divisors = torch.full_like(sums[0], kernel * kernel)
+        else:
+            divisors = windows(torch.ones(1, height, width), 0.0).sum(dim=1)[0]
+        return (sums / divisors).T.to(torch_format)
+
+
+@register_golden
+class LinearScanGolden:
+    """
+    h[t] = a[t] * h[t - 1] + b[t] along the rows of a and b [time, channels], from h[-1] = initial_state,
+    evaluated sequentially in float64. Without b, it is the running product of a scaled by the state.
+    """
+
+    def __call__(self, a, b, initial_state, output_format):
+        a = torch.as_tensor(a).to(torch.float64)
+        b = torch.zeros_like(a) if b is None else torch.as_tensor(b).to(torch.float64)
+
+        h = torch.empty_like(a)
+        state = torch.full_like(a[0], initial_state)
+        for t in range(a.shape[0]):
+            state = a[t] * state + b[t]
+            h[t] = state
+        return h.to(format_dict[output_format])
+
+
+@register_golden
+class IntDivGolden:
+    """
+    Quotient and remainder of int32/uint32 division, truncated or floored. Division by 0 follows RISC-V:
+    every bit of the quotient set and the remainder equal to the dividend. So does the overflowing
+    -2^31 / -1, whose quotient wraps to -2^31.
+    """
+
+    def __call__(self, dividend, divisor, rounding, data_format):
+        dividend = torch.as_tensor(dividend).to(torch.int64)
+        divisor = torch.as_tensor(divisor).to(torch.int64).expand_as(dividend)
+
+        by_zero = divisor == 0
+        mode = "trunc" if rounding == IntDivRounding.Trunc else "floor"
+        quotient = torch.div(
+            dividend, torch.where(by_zero, 1, divisor), rounding_mode=mode
+        )
+        remainder = dividend - quotient * divisor
+
+        all_ones = -1 if data_format == DataFormat.Int32 else 2**32 - 1
+        quotient = torch.where(by_zero, all_ones, quotient)
+        if data_format == DataFormat.Int32:
+            quotient = torch.where(quotient == 2**31, -(2**31), quotient)
+        remainder = torch.where(by_zero, dividend, remainder)
+        return quotient, remainder
@@ -0,0 +1,103 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+L1 arena shared by the host and the kernels.
+
+Stimuli, results and perf buffers are bump allocated between the reserved low
+region (kernel code, TRISC mailboxes, resident dispatch command block) and the
+profiler buffers. Every buffer is aligned to 16B, the L1 address granularity of
+the unpacker and packer, and sized for its tile format. The resulting addresses
+reach the kernels through build.h.
+"""
+
+from dataclasses import dataclass, field
+
+from .format_config import DataFormat
+from .profiler import get_profiler_layout
+
+L1_ALIGNMENT = 16
+
+# Kernel code and local data images, then the dispatch command block (0x19F80)
+# and the TRISC mailboxes (0x19FF4 - 0x1A000)
+ARENA_START = 0x1A000
+
+TILE_ELEMENTS = 1024
+
+
+def align_up(value: int, alignment: int = L1_ALIGNMENT) -> int:
+    return (value + alignment - 1) // alignment * alignment
+
+
+@dataclass(frozen=True)
+class L1Buffer:
+    name: str
+    address: int
+    size: int
+    tile_size: int = 0  # 0 for buffers that are not made of tiles
+
+    @property
+    def end(self) -> int:
+        return self.address + self.size
+
+    @property
+    def tile_count(self) -> int:
+        return self.size // self.tile_size if self.tile_size else 0
+
+    def tile_address(self, index: int) -> int:
+        return self.address + index * self.tile_size
+
+
+@dataclass
+class L1Arena:
+    start: int = ARENA_START
+    end: int | None = None  # defaults to just below the profiler barrier
+    buffers: dict[str, L1Buffer] = field(default_factory=dict)
+
+    def __post_init__(self):
+        if self.end is None:
+            self.end = (
+                get_profiler_layout().barrier_start // L1_ALIGNMENT * L1_ALIGNMENT
+            )
+        self.top = align_up(self.start)
+
+    @property
+    def free(self) -> int:
+        return self.end - self.top
+
+    def allocate(
+        self, name: str, size: int, tile_size: int = 0, alignment: int = L1_ALIGNMENT
+    ) -> L1Buffer:
+        if name in self.buffers:
+            raise ValueError(f"L1 buffer {name} is already allocated")
+        if alignment % L1_ALIGNMENT:
+            raise ValueError(f"Alignment must be a multiple of {L1_ALIGNMENT}B")
+
+        address = align_up(self.top, alignment)
+        if address + size > self.end:
+            raise MemoryError(
+                f"L1 buffer {name} ({size}B) does not fit, "
+                f"{self.end - address}B left below {hex(self.end)}"
+            )
+
+        buffer = L1Buffer(name, address, size, tile_size)
+        self.buffers[name] = buffer
+        self.top = address + size
+        return buffer
+
+    def allocate_tiles(
+        self,
+        name: str,
+        data_format: DataFormat,
+        tile_count: int,
+        tile_elements: int = TILE_ELEMENTS,
+    ) -> L1Buffer:
+        # keep every tile 16B aligned, Bfp8_b exponents make the size format dependent
+        tile_size = align_up(data_format.num_bytes_per_tile(tile_elements))
+        return self.allocate(name, tile_size * max(tile_count, 1), tile_size)
+
+    def __getitem__(self, name: str) -> L1Buffer:
+        return self.buffers[name]
+
+    def __contains__(self, name: str) -> bool:
+        return name in self.buffers
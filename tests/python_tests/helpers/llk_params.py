@@ -70,14 +70,20 @@ class MathOperation(Enum):
     Fill = OpSpec("fill", MathOpType.SFPU_UNARY)
     Gelu = OpSpec("gelu", MathOpType.SFPU_UNARY)
     Hardsigmoid = OpSpec("hardsigmoid", MathOpType.SFPU_UNARY)
+    Hardswish = OpSpec("hardswish", MathOpType.SFPU_UNARY)
+    Hardtanh = OpSpec("hardtanh", MathOpType.SFPU_UNARY)
     Log = OpSpec("log", MathOpType.SFPU_UNARY)
     Neg = OpSpec("neg", MathOpType.SFPU_UNARY)
     Reciprocal = OpSpec("reciprocal", MathOpType.SFPU_UNARY)
     Rsqrt = OpSpec("rsqrt", MathOpType.SFPU_UNARY)
+    Sigmoid = OpSpec("sigmoid", MathOpType.SFPU_UNARY)
+    Sign = OpSpec("sign", MathOpType.SFPU_UNARY)
     Sin = OpSpec("sine", MathOpType.SFPU_UNARY)
     Silu = OpSpec("silu", MathOpType.SFPU_UNARY)
+    Softsign = OpSpec("softsign", MathOpType.SFPU_UNARY)
     Sqrt = OpSpec("sqrt", MathOpType.SFPU_UNARY)
     Square = OpSpec("square", MathOpType.SFPU_UNARY)
+    Tanhshrink = OpSpec("tanhshrink", MathOpType.SFPU_UNARY)
     Threshold = OpSpec("threshold", MathOpType.SFPU_UNARY)
     ReluMax = OpSpec(
         "relu_max", MathOpType.SFPU_UNARY
@@ -87,9 +93,11 @@ class MathOperation(Enum):
     # SFPU BINARY OPERATIONS
     # =============================================================================
     SfpuElwadd = OpSpec("ADD", MathOpType.SFPU_BINARY)
+    SfpuElwdiv = OpSpec("DIV", MathOpType.SFPU_BINARY)
     SfpuElwLeftShift = OpSpec("LSHFT", MathOpType.SFPU_BINARY)
     SfpuElwLogicalRightShift = OpSpec("LOGICAL_RSHFT", MathOpType.SFPU_BINARY)
     SfpuElwmul = OpSpec("MUL", MathOpType.SFPU_BINARY)
+    SfpuElwpow = OpSpec("POW", MathOpType.SFPU_BINARY)
     SfpuElwRightShift = OpSpec("RSHFT", MathOpType.SFPU_BINARY)
     SfpuElwsub = OpSpec("SUB", MathOpType.SFPU_BINARY)
     SfpuXlogy = OpSpec("XLOGY", MathOpType.SFPU_BINARY)
@@ -165,6 +173,32 @@ class ReducePool(Enum):
     Average = "AVG"
 
 
+class ReduceSummation(Enum):
+    Naive = "ReduceSummation::Naive"
+    Pairwise = "ReduceSummation::Pairwise"
+    Kahan = "ReduceSummation::Kahan"
+
+
+class BinaryBroadcast(Enum):
+    Scalar = "BinaryBroadcast::Scalar"
+    Row = "BinaryBroadcast::Row"
+    Column = "BinaryBroadcast::Column"
+
+
+class BinaryBcastSfpuType(Enum):
+    """Broadcast comparisons and bitwise ops, which are picked by their SfpuType rather than a BinaryOp"""
+
+    Equal = "unary_eq"
+    NotEqual = "unary_ne"
+    Greater = "unary_gt"
+    Less = "unary_lt"
+    GreaterEqual = "unary_ge"
+    LessEqual = "unary_le"
+    BitwiseAnd = "bitwise_and"
+    BitwiseOr = "bitwise_or"
+    BitwiseXor = "bitwise_xor"
+
+
 class DestAccumulation(Enum):
     Yes = "true"
     No = "false"
@@ -177,6 +211,54 @@ class StochasticRounding(Enum):
     All = "StochRndType::All"
 
 
+class TypecastRounding(Enum):
+    NearestEven = "TypecastRounding::NearestEven"
+    Stochastic = "TypecastRounding::Stochastic"
+    Truncate = "TypecastRounding::Truncate"
+
+
+class IntDivRounding(Enum):
+    Trunc = "IntDivRounding::Trunc"
+    Floor = "IntDivRounding::Floor"
+
+
+class RopeLayout(Enum):
+    Interleaved = "RopeLayout::INTERLEAVED"
+    HalfSplit = "RopeLayout::HALF_SPLIT"
+
+
+class RopeAngles(Enum):
+    Precomputed = "RopeAngles::PRECOMPUTED"
+    FromPositions = "RopeAngles::FROM_POSITIONS"
+
+
+class GatherOperation(Enum):
+    GatherRows = "gather_rows"
+    GatherColumns = "gather_columns"
+    ScatterRows = "scatter_rows"
+    ScatterAddRows = "scatter_add_rows"
+
+
+class TriscLayoutOperation(Enum):
+    Tilize = "tilize"
+    Untilize = "untilize"
+    TransposeFaces = "transpose_faces"
+    Gather = "gather"
+    Scatter = "scatter"
+    Fill = "fill"
+    Convert = "convert"
+
+
+class ArgReduceOperation(Enum):
+    ArgMax = "argmax"
+    ArgMin = "argmin"
+
+
+class ArgTieBreak(Enum):
+    First = "ArgTieBreak::First"
+    Last = "ArgTieBreak::Last"
+
+
 class Haloize(Enum):
     Yes = "true"
     No = "false"
@@ -0,0 +1,573 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Minimax polynomial fitter for the SFPU PolynomialEvaluator.
+
+For a function, an interval, a target format and an error budget this finds the
+lowest degree polynomial whose coefficients, once rounded to the coefficient
+format, still meet the budget, and emits it as a constexpr coefficient table.
+
+The fit is a Remez exchange in double precision over the monomial basis the
+SFPU evaluates, weighted for absolute or relative error. Coefficients are then
+rounded one at a time from the highest power down, the remaining ones are
+refitted against the residual after each rounding so the lower powers absorb
+the rounding error of the higher ones.
+
+Candidates are judged by the host SFPU reference: Horner's method in float32
+with one rounding per SFPMAD, as PolynomialEvaluator<N, sfpi::vFloat, float>
+compiles, followed by rounding the result to the target format. The error
+report is exhaustive over every bf16 value in the interval for a bf16 target
+and over every 2^k-th float32 value (k chosen to keep the sweep near 2^20
+inputs) for a float32 target. Errors are in ulp of the target format at the
+exact result.
+
+Odd and even functions are fitted in x^2, the table is then evaluated as
+x * P(x * x) or P(x * x) which halves the SFPMADs per degree.
+
+Usage (from tests/python_tests):
+    python -m helpers.minimax exp --interval 0 0.6931472 --format bf16 --max-ulp 1
+    python -m helpers.minimax sin --interval -1.5707964 1.5707964 --symmetry odd \\
+        --error relative --name SIN --output ckernel_sfpu_sin_coeffs.h
+"""
+
+import argparse
+import math
+import struct
+import sys
+from dataclasses import dataclass, field
+from enum import Enum
+from pathlib import Path
+from typing import Callable
+
+# ---------------------------------------------------------------------------
+# Formats
+# ---------------------------------------------------------------------------
+
+
+class Format(Enum):
+    FLOAT32 = "fp32"
+    BFLOAT16 = "bf16"
+
+    @property
+    def mantissa_bits(self) -> int:
+        return 23 if self is Format.FLOAT32 else 7
+
+
+def fp32_bits(x: float) -> int:
+    return struct.unpack("<I", struct.pack("<f", x))[0]
+
+
+def from_fp32_bits(bits: int) -> float:
+    return struct.unpack("<f", struct.pack("<I", bits & 0xFFFFFFFF))[0]
+
+
+def round_fp32(x: float) -> float:
+    """Round to nearest even float32, out of range values become infinities"""
+    try:
+        return struct.unpack("<f", struct.pack("<f", x))[0]
+    except OverflowError:
+        return math.copysign(math.inf, x)
+
+
+def round_bf16(x: float) -> float:
+    """Round to nearest even bfloat16 via float32, as the packer does"""
+    bits = fp32_bits(round_fp32(x))
+    if (bits & 0x7F800000) == 0x7F800000:
+        return from_fp32_bits(bits & 0xFFFF0000 | (0x400000 if bits & 0x7FFFFF else 0))
+    bits += 0x7FFF + ((bits >> 16) & 1)
+    return from_fp32_bits(bits & 0xFFFF0000)
+
+
+def round_to(x: float, fmt: Format) -> float:
+    return round_fp32(x) if fmt is Format.FLOAT32 else round_bf16(x)
+
+
+def ulp(y: float, fmt: Format) -> float:
+    """Spacing of fmt at |y|, subnormals are flushed so the smallest normal spacing is used"""
+    exponent = max(math.frexp(abs(y))[1] - 1, -126) if y else -126
+    return math.ldexp(1.0, exponent - fmt.mantissa_bits)
+
+
+def format_inputs(fmt: Format, lo: float, hi: float, target: int = 1 << 20):
+    """Every value of fmt in [lo, hi], float32 is thinned to every 2^k-th value"""
+    step = 1 << 16
+    if fmt is Format.FLOAT32:
+        count = _fp32_count(lo, hi)
+        step = 1 << max(0, math.ceil(math.log2(max(count, 1) / target)))
+    inputs = []
+    for sign in (0, 0x80000000):
+        for bits in range(0, 0x7F800000, step):
+            x = from_fp32_bits(sign | bits)
+            if lo <= x <= hi and not (sign and x == 0):
+                inputs.append(x)
+    inputs.sort()
+    return inputs, step
+
+
+def _fp32_count(lo: float, hi: float) -> int:
+    def ordinal(x: float) -> int:
+        bits = fp32_bits(round_fp32(x))
+        return -(bits & 0x7FFFFFFF) if bits >> 31 else bits
+
+    return ordinal(hi) - ordinal(lo) + 1
+
+
+# ---------------------------------------------------------------------------
+# Functions
+# ---------------------------------------------------------------------------
+
+
+class Symmetry(Enum):
+    NONE = "none"
+    ODD = "odd"
+    EVEN = "even"
+
+
+FUNCTIONS: dict[str, Callable[[float], float]] = {
+    "exp": math.exp,
+    "exp2": lambda x: 2.0**x,
+    "expm1": math.expm1,
+    "log": math.log,
+    "log1p": math.log1p,
+    "log2": math.log2,
+    "reciprocal": lambda x: 1.0 / x,
+    "sqrt": math.sqrt,
+    "rsqrt": lambda x: 1.0 / math.sqrt(x),
+    "sigmoid": lambda x: 0.5 * (1.0 + math.tanh(0.5 * x)),
+    "tanh": math.tanh,
+    "erf": math.erf,
+    "gelu": lambda x: 0.5 * x * (1.0 + math.erf(x / math.sqrt(2.0))),
+    "silu": lambda x: x * 0.5 * (1.0 + math.tanh(0.5 * x)),
+    "sin": math.sin,
+    "cos": math.cos,
+    "tan": math.tan,
+    "atan": math.atan,
+    "asin": math.asin,
+    "acos": math.acos,
+}
+
+
+# ---------------------------------------------------------------------------
+# Remez exchange
+# ---------------------------------------------------------------------------
+
+
+def _solve(matrix: list[list[float]], rhs: list[float]) -> list[float]:
+    """Gaussian elimination with partial pivoting"""
+    n = len(rhs)
+    a = [row[:] + [b] for row, b in zip(matrix, rhs)]
+    for col in range(n):
+        pivot = max(range(col, n), key=lambda r: abs(a[r][col]))
+        if a[pivot][col] == 0.0:
+            raise ZeroDivisionError("singular Remez system")
+        a[col], a[pivot] = a[pivot], a[col]
+        for r in range(col + 1, n):
+            factor = a[r][col] / a[col][col]
+            if factor:
+                for c in range(col, n + 1):
+                    a[r][c] -= factor * a[col][c]
+    x = [0.0] * n
+    for r in reversed(range(n)):
+        x[r] = (a[r][n] - sum(a[r][c] * x[c] for c in range(r + 1, n))) / a[r][r]
+    return x
+
+
+def _chebyshev(lo: float, hi: float, count: int) -> list[float]:
+    """Chebyshev extrema, including both ends"""
+    if count == 1:
+        return [0.5 * (lo + hi)]
+    return [
+        0.5 * (lo + hi) - 0.5 * (hi - lo) * math.cos(math.pi * i / (count - 1))
+        for i in range(count)
+    ]
+
+
+def remez(
+    target: Callable[[float], float],
+    weight: Callable[[float], float],
+    lo: float,
+    hi: float,
+    powers: list[int],
+    grid_size: int = 2048,
+    iterations: int = 40,
+) -> tuple[list[float], float]:
+    """
+    Minimises max |weight(t) * (target(t) - sum(c_i * t^powers[i]))| over [lo, hi].
+    Returns the coefficients of powers and the weighted error on the grid.
+    """
+    n = len(powers)
+    grid = sorted(set(_chebyshev(lo, hi, grid_size) + _chebyshev(lo, hi, 257)))
+    grid = [t for t in grid if math.isfinite(weight(t))]
+    values = [target(t) for t in grid]
+    weights = [weight(t) for t in grid]
+
+    reference = _chebyshev(grid[0], grid[-1], n + 1)
+    coeffs, best_coeffs, best_error = [0.0] * n, None, math.inf
+    for _ in range(iterations):
+        matrix = [
+            [t**p for p in powers] + [(-1) ** i / weight(t)]
+            for i, t in enumerate(reference)
+        ]
+        try:
+            *coeffs, level = _solve(matrix, [target(t) for t in reference])
+        except ZeroDivisionError:
+            break
+
+        errors = [
+            w * (v - sum(c * t**p for c, p in zip(coeffs, powers)))
+            for t, v, w in zip(grid, values, weights)
+        ]
+        max_error = max(abs(e) for e in errors)
+        if max_error < best_error:
+            best_coeffs, best_error = coeffs, max_error
+        if max_error - abs(level) <= 1e-6 * max_error:
+            break
+
+        # Largest |error| of each run of equal sign, these alternate by construction
+        extrema = []
+        for i, e in enumerate(errors):
+            if extrema and (e >= 0) == (errors[extrema[-1]] >= 0):
+                if abs(e) > abs(errors[extrema[-1]]):
+                    extrema[-1] = i
+            else:
+                extrema.append(i)
+        if len(extrema) < n + 1:
+            break
+        while len(extrema) > n + 1:
+            if abs(errors[extrema[0]]) < abs(errors[extrema[-1]]):
+                extrema.pop(0)
+            else:
+                extrema.pop()
+        reference = [grid[i] for i in extrema]
+
+    return best_coeffs or coeffs, best_error
+
+
+# ---------------------------------------------------------------------------
+# Host SFPU reference
+# ---------------------------------------------------------------------------
+
+
+def sfpu_horner(coeffs: list[float], t: float) -> float:
+    """PolynomialEvaluator in float32, a float32 product is exact in double so each step rounds once"""
+    result = coeffs[-1]
+    for c in reversed(coeffs[:-1]):
+        result = round_fp32(result * t + c)
+    return result
+
+
+def sfpu_eval(coeffs: list[float], x: float, symmetry: Symmetry) -> float:
+    x = round_fp32(x)
+    if symmetry is Symmetry.NONE:
+        return sfpu_horner(coeffs, x)
+    x2 = round_fp32(x * x)
+    if symmetry is Symmetry.EVEN:
+        return sfpu_horner(coeffs, x2)
+    return round_fp32(x * sfpu_horner(coeffs, x2))
+
+
+@dataclass
+class ErrorReport:
+    inputs: int
+    input_step: int
+    max_ulp: float = 0.0
+    worst_input: float = 0.0
+    mean_ulp: float = 0.0
+    max_abs: float = 0.0
+    max_rel: float = 0.0
+    correctly_rounded: int = 0
+    histogram: dict[str, int] = field(default_factory=dict)
+
+    def lines(self, fmt: Format) -> list[str]:
+        thinning = (
+            f", every {self.input_step}th fp32 value" if fmt is Format.FLOAT32 else ""
+        )
+        return [
+            f"inputs: {self.inputs} {fmt.value} values{thinning}",
+            f"max error: {self.max_ulp:.3f} ulp at x = {self.worst_input!r}",
+            f"mean error: {self.mean_ulp:.4f} ulp",
+            f"max abs error: {self.max_abs:.3e}, max rel error: {self.max_rel:.3e}",
+            f"correctly rounded: {100 * self.correctly_rounded / max(self.inputs, 1):.2f}%",
+            "ulp histogram: "
+            + ", ".join(f"{k}: {v}" for k, v in self.histogram.items() if v),
+        ]
+
+
+ULP_BUCKETS = (0.5, 1.0, 2.0, 4.0, math.inf)
+
+
+def error_report(
+    function: Callable[[float], float],
+    coeffs: list[float],
+    symmetry: Symmetry,
+    fmt: Format,
+    lo: float,
+    hi: float,
+) -> ErrorReport:
+    inputs, step = format_inputs(fmt, lo, hi)
+    report = ErrorReport(len(inputs), step)
+    report.histogram = {f"<={b:g}": 0 for b in ULP_BUCKETS}
+    total = 0.0
+    for x in inputs:
+        try:
+            exact = function(x)
+        except (ValueError, ZeroDivisionError):
+            continue
+        got = round_to(sfpu_eval(coeffs, x, symmetry), fmt)
+        diff = abs(got - exact)
+        ulps = diff / ulp(exact, fmt)
+        total += ulps
+        if ulps > report.max_ulp:
+            report.max_ulp, report.worst_input = ulps, x
+        report.max_abs = max(report.max_abs, diff)
+        if exact:
+            report.max_rel = max(report.max_rel, diff / abs(exact))
+        report.correctly_rounded += got == round_to(exact, fmt)
+        bucket = next(b for b in ULP_BUCKETS if ulps <= b)
+        report.histogram[f"<={bucket:g}"] += 1
+    report.mean_ulp = total / max(len(inputs), 1)
+    return report
+
+
+# ---------------------------------------------------------------------------
+# Fitting
+# ---------------------------------------------------------------------------
+
+
+@dataclass
+class Fit:
+    degree: int
+    coeffs: list[float]  # ascending, in x or in x^2 for odd and even functions
+    symmetry: Symmetry
+    report: ErrorReport
+
+    @property
+    def x_degree(self) -> int:
+        """Degree of the polynomial in x"""
+        if self.symmetry is Symmetry.NONE:
+            return self.degree
+        return 2 * self.degree + (self.symmetry is Symmetry.ODD)
+
+
+def _reduced_problem(function, symmetry: Symmetry, relative: bool):
+    """Target and weight in t, where t = x for NONE and t = x^2 otherwise"""
+    if symmetry is Symmetry.NONE:
+        target = function
+        weight = (lambda t: 1.0 / abs(function(t))) if relative else (lambda t: 1.0)
+    elif symmetry is Symmetry.EVEN:
+        target = lambda t: function(math.sqrt(t))
+        weight = (lambda t: 1.0 / abs(target(t))) if relative else (lambda t: 1.0)
+    else:
+        # f(x) = x * P(x^2): fit P(t) = f(sqrt(t)) / sqrt(t) with the error scaled back by sqrt(t)
+        def target(t):
+            s = math.sqrt(t)
+            return function(s) / s if s else _derivative_at_zero(function)
+
+        if relative:
+            weight = lambda t: 1.0 / abs(target(t))
+        else:
+            weight = lambda t: math.sqrt(t) or 1e-300
+
+    def safe(w):
+        def wrapped(t):
+            try:
+                return w(t)
+            except (ValueError, ZeroDivisionError):
+                return math.inf
+
+        return wrapped
+
+    return target, safe(weight)
+
+
+def _derivative_at_zero(function) -> float:
+    h = 2.0**-20
+    return (function(h) - function(-h)) / (2 * h)
+
+
+def fit(
+    function: Callable[[float], float],
+    lo: float,
+    hi: float,
+    degree: int,
+    symmetry: Symmetry = Symmetry.NONE,
+    relative: bool = False,
+    coeff_format: Format = Format.FLOAT32,
+) -> list[float]:
+    """Minimax coefficients of the given degree in t, rounded to coeff_format highest power first"""
+    if symmetry is Symmetry.NONE:
+        t_lo, t_hi = lo, hi
+    else:
+        t_lo = 0.0 if lo <= 0.0 <= hi else min(lo * lo, hi * hi)
+        t_hi = max(lo * lo, hi * hi)
+    target, weight = _reduced_problem(function, symmetry, relative)
+
+    free = list(range(degree + 1))
+    fixed: dict[int, float] = {}
+    while free:
+        residual = lambda t: target(t) - sum(c * t**p for p, c in fixed.items())
+        coeffs, _ = remez(residual, weight, t_lo, t_hi, free)
+        fixed[free[-1]] = round_to(coeffs[-1], coeff_format)
+        free.pop()
+    return [fixed[p] for p in range(degree + 1)]
+
+
+def lowest_degree(
+    function: Callable[[float], float],
+    lo: float,
+    hi: float,
+    fmt: Format,
+    max_ulp: float,
+    symmetry: Symmetry = Symmetry.NONE,
+    relative: bool = False,
+    coeff_format: Format = Format.FLOAT32,
+    max_degree: int = 12,
+    verbose: bool = False,
+) -> Fit | None:
+    """First degree whose rounded coefficients meet max_ulp on the host SFPU reference"""
+    best = None
+    for degree in range(max_degree + 1):
+        coeffs = fit(function, lo, hi, degree, symmetry, relative, coeff_format)
+        report = error_report(function, coeffs, symmetry, fmt, lo, hi)
+        candidate = Fit(degree, coeffs, symmetry, report)
+        if verbose:
+            print(
+                f"degree {candidate.x_degree}: {report.max_ulp:.3f} ulp",
+                file=sys.stderr,
+            )
+        if best is None or report.max_ulp < best.report.max_ulp:
+            best = candidate
+        if report.max_ulp <= max_ulp:
+            return candidate
+    return None if best is None or best.report.max_ulp > max_ulp else best
+
+
+# ---------------------------------------------------------------------------
+# Emission
+# ---------------------------------------------------------------------------
+
+
+def _literal(c: float) -> str:
+    text = repr(round_fp32(c))
+    if "e" not in text and "." not in text and "inf" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def emit_header(
+    name: str,
+    function: str,
+    lo: float,
+    hi: float,
+    fmt: Format,
+    coeff_format: Format,
+    relative: bool,
+    result: Fit,
+) -> str:
+    evaluation = {
+        Symmetry.NONE: "PolynomialEvaluator<{n}, sfpi::vFloat, float>::eval({name}_COEFFS, x)",
+        Symmetry.EVEN: "PolynomialEvaluator<{n}, sfpi::vFloat, float>::eval({name}_COEFFS, x * x)",
+        Symmetry.ODD: "x * PolynomialEvaluator<{n}, sfpi::vFloat, float>::eval({name}_COEFFS, x * x)",
+    }[result.symmetry].format(n=len(result.coeffs), name=name)
+
+    lines = [
+        "// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC",
+        "//",
+        "// SPDX-License-Identifier: Apache-2.0",
+        "",
+        "// Generated by tests/python_tests/helpers/minimax.py, do not edit",
+        f"// {function}(x) on [{lo!r}, {hi!r}], degree {result.x_degree} minimax "
+        f"for {'relative' if relative else 'absolute'} error, "
+        f"{coeff_format.value} coefficients",
+        f"// {evaluation}",
+        "//",
+        f"// Host SFPU reference, {fmt.value} result:",
+        *(f"//   {line}" for line in result.report.lines(fmt)),
+        "",
+        "#pragma once",
+        "",
+        "namespace ckernel::sfpu",
+        "{",
+        "",
+        f"constexpr float {name}_COEFFS[{len(result.coeffs)}] = {{"
+        + ", ".join(_literal(c) for c in result.coeffs)
+        + "};",
+        "",
+        "} // namespace ckernel::sfpu",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("function", choices=sorted(FUNCTIONS))
+    parser.add_argument(
+        "--interval", type=float, nargs=2, required=True, metavar=("LO", "HI")
+    )
+    parser.add_argument(
+        "--format",
+        choices=[f.value for f in Format],
+        default="bf16",
+        help="result format",
+    )
+    parser.add_argument(
+        "--coeff-format",
+        choices=[f.value for f in Format],
+        default="fp32",
+        help="format the coefficients are loaded in",
+    )
+    parser.add_argument("--max-ulp", type=float, default=1.0, help="error budget")
+    parser.add_argument("--error", choices=["absolute", "relative"], default="relative")
+    parser.add_argument(
+        "--symmetry", choices=[s.value for s in Symmetry], default="none"
+    )
+    parser.add_argument("--max-degree", type=int, default=12)
+    parser.add_argument("--name", default=None, help="table name, default FUNCTION")
+    parser.add_argument(
+        "--output", type=Path, default=None, help="header, default stdout"
+    )
+    args = parser.parse_args(argv)
+
+    lo, hi = args.interval
+    fmt, coeff_format = Format(args.format), Format(args.coeff_format)
+    relative = args.error == "relative"
+    result = lowest_degree(
+        FUNCTIONS[args.function],
+        lo,
+        hi,
+        fmt,
+        args.max_ulp,
+        Symmetry(args.symmetry),
+        relative,
+        coeff_format,
+        args.max_degree,
+        verbose=True,
+    )
+    if result is None:
+        print(
+            f"no polynomial up to degree {args.max_degree} meets {args.max_ulp} ulp",
+            file=sys.stderr,
+        )
+        return 1
+
+    header = emit_header(
+        args.name or args.function.upper(),
+        args.function,
+        lo,
+        hi,
+        fmt,
+        coeff_format,
+        relative,
+        result,
+    )
+    if args.output:
+        args.output.write_text(header)
+    else:
+        sys.stdout.write(header)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,6 +1,7 @@
 # SPDX-License-Identifier: Apache-2.0
 # SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
 
+import json
 import os
 import shutil
 from dataclasses import fields, is_dataclass
@@ -11,14 +12,19 @@ from typing import Any
 import pandas as pd
 import plotly.graph_objects as go
 import pytest
+from helpers.chip_architecture import get_chip_architecture
 from helpers.device import (
     BootMode,
     reset_mailboxes,
     run_elf_files,
+    run_resident,
     wait_for_tensix_operations_finished,
 )
+from helpers.perf_db import MIN_SAMPLES, PerfDatabase, current_git_hash
 from helpers.profiler import Profiler, ProfilerData
-from helpers.test_config import ProfilerBuild, build_test
+from helpers.roofline import ROOFLINE_COLUMNS, KernelWork, roofline
+from helpers.target_config import TestTargetConfig
+from helpers.test_config import ProfilerBuild, build_test, resident_image
 
 
 class PerfRunType(Enum):
@@ -45,8 +51,8 @@ def _stats_timings(perf_data: pd.DataFrame) -> pd.DataFrame:
     return result
 
 
-def _stats_l1_to_l1(data: ProfilerData) -> pd.Series:
-    groups = data.zones().raw().groupby(["marker"])
+def _timings_l1_to_l1(data: ProfilerData) -> pd.DataFrame:
+    groups = data.triscs().zones().raw().groupby(["marker"])
 
     timings = []
     for (marker,), group in groups:
@@ -79,10 +85,10 @@ def _stats_l1_to_l1(data: ProfilerData) -> pd.Series:
         )
         timings.append(marker_timings)
 
-    return _stats_timings(pd.concat(timings, ignore_index=True))
+    return pd.concat(timings, ignore_index=True)
 
 
-def _stats_thread(stat: str, raw_thread: pd.DataFrame) -> pd.DataFrame:
+def _timings_thread(stat: str, raw_thread: pd.DataFrame) -> pd.DataFrame:
     start_entries = raw_thread[(raw_thread["type"] == "ZONE_START")].reset_index(
         drop=True
     )
@@ -101,70 +107,93 @@ def _stats_thread(stat: str, raw_thread: pd.DataFrame) -> pd.DataFrame:
         }
     )
 
-    return _stats_timings(timings)
+    return timings
 
 
-def _stats_unpack_isolate(data: ProfilerData) -> pd.DataFrame:
-    return _stats_thread(PerfRunType.UNPACK_ISOLATE.name, data.unpack().raw())
+def _timings_unpack_isolate(data: ProfilerData) -> pd.DataFrame:
+    return _timings_thread(PerfRunType.UNPACK_ISOLATE.name, data.unpack().raw())
 
 
-def _stats_math_isolate(data: ProfilerData) -> pd.DataFrame:
-    return _stats_thread(PerfRunType.MATH_ISOLATE.name, data.math().raw())
+def _timings_math_isolate(data: ProfilerData) -> pd.DataFrame:
+    return _timings_thread(PerfRunType.MATH_ISOLATE.name, data.math().raw())
 
 
-def _stats_pack_isolate(data: ProfilerData) -> pd.DataFrame:
-    return _stats_thread(PerfRunType.PACK_ISOLATE.name, data.pack().raw())
+def _timings_pack_isolate(data: ProfilerData) -> pd.DataFrame:
+    return _timings_thread(PerfRunType.PACK_ISOLATE.name, data.pack().raw())
 
 
-def _stats_l1_congestion(data: ProfilerData) -> pd.DataFrame:
-    stats = [
-        _stats_thread(f"{PerfRunType.L1_CONGESTION.name}[UNPACK]", data.unpack().raw()),
-        _stats_thread(f"{PerfRunType.L1_CONGESTION.name}[PACK]", data.pack().raw()),
+def _timings_l1_congestion(data: ProfilerData) -> pd.DataFrame:
+    timings = [
+        _timings_thread(
+            f"{PerfRunType.L1_CONGESTION.name}[UNPACK]", data.unpack().raw()
+        ),
+        _timings_thread(f"{PerfRunType.L1_CONGESTION.name}[PACK]", data.pack().raw()),
     ]
 
-    return pd.concat(stats, ignore_index=True)
+    return pd.concat(timings, ignore_index=True)
+
+
+def _timings_samples(timings: pd.DataFrame) -> pd.DataFrame:
+    """Long format of raw timings (marker, run_type, value) for the perf history"""
+    samples = timings.melt(id_vars="marker", var_name="run_type", value_name="value")
+    return samples.dropna(subset=["value"])
 
 
 def perf_benchmark(
-    test_config, run_types: list[PerfRunType], run_count=2, boot_mode=BootMode.DEFAULT
+    test_config,
+    run_types: list[PerfRunType],
+    run_count=MIN_SAMPLES,  # enough samples per revision for perf_db to bootstrap
+    boot_mode=BootMode.DEFAULT,
 ):  # global override boot mode for perf tests here
 
-    STATS_FUNCTION = {
-        PerfRunType.L1_TO_L1: _stats_l1_to_l1,
-        PerfRunType.UNPACK_ISOLATE: _stats_unpack_isolate,
-        PerfRunType.MATH_ISOLATE: _stats_math_isolate,
-        PerfRunType.PACK_ISOLATE: _stats_pack_isolate,
-        PerfRunType.L1_CONGESTION: _stats_l1_congestion,
+    TIMINGS_FUNCTION = {
+        PerfRunType.L1_TO_L1: _timings_l1_to_l1,
+        PerfRunType.UNPACK_ISOLATE: _timings_unpack_isolate,
+        PerfRunType.MATH_ISOLATE: _timings_math_isolate,
+        PerfRunType.PACK_ISOLATE: _timings_pack_isolate,
+        PerfRunType.L1_CONGESTION: _timings_l1_congestion,
     }
-    SUPPORTED_RUNS = STATS_FUNCTION.keys()
+    SUPPORTED_RUNS = TIMINGS_FUNCTION.keys()
 
     results = []
+    samples = []
 
     for run_type in run_types:
         assert run_type in SUPPORTED_RUNS, f"ERROR: run_type={run_type} not implemented"
 
-        get_stats = STATS_FUNCTION[run_type]
+        get_timings = TIMINGS_FUNCTION[run_type]
 
         test_config["perf_run_type"] = run_type
         build_test(test_config, boot_mode, ProfilerBuild.Yes)
 
+        resident = TestTargetConfig().resident
+        image = resident_image(test_config, boot_mode, ProfilerBuild.Yes)
+
         runs = []
         for _ in range(run_count):
             reset_mailboxes()
-            run_elf_files(test_config["testname"], boot_mode)
+            if resident:
+                run_resident(test_config["testname"], image, boot_mode)
+            else:
+                run_elf_files(test_config["testname"], boot_mode)
             wait_for_tensix_operations_finished()
 
             profiler_data = Profiler.get_data(test_config["testname"])
 
             runs.append(profiler_data)
 
-        results.append(get_stats(ProfilerData.concat(runs)))
+        timings = get_timings(ProfilerData.concat(runs))
+        results.append(_stats_timings(timings))
+        samples.append(_timings_samples(timings))
 
     results = pd.concat(results, ignore_index=True)
 
     # combine all run types into a single row in the dataframe
     report = results.groupby("marker").first().reset_index()
 
+    # raw timings ride along so update_report can keep them for the perf history
+    report.attrs["samples"] = pd.concat(samples, ignore_index=True)
+
     return report
 
 
@@ -180,14 +209,26 @@ class PerfReport:
         self,
         frames: list[pd.DataFrame] | None = None,
         masks: list[pd.Series] | None = None,
+        samples: list[pd.DataFrame] | None = None,
     ):
         self._frames = frames or [pd.DataFrame()]
         self._masks = masks or [pd.Series()]
+        self._samples = samples if samples is not None else []
 
     def append(self, frame: pd.DataFrame) -> None:
         self._frames.append(frame)
         self._masks.append(pd.Series(True, index=frame.index))
 
+    def append_samples(self, samples: pd.DataFrame) -> None:
+        self._samples.append(samples)
+
+    def samples(self) -> pd.DataFrame:
+        """Raw timings of every sweep point: params, marker, run_type, value"""
+        if not self._samples:
+            return pd.DataFrame(columns=["params", "marker", "run_type", "value"])
+
+        return pd.concat(self._samples, ignore_index=True)
+
     def frame(self) -> pd.DataFrame:
         # merge
         frame = pd.concat(self._frames, ignore_index=True)
@@ -208,7 +249,7 @@ class PerfReport:
             mask & (frame[column] == value)
             for frame, mask in zip(self._frames, self._masks)
         ]
-        return PerfReport(frames=self._frames, masks=mask_chain)
+        return PerfReport(frames=self._frames, masks=mask_chain, samples=self._samples)
 
     def marker(self, marker: str) -> "PerfReport":
         """Filter: Marker"""
@@ -228,6 +269,9 @@ def perf_report(request):
         print("Perf: Unexpected error, Saving report anyway", e)
 
     dump_report(test_module, report)
+    # the history is stored first, a failing plot must not lose the run
+    store_report(test_module, report)
+    dump_scatter(test_module, report)
 
 
 def _dataclass_names(parent, obj):
@@ -259,6 +303,16 @@ def _get_sweep_values(params):
     ]
 
 
+def _get_sweep_key(params):
+    """Sweep point as a canonical JSON string, identifies it in the perf history"""
+    names = _get_sweep_names(params)
+    values = _get_sweep_values(params)
+
+    return json.dumps(
+        {name: str(value) for name, value in zip(names, values)}, sort_keys=True
+    )
+
+
 def _get_sweep(params):
     """Returns a DataFrame containing the sweep values for the given parameters"""
 
@@ -268,7 +322,13 @@ def _get_sweep(params):
     return pd.DataFrame([values], columns=names)
 
 
-def update_report(report: PerfReport, test_config, results):
+def update_report(
+    report: PerfReport, test_config, results, work: KernelWork | None = None
+):
+    """
+    Appends the results of one sweep point, with the roofline of its TILE_LOOP zone
+    when the test declares the work done in it (see helpers/roofline.py)
+    """
     # TODO: make this more robust, handle nested dataclasses, etc.
 
     exclude = {
@@ -282,10 +342,17 @@ def update_report(report: PerfReport, test_config, results):
 
     sweep = _get_sweep(params)
 
+    samples = results.attrs.get("samples")
+    if work is not None:
+        results = roofline(results, work)
+
     combined = sweep.merge(results, how="cross")
 
     report.append(combined)
 
+    if samples is not None:
+        report.append_samples(samples.assign(params=_get_sweep_key(params)))
+
 
 def delete_benchmark_dir(testname: str):
     root = os.environ.get("LLK_HOME")
@@ -320,54 +387,87 @@ def dump_report(testname: str, report: PerfReport):
     report.frame().to_csv(output_path, index=False)
 
 
+def store_report(testname: str, report: PerfReport):
+    """Append the raw timings of this run to the persistent perf history"""
+    samples = report.samples()
+    if samples.empty:
+        return
+
+    database = PerfDatabase()
+    try:
+        database.store(
+            testname, str(get_chip_architecture()), current_git_hash(), samples
+        )
+    finally:
+        database.close()
+
+
 def dump_scatter(testname: str, report: PerfReport):
-    # generate a scatter plot using plotly.graph_objects (no pandas required)
+    """Cycles of every sweep point, and the percentage of the roofline peak when declared"""
+    frame = report.frame()
+    mean_columns = [c for c in frame.columns if c.startswith("mean(")]
+    peak_columns = [c for c in frame.columns if c.startswith("peak%(")]
 
-    if not report.sweep_names or not report.stat_names:
+    if frame.empty or not mean_columns:
         # This is possible on CI when the whole split of the test is skipped
         return
 
     dir = create_benchmark_dir(testname)
     output_path = dir / f"{testname}.html"
 
-    # x-axis: sweep values (left to right, zipped for each sweep)
-    # y-axis: stat values (for each run type, for each stat)
-    # stat_names: e.g. mean(L1_TO_L1), mean(UNPACK_ISOLATE), ...
-    # sweep_names: e.g. tile_cnt, param2, ...
-
-    fig = go.Figure()
-
-    mean_columns = [
-        (name, i) for i, name in enumerate(report.stat_names) if name.startswith("mean")
-    ]
+    # x-axis: row index of the report, one row per sweep point and marker
+    # y-axis: mean cycles per run type, peak% per run type on the right axis
+    stat_columns = {
+        "marker",
+        *ROOFLINE_COLUMNS,
+        *(c for c in frame.columns if "(" in c),
+    }
+    sweep_columns = [c for c in frame.columns if c not in stat_columns]
 
     hover = [
-        ", ".join(f"{name}={val}" for name, val in zip(report.sweep_names, sweep))
-        for sweep in report.sweep_values
+        ", ".join(
+            f"{name}={row[name]}"
+            for name in [*sweep_columns, "marker", "bound"]
+            if name in row and pd.notna(row[name])
+        )
+        for _, row in frame.iterrows()
     ]
+    x_vals = list(range(len(frame)))
 
-    # For each stat column (run type), plot all points
-    for stat_name, stat_idx in mean_columns:
-        y_vals = [stat[stat_idx] for stat in report.stat_values]
+    fig = go.Figure()
 
+    for column in mean_columns:
         fig.add_trace(
             go.Scatter(
-                x=list(range(len(report.sweep_values))),
-                y=y_vals,
+                x=x_vals,
+                y=frame[column],
                 mode="markers+lines",
-                name=stat_name,
+                name=column,
                 text=hover,
                 hoverinfo="text+y",
             )
         )
 
-    # X-axis label
-    xaxis_title = "Sweep index (see hover for values)"
+    for column in peak_columns:
+        fig.add_trace(
+            go.Scatter(
+                x=x_vals,
+                y=frame[column],
+                mode="markers",
+                name=column,
+                text=hover,
+                hoverinfo="text+y",
+                yaxis="y2",
+            )
+        )
 
     fig.update_layout(
         title=f"Performance Scatter Plot: {testname}",
-        xaxis_title=xaxis_title,
-        yaxis_title="Cycles / Tile",
+        xaxis_title="Sweep index (see hover for values)",
+        yaxis_title="Cycles",
+        yaxis2=dict(
+            title="Percent of peak", overlaying="y", side="right", range=[0, 100]
+        ),
         legend_title="Run Type / Stat",
     )
 
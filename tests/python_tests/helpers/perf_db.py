@@ -0,0 +1,341 @@
+# SPDX-License-Identifier: Apache-2.0
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+
+"""
+Persistent history of perf benchmark samples.
+
+Every perf module run appends its raw per-zone timings to an SQLite file under
+$LLK_HOME/perf_data, keyed by test, sweep parameters, arch and git hash. Unlike the
+per-run CSVs this file survives delete_benchmark_dir, so any two revisions can be
+compared later. Comparison bootstraps a confidence interval for the relative change
+of the mean and only flags changes whose whole interval is past the threshold.
+
+Samples of every run of a revision are pooled, so repeating a perf module on the
+same checkout narrows its interval without lengthening each run. A checkout with
+local changes is keyed by its diff as well, so different uncommitted edits are
+never pooled. Quantities with fewer than MIN_SAMPLES samples on either side are
+reported but never flagged, their bootstrap interval is not meaningful.
+
+Usage (from tests/python_tests):
+    python -m helpers.perf_db revisions
+    python -m helpers.perf_db compare --baseline <commit-ish> [--candidate <commit-ish>]
+"""
+
+import argparse
+import hashlib
+import os
+import sqlite3
+import subprocess
+import sys
+from datetime import datetime, timezone
+from pathlib import Path
+
+import numpy as np
+import pandas as pd
+
+DATABASE_NAME = "perf_history.sqlite"
+
+SCHEMA = """
+CREATE TABLE IF NOT EXISTS runs (
+    id INTEGER PRIMARY KEY AUTOINCREMENT,
+    test TEXT NOT NULL,
+    arch TEXT NOT NULL,
+    git_hash TEXT NOT NULL,
+    timestamp TEXT NOT NULL
+);
+CREATE TABLE IF NOT EXISTS samples (
+    run_id INTEGER NOT NULL REFERENCES runs(id),
+    params TEXT NOT NULL,
+    marker TEXT NOT NULL,
+    run_type TEXT NOT NULL,
+    value REAL NOT NULL
+);
+CREATE INDEX IF NOT EXISTS samples_run ON samples(run_id);
+"""
+
+# Columns identifying one benchmarked quantity across revisions
+KEY = ["test", "arch", "params", "marker", "run_type"]
+
+# Fewest samples per revision a bootstrap interval is computed from, 2 samples only
+# give 3 distinct resampled means
+MIN_SAMPLES = 5
+
+
+def default_database_path() -> Path:
+    root = os.environ.get("LLK_HOME")
+    if not root:
+        raise AssertionError("Environment variable LLK_HOME is not set")
+
+    return Path(root) / "perf_data" / DATABASE_NAME
+
+
+def _git(*args: str) -> str | None:
+    root = os.environ.get("LLK_HOME", ".")
+    try:
+        return subprocess.check_output(
+            ["git", *args],
+            cwd=root,
+            text=True,
+            stderr=subprocess.DEVNULL,
+        ).strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def _git_describe(*args: str) -> str | None:
+    return _git("describe", "--always", "--abbrev=12", *args)
+
+
+def current_git_hash() -> str:
+    """
+    Revision of the LLK tree being benchmarked. With local changes it is marked dirty
+    and followed by a hash of the diff against HEAD, one key per uncommitted state.
+    """
+    revision = _git_describe("--dirty")
+    if revision is None:
+        return "unknown"
+
+    if revision.endswith("-dirty"):
+        diff = _git("diff", "HEAD", "--binary") or ""
+        revision += "-" + hashlib.sha1(diff.encode()).hexdigest()[:12]
+
+    return revision
+
+
+def resolve_revision(database: "PerfDatabase", revision: str) -> str:
+    """
+    Revision key as stored by current_git_hash. A recorded key is taken as is, anything
+    else is resolved as a commit-ish (branch, tag, full or short hash, HEAD~1, ...).
+    """
+    if revision in set(database.revisions()["git_hash"]):
+        return revision
+    return _git_describe(f"{revision}^{{commit}}") or revision
+
+
+class PerfDatabase:
+    def __init__(self, path: Path | None = None):
+        self.path = Path(path) if path else default_database_path()
+        self.path.parent.mkdir(parents=True, exist_ok=True)
+
+        self._connection = sqlite3.connect(self.path)
+        self._connection.executescript(SCHEMA)
+
+    def close(self) -> None:
+        self._connection.close()
+
+    def store(self, test: str, arch: str, git_hash: str, samples: pd.DataFrame) -> None:
+        """Append one run of a test, samples hold params, marker, run_type and value columns"""
+        if samples.empty:
+            return
+
+        timestamp = datetime.now(timezone.utc).isoformat(timespec="seconds")
+
+        with self._connection:
+            cursor = self._connection.execute(
+                "INSERT INTO runs (test, arch, git_hash, timestamp) VALUES (?, ?, ?, ?)",
+                (test, arch, git_hash, timestamp),
+            )
+            run_id = cursor.lastrowid
+
+            rows = samples[["params", "marker", "run_type", "value"]].itertuples(
+                index=False, name=None
+            )
+            self._connection.executemany(
+                "INSERT INTO samples (run_id, params, marker, run_type, value) VALUES (?, ?, ?, ?, ?)",
+                [(run_id, *row) for row in rows],
+            )
+
+    def samples(
+        self, git_hash: str, test: str | None = None, arch: str | None = None
+    ) -> pd.DataFrame:
+        """All samples recorded for a revision, pooled over every run of it"""
+        query = (
+            "SELECT runs.test, runs.arch, samples.params, samples.marker, samples.run_type, samples.value "
+            "FROM samples JOIN runs ON samples.run_id = runs.id WHERE runs.git_hash = ?"
+        )
+        args = [git_hash]
+
+        if test is not None:
+            query += " AND runs.test = ?"
+            args.append(test)
+        if arch is not None:
+            query += " AND runs.arch = ?"
+            args.append(arch)
+
+        return pd.read_sql_query(query, self._connection, params=args)
+
+    def revisions(self) -> pd.DataFrame:
+        query = (
+            "SELECT git_hash, arch, COUNT(*) AS runs, MIN(timestamp) AS first, MAX(timestamp) AS last "
+            "FROM runs GROUP BY git_hash, arch ORDER BY last DESC"
+        )
+        return pd.read_sql_query(query, self._connection)
+
+
+def bootstrap_change(
+    baseline: np.ndarray,
+    candidate: np.ndarray,
+    confidence: float = 0.95,
+    resamples: int = 2000,
+    seed: int = 0,
+) -> tuple[float, float, float]:
+    """
+    Relative change of the candidate mean over the baseline mean, with its
+    percentile bootstrap confidence interval: (change, low, high).
+    """
+    rng = np.random.default_rng(seed)
+
+    baseline_means = rng.choice(baseline, (resamples, len(baseline))).mean(axis=1)
+    candidate_means = rng.choice(candidate, (resamples, len(candidate))).mean(axis=1)
+    changes = candidate_means / baseline_means - 1
+
+    tail = (1 - confidence) / 2 * 100
+    low, high = np.percentile(changes, [tail, 100 - tail])
+
+    return candidate.mean() / baseline.mean() - 1, low, high
+
+
+def compare(
+    database: PerfDatabase,
+    baseline: str,
+    candidate: str,
+    test: str | None = None,
+    arch: str | None = None,
+    confidence: float = 0.95,
+    threshold: float = 0.02,
+) -> pd.DataFrame:
+    """
+    Compare every quantity measured on both revisions. Timings are cycles, so a
+    positive change is a slowdown: it is a regression when the whole interval is
+    above the threshold and an improvement when it is all below -threshold.
+    Quantities with fewer than MIN_SAMPLES samples on either side get no interval
+    and the verdict TOO FEW SAMPLES.
+    """
+    base = database.samples(baseline, test, arch)
+    cand = database.samples(candidate, test, arch)
+
+    base_groups = base.groupby(KEY)["value"]
+    rows = []
+    for key, values in cand.groupby(KEY)["value"]:
+        if key not in base_groups.groups:
+            continue
+
+        base_values = base_groups.get_group(key).to_numpy()
+        cand_values = values.to_numpy()
+
+        if min(len(base_values), len(cand_values)) < MIN_SAMPLES:
+            change = cand_values.mean() / base_values.mean() - 1
+            low = high = np.nan
+            verdict = "TOO FEW SAMPLES"
+        else:
+            change, low, high = bootstrap_change(base_values, cand_values, confidence)
+            if low > threshold:
+                verdict = "REGRESSION"
+            elif high < -threshold:
+                verdict = "IMPROVEMENT"
+            else:
+                verdict = "-"
+
+        rows.append(
+            [
+                *key,
+                base_values.mean(),
+                cand_values.mean(),
+                len(base_values),
+                len(cand_values),
+                change,
+                low,
+                high,
+                verdict,
+            ]
+        )
+
+    columns = KEY + [
+        "baseline",
+        "candidate",
+        "baseline_n",
+        "candidate_n",
+        "change",
+        "ci_low",
+        "ci_high",
+        "verdict",
+    ]
+    return pd.DataFrame(rows, columns=columns)
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("--database", type=Path, help="defaults to $LLK_HOME/perf_data")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    commands.add_parser("revisions", help="list recorded revisions")
+
+    compare_parser = commands.add_parser(
+        "compare", help="flag significant changes against a baseline"
+    )
+    compare_parser.add_argument(
+        "--baseline", required=True, help="baseline commit-ish or recorded revision"
+    )
+    compare_parser.add_argument(
+        "--candidate",
+        default=None,
+        help="commit-ish or recorded revision, defaults to the current checkout",
+    )
+    compare_parser.add_argument("--test", default=None, help="only this perf module")
+    compare_parser.add_argument("--arch", default=None)
+    compare_parser.add_argument("--confidence", type=float, default=0.95)
+    compare_parser.add_argument(
+        "--threshold", type=float, default=0.02, help="relative change to ignore"
+    )
+    compare_parser.add_argument(
+        "--all", action="store_true", help="also print unchanged quantities"
+    )
+
+    args = parser.parse_args(argv)
+    database = PerfDatabase(args.database)
+
+    pd.set_option("display.width", None)
+    pd.set_option("display.max_rows", None)
+    pd.set_option("display.max_colwidth", 80)
+
+    if args.command == "revisions":
+        print(database.revisions().to_string(index=False))
+        return 0
+
+    baseline = resolve_revision(database, args.baseline)
+    candidate = (
+        resolve_revision(database, args.candidate)
+        if args.candidate
+        else current_git_hash()
+    )
+    result = compare(
+        database,
+        baseline,
+        candidate,
+        args.test,
+        args.arch,
+        args.confidence,
+        args.threshold,
+    )
+
+    if result.empty:
+        print(f"No common measurements between {baseline} and {candidate}")
+        return 0
+
+    shown = result if args.all else result[result["verdict"] != "-"]
+    if not shown.empty:
+        print(shown.to_string(index=False))
+
+    regressions = (result["verdict"] == "REGRESSION").sum()
+    print(
+        f"{len(result)} compared, {regressions} regressions, "
+        f"{(result['verdict'] == 'IMPROVEMENT').sum()} improvements "
+        f"({baseline} -> {candidate})"
+    )
+
+    # non-zero exit so CI can gate on it
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
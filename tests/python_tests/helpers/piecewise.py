@@ -0,0 +1,449 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Piecewise polynomial fitter for the SFPU piecewise activation engine.
+
+For an activation, an interval and a segment count (or an error budget) this
+places the breakpoints, fits a linear or quadratic polynomial per segment and
+emits the PiecewiseTable that _calculate_piecewise_ evaluates.
+
+Breakpoints equalise the error of the segments: a bisection on the error level
+finds the smallest level at which a greedy sweep, extending each segment as far
+as it stays under the level, covers the interval with the requested segments.
+The sweep estimates the error of a segment by interpolating at Chebyshev nodes.
+Breakpoints are then rounded to the coefficient format and every segment gets a
+minimax fit from helpers.minimax with coefficients rounded the same way.
+
+Outside the interval the activation's asymptotes take over where it has exact
+ones (0 and x for the ReLU-like activations, the saturation levels of sigmoid
+and tanh), otherwise the end segments extrapolate.
+
+Results are judged by the host SFPU reference of _sfpu_piecewise_: float32
+compares against the breakpoints and Horner's method in float32.
+
+Usage (from tests/python_tests):
+    python -m helpers.piecewise mish --interval -6 6 --order 2 --segments 8
+    python -m helpers.piecewise softplus --interval -8 8 --order 1 --max-error 1e-3 \\
+        --coeff-format bf16 --name SOFTPLUS --output ckernel_sfpu_softplus_table.h
+"""
+
+import argparse
+import bisect
+import math
+import sys
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Callable
+
+from .minimax import (
+    Format,
+    Symmetry,
+    _literal,
+    fit,
+    format_inputs,
+    round_fp32,
+    round_to,
+    sfpu_horner,
+)
+
+# ---------------------------------------------------------------------------
+# Activations
+# ---------------------------------------------------------------------------
+
+
+def _sigmoid(x: float) -> float:
+    return 0.5 * (1.0 + math.tanh(0.5 * x))
+
+
+def _softplus(x: float) -> float:
+    return max(x, 0.0) + math.log1p(math.exp(-abs(x)))
+
+
+@dataclass(frozen=True)
+class Activation:
+    function: Callable[[float], float]
+    below: list[float] | None = None  # exact polynomial for x below the interval
+    above: list[float] | None = None  # exact polynomial for x above the interval
+
+
+ZERO, IDENTITY = [0.0], [0.0, 1.0]
+
+ACTIVATIONS: dict[str, Activation] = {
+    "mish": Activation(lambda x: x * math.tanh(_softplus(x)), ZERO, IDENTITY),
+    "softplus": Activation(_softplus, ZERO, IDENTITY),
+    "hardswish": Activation(
+        lambda x: x * min(max(x + 3.0, 0.0), 6.0) / 6.0, ZERO, IDENTITY
+    ),
+    "hardsigmoid": Activation(lambda x: min(max(x / 6.0 + 0.5, 0.0), 1.0), ZERO, [1.0]),
+    "gelu": Activation(
+        lambda x: 0.5 * x * (1.0 + math.erf(x / math.sqrt(2.0))), ZERO, IDENTITY
+    ),
+    "silu": Activation(lambda x: x * _sigmoid(x), ZERO, IDENTITY),
+    "elu": Activation(lambda x: x if x > 0.0 else math.expm1(x), [-1.0], IDENTITY),
+    "selu": Activation(
+        lambda x: 1.0507009873554805
+        * (x if x > 0.0 else 1.6732632423543772 * math.expm1(x)),
+        [-1.7580993408473766],
+        [0.0, 1.0507009873554805],
+    ),
+    "sigmoid": Activation(_sigmoid, ZERO, [1.0]),
+    "tanh": Activation(math.tanh, [-1.0], [1.0]),
+    "softsign": Activation(lambda x: x / (1.0 + abs(x))),
+}
+
+
+# ---------------------------------------------------------------------------
+# Breakpoint placement
+# ---------------------------------------------------------------------------
+
+
+def _interpolation_error(
+    function, a: float, b: float, order: int, samples: int = 33
+) -> float:
+    """Max error of the interpolant at the order + 1 Chebyshev nodes of [a, b], within 2x of minimax for order <= 2"""
+    if b <= a:
+        return 0.0
+    nodes = [
+        0.5 * (a + b)
+        - 0.5 * (b - a) * math.cos(math.pi * (2 * i + 1) / (2 * order + 2))
+        for i in range(order + 1)
+    ]
+    values = [function(t) for t in nodes]
+
+    def lagrange(t: float) -> float:
+        total = 0.0
+        for i, (ti, vi) in enumerate(zip(nodes, values)):
+            term = vi
+            for j, tj in enumerate(nodes):
+                if j != i:
+                    term *= (t - tj) / (ti - tj)
+            total += term
+        return total
+
+    grid = (a + (b - a) * k / (samples - 1) for k in range(samples))
+    return max(abs(function(t) - lagrange(t)) for t in grid)
+
+
+def _greedy_breakpoints(
+    function, lo: float, hi: float, order: int, level: float, limit: int
+):
+    """Inner breakpoints of a sweep that extends every segment while its error stays under level"""
+    breakpoints, a = [], lo
+    while _interpolation_error(function, a, hi, order) > level:
+        if len(breakpoints) == limit:
+            return None
+        good, bad = a, hi
+        for _ in range(40):
+            mid = 0.5 * (good + bad)
+            if _interpolation_error(function, a, mid, order) <= level:
+                good = mid
+            else:
+                bad = mid
+        if good <= a:
+            return None
+        breakpoints.append(good)
+        a = good
+    return breakpoints
+
+
+def place_breakpoints(
+    function, lo: float, hi: float, order: int, segments: int
+) -> list[float]:
+    """Inner breakpoints that split [lo, hi] into at most segments pieces of about equal error"""
+    if segments <= 1 or _interpolation_error(function, lo, hi, order) == 0.0:
+        return []
+    good = _interpolation_error(function, lo, hi, order)
+    bad = 0.0
+    best = _greedy_breakpoints(function, lo, hi, order, good, segments - 1)
+    for _ in range(40):
+        level = 0.5 * (good + bad)
+        breakpoints = _greedy_breakpoints(function, lo, hi, order, level, segments - 1)
+        if breakpoints is None:
+            bad = level
+        else:
+            good, best = level, breakpoints
+    return best
+
+
+# ---------------------------------------------------------------------------
+# Fitting
+# ---------------------------------------------------------------------------
+
+
+@dataclass
+class PiecewiseReport:
+    """Absolute error of the float32 result, before any rounding to the output format"""
+
+    inputs: int
+    input_step: int
+    max_abs: float = 0.0
+    worst_input: float = 0.0
+    mean_abs: float = 0.0
+
+    def lines(self, fmt: Format) -> list[str]:
+        thinning = (
+            f", every {self.input_step}th fp32 value" if fmt is Format.FLOAT32 else ""
+        )
+        return [
+            f"inputs: {self.inputs} {fmt.value} values{thinning}",
+            f"max abs error: {self.max_abs:.3e} at x = {self.worst_input!r}",
+            f"mean abs error: {self.mean_abs:.3e}",
+        ]
+
+
+def piecewise_report(
+    function, evaluate, fmt: Format, lo: float, hi: float
+) -> PiecewiseReport:
+    inputs, step = format_inputs(fmt, lo, hi)
+    report = PiecewiseReport(len(inputs), step)
+    total = 0.0
+    for x in inputs:
+        diff = abs(evaluate(x) - function(x))
+        total += diff
+        if diff > report.max_abs:
+            report.max_abs, report.worst_input = diff, x
+    report.mean_abs = total / max(len(inputs), 1)
+    return report
+
+
+@dataclass
+class PiecewiseFit:
+    order: int
+    breakpoints: list[float]  # ascending, one fewer than the segments
+    coeffs: list[list[float]]  # ascending powers of x, per segment
+    report: PiecewiseReport
+
+    @property
+    def segments(self) -> int:
+        return len(self.coeffs)
+
+    def evaluate(self, x: float) -> float:
+        """Host SFPU reference of _sfpu_piecewise_"""
+        x = round_fp32(x)
+        return sfpu_horner(self.coeffs[bisect.bisect_right(self.breakpoints, x)], x)
+
+    def declaration(self, name: str) -> str:
+        """constexpr PiecewiseTable named name, for code inside namespace ckernel::sfpu"""
+        breakpoints = ", ".join(_literal(b) for b in self.breakpoints) or "0.0f"
+        coeffs = ", ".join(
+            "{" + ", ".join(_literal(c) for c in segment) + "}"
+            for segment in self.coeffs
+        )
+        return (
+            f"constexpr PiecewiseTable<{self.segments}, {self.order}> {name} = "
+            f"{{{{{breakpoints}}}, {{{coeffs}}}}};"
+        )
+
+
+def _padded(polynomial: list[float], order: int) -> list[float]:
+    return polynomial + [0.0] * (order + 1 - len(polynomial))
+
+
+def fit_piecewise(
+    activation: Activation,
+    lo: float,
+    hi: float,
+    order: int,
+    segments: int,
+    fmt: Format,
+    coeff_format: Format = Format.FLOAT32,
+    report_interval: tuple[float, float] | None = None,
+) -> PiecewiseFit:
+    """segments polynomials on [lo, hi], plus the exact tails of the activation outside it"""
+    function = activation.function
+    lo, hi = round_to(lo, coeff_format), round_to(hi, coeff_format)
+    # The bisection leaves breakpoints that belong at 0 a few ulp of the interval away from it
+    inner = [
+        0.0 if abs(b) < 2.0**-20 * (hi - lo) else b
+        for b in place_breakpoints(function, lo, hi, order, segments)
+    ]
+    edges = [lo] + sorted({round_to(b, coeff_format) for b in inner} - {lo, hi}) + [hi]
+
+    breakpoints, coeffs = [], []
+    if activation.below is not None:
+        breakpoints.append(lo)
+        coeffs.append(_padded(activation.below, order))
+    for a, b in zip(edges, edges[1:]):
+        coeffs.append(fit(function, a, b, order, Symmetry.NONE, False, coeff_format))
+    breakpoints.extend(edges[1:-1])
+    if activation.above is not None:
+        breakpoints.append(hi)
+        coeffs.append(_padded(activation.above, order))
+
+    result = PiecewiseFit(order, breakpoints, coeffs, None)
+    report_lo, report_hi = report_interval or (
+        lo - 0.25 * (hi - lo),
+        hi + 0.25 * (hi - lo),
+    )
+    result.report = piecewise_report(
+        function, result.evaluate, fmt, report_lo, report_hi
+    )
+    return result
+
+
+def fewest_segments(
+    activation: Activation,
+    lo: float,
+    hi: float,
+    order: int,
+    fmt: Format,
+    max_error: float,
+    coeff_format: Format = Format.FLOAT32,
+    max_segments: int = 32,
+    report_interval: tuple[float, float] | None = None,
+    verbose: bool = False,
+) -> PiecewiseFit | None:
+    """First segment count on [lo, hi] whose max absolute error meets max_error"""
+    for segments in range(1, max_segments + 1):
+        result = fit_piecewise(
+            activation, lo, hi, order, segments, fmt, coeff_format, report_interval
+        )
+        if verbose:
+            print(
+                f"{segments} segments: max abs error {result.report.max_abs:.3e}",
+                file=sys.stderr,
+            )
+        if result.report.max_abs <= max_error:
+            return result
+    return None
+
+
+# ---------------------------------------------------------------------------
+# Emission
+# ---------------------------------------------------------------------------
+
+
+def emit_header(
+    name: str,
+    activation: str,
+    lo: float,
+    hi: float,
+    fmt: Format,
+    coeff_format: Format,
+    result: PiecewiseFit,
+) -> str:
+    kind = {1: "linear", 2: "quadratic"}.get(result.order, f"order {result.order}")
+    lines = [
+        "// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC",
+        "//",
+        "// SPDX-License-Identifier: Apache-2.0",
+        "",
+        "// Generated by tests/python_tests/helpers/piecewise.py, do not edit",
+        f"// {activation}(x) fitted on [{lo!r}, {hi!r}], {result.segments} piecewise {kind} "
+        f"segments, {coeff_format.value} breakpoints and coefficients",
+        f"// _calculate_piecewise_<APPROXIMATION_MODE, ITERATIONS>({name})",
+        "//",
+        f"// Host SFPU reference, {fmt.value} result:",
+        *(f"//   {line}" for line in result.report.lines(fmt)),
+        "",
+        "#pragma once",
+        "",
+        '#include "sfpu/ckernel_sfpu_piecewise.h"',
+        "",
+        "namespace ckernel::sfpu",
+        "{",
+        "",
+        result.declaration(name),
+        "",
+        "} // namespace ckernel::sfpu",
+        "",
+    ]
+    return "\n".join(lines)
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("activation", choices=sorted(ACTIVATIONS))
+    parser.add_argument(
+        "--interval", type=float, nargs=2, required=True, metavar=("LO", "HI")
+    )
+    parser.add_argument(
+        "--order", type=int, choices=[1, 2, 3], default=1, help="1 linear, 2 quadratic"
+    )
+    budget = parser.add_mutually_exclusive_group(required=True)
+    budget.add_argument("--segments", type=int, help="segments inside the interval")
+    budget.add_argument(
+        "--max-error", type=float, help="absolute error budget, fewest segments"
+    )
+    parser.add_argument("--max-segments", type=int, default=32)
+    parser.add_argument(
+        "--format",
+        choices=[f.value for f in Format],
+        default="bf16",
+        help="result format",
+    )
+    parser.add_argument(
+        "--coeff-format",
+        choices=[f.value for f in Format],
+        default="fp32",
+        help="format the breakpoints and coefficients are loaded in",
+    )
+    parser.add_argument(
+        "--report-interval",
+        type=float,
+        nargs=2,
+        default=None,
+        metavar=("LO", "HI"),
+        help="range of the error report, default the interval widened by a quarter on each side",
+    )
+    parser.add_argument("--name", default=None, help="table name, default ACTIVATION")
+    parser.add_argument(
+        "--output", type=Path, default=None, help="header, default stdout"
+    )
+    args = parser.parse_args(argv)
+
+    lo, hi = args.interval
+    fmt, coeff_format = Format(args.format), Format(args.coeff_format)
+    activation = ACTIVATIONS[args.activation]
+    if args.segments is not None:
+        result = fit_piecewise(
+            activation,
+            lo,
+            hi,
+            args.order,
+            args.segments,
+            fmt,
+            coeff_format,
+            args.report_interval,
+        )
+    else:
+        result = fewest_segments(
+            activation,
+            lo,
+            hi,
+            args.order,
+            fmt,
+            args.max_error,
+            coeff_format,
+            args.max_segments,
+            args.report_interval,
+            verbose=True,
+        )
+        if result is None:
+            print(
+                f"no fit up to {args.max_segments} segments meets {args.max_error}",
+                file=sys.stderr,
+            )
+            return 1
+
+    header = emit_header(
+        args.name or args.activation.upper(),
+        args.activation,
+        lo,
+        hi,
+        fmt,
+        coeff_format,
+        result,
+    )
+    if args.output is None:
+        sys.stdout.write(header)
+    else:
+        args.output.write_text(header)
+    for line in result.report.lines(fmt):
+        print(line, file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
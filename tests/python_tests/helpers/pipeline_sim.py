@@ -0,0 +1,688 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Cycle-approximate simulator of the unpack, math and pack TRISC pipeline.
+
+Each thread is an in-order stream of Tensix operations. Operations on an
+execution unit (unpackers, FPU, SFPU, packer) are issued in one cycle and then
+occupy the unit for their cost, so a busy unit back-pressures every thread
+issuing to it. The synchronisation the LLKs rely on is modelled explicitly:
+SrcA/SrcB have two banks each, set valid by the unpacker and cleared by math,
+Dest sections are handed from math to pack through the MATH_PACK semaphore
+(max 2 with SyncHalf, 1 with SyncFull), and STALLWAIT waits for units to
+drain. The simulation predicts the L1_TO_L1 time of the kernel and which stage
+bounds it.
+
+Streams come from tile_pipeline, which mirrors the per-tile protocol of the
+LLKs, or from decode_disassembly on the dis/<thread>.S files of `make dis`.
+Costs are per operation and should be calibrated against the *_ISOLATE perf
+runs of the same kernel.
+
+Usage (from tests/python_tests):
+    python -m helpers.pipeline_sim tiles --tiles 16 --unpack 40 --math 64 --pack 48
+    python -m helpers.pipeline_sim dis <build>/dis --repeat 16
+"""
+
+import argparse
+import heapq
+import re
+import sys
+from dataclasses import dataclass, field
+from pathlib import Path
+
+from .llk_params import DstSync
+
+THREADS = ("UNPACK", "MATH", "PACK")
+UNITS = ("UNPACK0", "UNPACK1", "FPU", "SFPU", "PACK")
+
+# Unit an operand register is written by
+SRC_UNPACKER = {"A": "UNPACK0", "B": "UNPACK1"}
+SRC_BANKS = 2
+
+# ckernel::semaphore
+SEMAPHORES = {
+    "MATH_PACK": 1,
+    "UNPACK_TO_DEST": 2,
+    "UNPACK_OPERAND_SYNC": 3,
+    "PACK_DONE": 4,
+    "UNPACK_SYNC": 5,
+    "UNPACK_MATH_DONE": 6,
+    "MATH_DONE": 7,
+}
+SEMAPHORE_MAX = 15
+
+
+# ---------------------------------------------------------------------------
+# Operations
+# ---------------------------------------------------------------------------
+
+
+@dataclass(frozen=True)
+class Issue:
+    """Occupy a unit for `cycles`, optionally producing or consuming operands"""
+
+    unit: str
+    cycles: int
+    reads: tuple[str, ...] = ()  # sources that must hold valid data at issue
+    clears: tuple[str, ...] = ()  # sources released when the operation retires
+    sets: tuple[str, ...] = ()  # sources made valid when the operation retires
+    name: str = ""
+
+
+@dataclass(frozen=True)
+class StallWait:
+    """Wait for units to drain and/or source banks to reach a state"""
+
+    units: tuple[str, ...] = ()
+    src_valid: tuple[str, ...] = ()
+    src_clear: tuple[str, ...] = ()
+
+
+@dataclass(frozen=True)
+class SemPost:
+    sem: int
+
+
+@dataclass(frozen=True)
+class SemGet:
+    sem: int
+
+
+@dataclass(frozen=True)
+class SemWait:
+    sem: int
+    condition: str  # "zero" or "max", the condition the thread stalls on
+
+
+@dataclass(frozen=True)
+class SetDvalid:
+    srcs: tuple[str, ...]
+
+
+@dataclass(frozen=True)
+class ClearDvalid:
+    srcs: tuple[str, ...]
+
+
+@dataclass(frozen=True)
+class Delay:
+    """Thread local work that does not touch a unit (RISC-V code, config writes)"""
+
+    cycles: int
+
+
+@dataclass(frozen=True)
+class Marker:
+    name: str
+
+
+# ---------------------------------------------------------------------------
+# Engine
+# ---------------------------------------------------------------------------
+
+
+@dataclass
+class ThreadStats:
+    end: int = 0
+    issued: int = 0
+    work: dict[str, int] = field(
+        default_factory=dict
+    )  # cycles per unit, "RISCV" for delays
+    stalls: dict[str, int] = field(default_factory=dict)
+    markers: dict[str, int] = field(default_factory=dict)
+
+    def stall(self, reason: str, cycles: int) -> None:
+        if cycles > 0:
+            self.stalls[reason] = self.stalls.get(reason, 0) + cycles
+
+
+@dataclass
+class SimulationResult:
+    cycles: int
+    threads: dict[str, ThreadStats]
+    unit_busy: dict[str, int]
+    deadlocked: tuple[str, ...] = ()
+
+    def utilization(self, unit: str) -> float:
+        return self.unit_busy[unit] / self.cycles if self.cycles else 0.0
+
+    @property
+    def bottleneck(self) -> tuple[str, str]:
+        """
+        (thread, resource) with the most work of its own: in a pipeline the
+        slowest stage sets the steady state throughput, everything else ends up
+        stalled on it through dvalid or the Dest semaphore.
+        """
+
+        def stage_cycles(stats: ThreadStats) -> int:
+            # the units a thread drives run in parallel with each other
+            return max(stats.work.values(), default=0)
+
+        thread, stats = max(
+            self.threads.items(), key=lambda item: stage_cycles(item[1])
+        )
+        if not stats.work:
+            return thread, "-"
+        return thread, max(stats.work, key=stats.work.get)
+
+    def report(self) -> str:
+        lines = [f"Predicted L1_TO_L1: {self.cycles} cycles"]
+        if self.deadlocked:
+            lines.append(f"DEADLOCK, blocked threads: {', '.join(self.deadlocked)}")
+
+        lines.append("")
+        lines.append(f"{'thread':<8} {'end':>8} {'issued':>7}  stalls")
+        for name, stats in self.threads.items():
+            stalls = ", ".join(f"{k}={v}" for k, v in sorted(stats.stalls.items()))
+            lines.append(f"{name:<8} {stats.end:>8} {stats.issued:>7}  {stalls or '-'}")
+
+        lines.append("")
+        lines.append(f"{'unit':<8} {'busy':>8} {'util':>7}")
+        for unit, busy in self.unit_busy.items():
+            if busy:
+                lines.append(f"{unit:<8} {busy:>8} {self.utilization(unit):>7.1%}")
+
+        lines.append("")
+        thread, resource = self.bottleneck
+        lines.append(f"Bottleneck: {thread} ({resource})")
+        return "\n".join(lines)
+
+
+class PipelineSimulator:
+    """
+    Discrete-event simulation of the thread streams. Every thread step is an
+    event at the thread's local time, operation retirements are events at the
+    cycle they complete, so conditions are always checked against the state
+    at that cycle. Blocked threads are retried whenever the shared state changes.
+    """
+
+    def __init__(
+        self,
+        streams: dict[str, list],
+        semaphore_max: dict[int, int] | None = None,
+        issue_cycles: int = 1,
+    ):
+        self.streams = streams
+        self.semaphore_max = semaphore_max or {}
+        self.issue_cycles = issue_cycles
+
+    def run(self) -> SimulationResult:
+        self.now = 0
+        self.sequence = 0
+        self.events = []
+        self.semaphores = {}
+        self.src_valid = {src: 0 for src in SRC_UNPACKER}
+        # a bank is only reusable once the operation consuming it retires
+        self.src_pending_clear = {src: 0 for src in SRC_UNPACKER}
+        self.unit_free = {unit: 0 for unit in UNITS}
+        self.unit_busy = {unit: 0 for unit in UNITS}
+
+        self.pc = {thread: 0 for thread in self.streams}
+        self.blocked = {}  # thread -> (reason, blocked since)
+        self.stats = {thread: ThreadStats() for thread in self.streams}
+
+        for thread in self.streams:
+            self._schedule(0, ("step", thread))
+
+        while self.events:
+            self.now, _, event = heapq.heappop(self.events)
+            if event[0] == "step":
+                self._step(event[1])
+            else:
+                event[1]()
+                self._wake()
+
+        deadlocked = tuple(self.blocked)
+        for thread, (reason, since) in self.blocked.items():
+            self.stats[thread].stall(reason, self.now - since)
+            self.stats[thread].end = self.now
+
+        cycles = max([s.end for s in self.stats.values()] + [self.now])
+        return SimulationResult(cycles, self.stats, self.unit_busy, deadlocked)
+
+    def _schedule(self, time: int, event: tuple) -> None:
+        self.sequence += 1
+        heapq.heappush(self.events, (time, self.sequence, event))
+
+    def _wake(self) -> None:
+        for thread, (reason, since) in list(self.blocked.items()):
+            del self.blocked[thread]
+            self.stats[thread].stall(reason, self.now - since)
+            self._schedule(self.now, ("step", thread))
+
+    def _block(self, thread: str, reason: str) -> None:
+        self.blocked[thread] = (reason, self.now)
+
+    def _retire(self, time: int, callback) -> None:
+        self._schedule(time, ("retire", callback))
+
+    def _step(self, thread: str) -> None:
+        stream = self.streams[thread]
+        stats = self.stats[thread]
+
+        if self.pc[thread] == len(stream):
+            stats.end = self.now
+            return
+
+        op = stream[self.pc[thread]]
+        blocked = self._blocking_reason(op)
+        if blocked:
+            self._block(thread, blocked)
+            return
+
+        next_time = self._execute(thread, op)
+        if isinstance(op, Issue):
+            # the thread's instruction queue waits for the unit to accept the operation
+            stats.stall(f"unit:{op.unit}", next_time - self.now - self.issue_cycles)
+        elif isinstance(op, StallWait):
+            stats.stall("stallwait", next_time - self.now)
+
+        self.pc[thread] += 1
+        stats.issued += 1
+        self._schedule(next_time, ("step", thread))
+        if isinstance(op, (SemPost, SemGet, SetDvalid, ClearDvalid)):
+            self._wake()
+
+    def _blocking_reason(self, op) -> str | None:
+        if isinstance(op, SemWait):
+            value = self.semaphores.get(op.sem, 0)
+            if op.condition == "zero" and value == 0:
+                return f"sem{op.sem}"
+            limit = self.semaphore_max.get(op.sem, SEMAPHORE_MAX)
+            if op.condition == "max" and value >= limit:
+                return f"sem{op.sem}"
+        elif isinstance(op, Issue):
+            for src in op.reads:
+                if self.src_valid[src] == 0:
+                    return f"src{src}_valid"
+            for src in op.sets:
+                # the unpacker can only write a bank math has released
+                if self.src_valid[src] + self.src_pending_clear[src] >= SRC_BANKS:
+                    return f"src{src}_free"
+        elif isinstance(op, StallWait):
+            for src in op.src_valid:
+                if self.src_valid[src] == 0:
+                    return f"src{src}_valid"
+            for src in op.src_clear:
+                if self.src_valid[src] or self.src_pending_clear[src]:
+                    return f"src{src}_clear"
+        return None
+
+    def _execute(self, thread: str, op) -> int:
+        if isinstance(op, Issue):
+            start = max(self.now, self.unit_free[op.unit])
+            end = start + op.cycles
+            self.unit_free[op.unit] = end
+            self.unit_busy[op.unit] += op.cycles
+            work = self.stats[thread].work
+            work[op.unit] = work.get(op.unit, 0) + op.cycles
+
+            for src in op.sets:
+                self.src_pending_clear[src] += 1  # reserved until written
+            for src in op.clears:
+                self.src_valid[src] -= 1
+                self.src_pending_clear[src] += 1
+
+            def retire(op=op):
+                for src in op.sets:
+                    self.src_pending_clear[src] -= 1
+                    self.src_valid[src] += 1
+                for src in op.clears:
+                    self.src_pending_clear[src] -= 1
+
+            if op.sets or op.clears:
+                self._retire(end, retire)
+            return start + self.issue_cycles
+
+        if isinstance(op, StallWait):
+            return max([self.now] + [self.unit_free[unit] for unit in op.units])
+
+        if isinstance(op, SemPost):
+            value = self.semaphores.get(op.sem, 0)
+            self.semaphores[op.sem] = min(value + 1, SEMAPHORE_MAX)
+        elif isinstance(op, SemGet):
+            self.semaphores[op.sem] = max(self.semaphores.get(op.sem, 0) - 1, 0)
+        elif isinstance(op, SetDvalid):
+            for src in op.srcs:
+                self.src_valid[src] = min(self.src_valid[src] + 1, SRC_BANKS)
+        elif isinstance(op, ClearDvalid):
+            for src in op.srcs:
+                self.src_valid[src] = max(self.src_valid[src] - 1, 0)
+        elif isinstance(op, Delay):
+            work = self.stats[thread].work
+            work["RISCV"] = work.get("RISCV", 0) + op.cycles
+            return self.now + op.cycles
+        elif isinstance(op, Marker):
+            self.stats[thread].markers[op.name] = self.now
+            return self.now
+
+        return self.now + self.issue_cycles
+
+
+def simulate(
+    streams: dict[str, list], dst_sync: DstSync = DstSync.SyncHalf
+) -> SimulationResult:
+    semaphore_max = {
+        SEMAPHORES["MATH_PACK"]: 2 if dst_sync == DstSync.SyncHalf else 1,
+    }
+    return PipelineSimulator(streams, semaphore_max).run()
+
+
+# ---------------------------------------------------------------------------
+# Stream builders
+# ---------------------------------------------------------------------------
+
+
+def tile_pipeline(
+    tile_count: int,
+    unpack_cycles: int,
+    math_cycles: int,
+    pack_cycles: int,
+    operands: int = 2,
+    sfpu_cycles: int = 0,
+    dst_sync: DstSync = DstSync.SyncHalf,
+    tiles_per_section: int | None = None,
+    math_ops_per_tile: int = 1,
+    loop_overhead: int = 0,
+) -> dict[str, list]:
+    """
+    Streams of an eltwise style kernel, following the LLK protocol per tile:
+    unpack writes one tile per operand and sets dvalid, math waits for Dest
+    space (SEMWAIT MATH_PACK max), runs the tile as math_ops_per_tile MOP
+    slices and clears dvalid with the last one, then hands a full Dest section
+    to pack (STALLWAIT + SEMPOST). Pack waits for a section (SEMWAIT zero),
+    packs its tiles and releases it (STALLWAIT + SEMGET).
+    """
+    if tiles_per_section is None:
+        # 16-bit Dest holds 16 tiles, half of it with SyncHalf
+        tiles_per_section = 8 if dst_sync == DstSync.SyncHalf else 16
+    tiles_per_section = min(tiles_per_section, tile_count)
+
+    srcs = ("A", "B")[:operands]
+    math_pack = SEMAPHORES["MATH_PACK"]
+
+    unpack, math, pack = [], [], []
+    for tile in range(tile_count):
+        if loop_overhead:
+            unpack.append(Delay(loop_overhead))
+        for src in srcs:
+            unpack.append(
+                Issue(SRC_UNPACKER[src], unpack_cycles, sets=(src,), name="UNPACR")
+            )
+
+        first_in_section = tile % tiles_per_section == 0
+        last_in_section = (
+            tile % tiles_per_section == tiles_per_section - 1 or tile == tile_count - 1
+        )
+
+        if first_in_section:
+            math.append(SemWait(math_pack, "max"))
+        if loop_overhead:
+            math.append(Delay(loop_overhead))
+        slice_cycles = max(math_cycles // math_ops_per_tile, 1)
+        for i in range(math_ops_per_tile):
+            last_slice = i == math_ops_per_tile - 1
+            math.append(
+                Issue(
+                    "FPU",
+                    slice_cycles,
+                    reads=srcs if i == 0 else (),
+                    clears=srcs if last_slice else (),
+                    name="MATH",
+                )
+            )
+        if sfpu_cycles:
+            math.append(StallWait(units=("FPU",)))
+            math.append(Issue("SFPU", sfpu_cycles, name="SFPU"))
+        if last_in_section:
+            math.append(StallWait(units=("FPU", "SFPU")))
+            math.append(SemPost(math_pack))
+
+        if first_in_section:
+            pack.append(SemWait(math_pack, "zero"))
+        if loop_overhead:
+            pack.append(Delay(loop_overhead))
+        pack.append(Issue("PACK", pack_cycles, name="PACR"))
+        if last_in_section:
+            pack.append(StallWait(units=("PACK",)))
+            pack.append(SemGet(math_pack))
+
+    return {"UNPACK": unpack, "MATH": math, "PACK": pack}
+
+
+@dataclass
+class InstructionCosts:
+    """Cycles a unit is occupied per instruction, calibrate against *_ISOLATE runs"""
+
+    unpack: int = 16  # UNPACR, one face
+    fpu: int = 16  # ELW*, MVMUL, GMPOOL, GAPOOL, MOV*2D
+    sfpu: int = 2  # SFP*
+    pack: int = 16  # PACR, one face
+    mop: int = 64  # MOP / REPLAY bodies are not visible to static decoding
+    other: int = 1
+
+
+# Tensix opcodes (ckernel_ops.h) the model distinguishes
+OPCODES = {
+    0x01: "MOP",
+    0x02: "NOP",
+    0x04: "REPLAY",
+    0x12: "MOVA2D",
+    0x13: "MOVB2D",
+    0x26: "MVMUL",
+    0x27: "ELWMUL",
+    0x28: "ELWADD",
+    0x30: "ELWSUB",
+    0x33: "GMPOOL",
+    0x34: "GAPOOL",
+    0x36: "CLEARDVALID",
+    0x41: "PACR",
+    0x42: "UNPACR",
+    0x43: "UNPACR_NOP",
+    0x57: "SETDVALID",
+    0xA2: "STALLWAIT",
+    0xA4: "SEMPOST",
+    0xA5: "SEMGET",
+    0xA6: "SEMWAIT",
+}
+
+FPU_CLEARING = {"ELWMUL", "ELWADD", "ELWSUB", "MVMUL", "GMPOOL", "GAPOOL"}
+
+THREAD_UNITS = {"UNPACK": "UNPACK0", "MATH": "FPU", "PACK": "PACK"}
+
+# p_stall wait resources
+STALL_UNITS = {
+    0x2: "UNPACK0",
+    0x4: "UNPACK1",
+    0x8: "PACK",
+    0x10: "PACK",
+    0x20: "PACK",
+    0x40: "PACK",
+    0x80: "FPU",
+    0x4000: "SFPU",
+}
+STALL_SRCA_CLR, STALL_SRCB_CLR = 0x100, 0x200
+STALL_SRCA_VLD, STALL_SRCB_VLD = 0x400, 0x800
+
+UNP_SET_DVALID = 0b111
+
+
+def _srcs(mask: int) -> tuple[str, ...]:
+    return tuple(src for bit, src in ((1, "A"), (2, "B")) if mask & bit)
+
+
+def _semaphores(mask: int) -> list[int]:
+    return [sem for sem in range(8) if mask & (1 << sem)]
+
+
+def decode_instruction(word: int, thread: str, costs: InstructionCosts) -> list | None:
+    """Operations for one Tensix instruction word (TT_OP encoding), None for unknown opcodes"""
+    opcode = word >> 24
+    params = word & 0xFFFFFF
+    name = OPCODES.get(opcode)
+
+    if name is None:
+        if 0x70 <= opcode <= 0x9F:  # SFP* block
+            return [Issue("SFPU", costs.sfpu, name="SFP")]
+        return None
+
+    if name == "UNPACR":
+        src = "B" if params >> 23 & 1 else "A"
+        sets = (src,) if params >> 6 & 1 else ()
+        return [Issue(SRC_UNPACKER[src], costs.unpack, sets=sets, name=name)]
+    if name == "UNPACR_NOP":
+        src = "B" if params >> 23 & 1 else "A"
+        if params & 0x7 == UNP_SET_DVALID:
+            return [Issue(SRC_UNPACKER[src], costs.other, sets=(src,), name=name)]
+        return [Issue(SRC_UNPACKER[src], costs.other, name=name)]
+    if name in FPU_CLEARING:
+        clears = _srcs(params >> 22 & 0x3)
+        return [Issue("FPU", costs.fpu, reads=clears, clears=clears, name=name)]
+    if name in ("MOVA2D", "MOVB2D"):
+        return [Issue("FPU", costs.fpu, name=name)]
+    if name == "PACR":
+        return [Issue("PACK", costs.pack, name=name)]
+    if name in ("MOP", "REPLAY"):
+        return [Issue(THREAD_UNITS[thread], costs.mop, name=name)]
+    if name == "SETDVALID":
+        return [SetDvalid(_srcs(params))]
+    if name == "CLEARDVALID":
+        return [ClearDvalid(_srcs(params >> 22 & 0x3))]
+    if name == "STALLWAIT":
+        wait = params & 0x7FFF
+        units = tuple(
+            dict.fromkeys(unit for bit, unit in STALL_UNITS.items() if wait & bit)
+        )
+        src_clear = _srcs(
+            bool(wait & STALL_SRCA_CLR) | bool(wait & STALL_SRCB_CLR) << 1
+        )
+        src_valid = _srcs(
+            bool(wait & STALL_SRCA_VLD) | bool(wait & STALL_SRCB_VLD) << 1
+        )
+        return [StallWait(units, src_valid, src_clear)]
+    if name == "SEMPOST":
+        return [SemPost(sem) for sem in _semaphores(params >> 2)]
+    if name == "SEMGET":
+        return [SemGet(sem) for sem in _semaphores(params >> 2)]
+    if name == "SEMWAIT":
+        condition = "zero" if params & 0x3 == 1 else "max"
+        return [SemWait(sem, condition) for sem in _semaphores(params >> 2 & 0x1FFF)]
+
+    return [Delay(costs.other)]
+
+
+def _unswizzle(word: int) -> int:
+    # .ttinsn swizzles the TT_OP word into the RISC-V stream (rotated by 2 bits)
+    return (word >> 2 | word << 30) & 0xFFFFFFFF
+
+
+DISASSEMBLY_LINE = re.compile(r"^\s*([0-9a-f]+):\s+([0-9a-f]{8})\s+(\S+)")
+
+
+def decode_disassembly(
+    text: str, thread: str, costs: InstructionCosts | None = None
+) -> list:
+    """
+    Tensix operations of an objdump listing (dis/<thread>.S). Only tt*
+    mnemonics are kept, the RISC-V code between them is not timed; its
+    overhead can be added with Delay operations or the cost table. The word
+    is decoded in whichever encoding matches the mnemonic objdump printed.
+    """
+    costs = costs or InstructionCosts()
+    ops = []
+    for line in text.splitlines():
+        match = DISASSEMBLY_LINE.match(line)
+        if not match or not match.group(3).startswith("tt"):
+            continue
+
+        raw = int(match.group(2), 16)
+        mnemonic = match.group(3)[2:].upper()
+        word = raw
+        for candidate in (_unswizzle(raw), raw):
+            if OPCODES.get(candidate >> 24) == mnemonic:
+                word = candidate
+                break
+
+        decoded = decode_instruction(word, thread, costs)
+        if decoded is None:
+            decoded = [
+                (
+                    Issue("SFPU", costs.sfpu, name=mnemonic)
+                    if mnemonic.startswith("SFP")
+                    else Delay(costs.other)
+                )
+            ]
+        ops.extend(decoded)
+    return ops
+
+
+def disassembly_streams(
+    directory: Path, repeat: int = 1, costs: InstructionCosts | None = None
+) -> dict[str, list]:
+    """Streams of the unpack/math/pack.S listings of one test build, repeated per tile"""
+    streams = {}
+    for thread in THREADS:
+        text = (Path(directory) / f"{thread.lower()}.S").read_text()
+        streams[thread] = decode_disassembly(text, thread, costs) * repeat
+    return streams
+
+
+def main(argv=None) -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument(
+        "--dst-sync", choices=[s.name for s in DstSync], default="SyncHalf"
+    )
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    tiles = commands.add_parser("tiles", help="per-tile costs of an eltwise pipeline")
+    tiles.add_argument("--tiles", type=int, default=16)
+    tiles.add_argument("--operands", type=int, choices=[1, 2], default=2)
+    tiles.add_argument("--unpack", type=int, required=True, help="cycles per operand")
+    tiles.add_argument("--math", type=int, required=True)
+    tiles.add_argument("--sfpu", type=int, default=0)
+    tiles.add_argument("--pack", type=int, required=True)
+    tiles.add_argument("--tiles-per-section", type=int, default=None)
+    tiles.add_argument("--math-ops-per-tile", type=int, default=1)
+    tiles.add_argument("--loop-overhead", type=int, default=0)
+
+    dis = commands.add_parser("dis", help="instruction streams of a `make dis` build")
+    dis.add_argument("directory", type=Path)
+    dis.add_argument(
+        "--repeat", type=int, default=1, help="tiles the kernel loops over"
+    )
+    for cost, default in vars(InstructionCosts()).items():
+        dis.add_argument(f"--{cost}-cycles", type=int, default=default)
+
+    args = parser.parse_args(argv)
+    dst_sync = DstSync[args.dst_sync]
+
+    if args.command == "tiles":
+        streams = tile_pipeline(
+            args.tiles,
+            args.unpack,
+            args.math,
+            args.pack,
+            operands=args.operands,
+            sfpu_cycles=args.sfpu,
+            dst_sync=dst_sync,
+            tiles_per_section=args.tiles_per_section,
+            math_ops_per_tile=args.math_ops_per_tile,
+            loop_overhead=args.loop_overhead,
+        )
+    else:
+        costs = InstructionCosts(
+            **{
+                cost: getattr(args, f"{cost}_cycles")
+                for cost in vars(InstructionCosts())
+            }
+        )
+        streams = disassembly_streams(args.directory, args.repeat, costs)
+
+    result = simulate(streams, dst_sync)
+    print(result.report())
+    return 1 if result.deadlocked else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -2,6 +2,7 @@
 #
 # SPDX-License-Identifier: Apache-2.0
 
+import json
 import os
 import re
 from dataclasses import dataclass
@@ -9,7 +10,7 @@ from enum import Enum
 from pathlib import Path
 
 import pandas as pd
-from helpers.chip_architecture import get_chip_architecture
+from helpers.chip_architecture import ChipArchitecture, get_chip_architecture
 from ttexalens.tt_exalens_lib import read_words_from_device
 
 
@@ -21,6 +22,121 @@ class ProfilerFullMarker:
     id: int
 
 
+@dataclass(frozen=True)
+class ProfilerCore:
+    thread: str  # thread name in ProfilerData
+    define: str  # compile definition of the core's sources
+    synced: bool = True  # waits for the other synced cores before running the kernel
+
+
+@dataclass(frozen=True)
+class ProfilerLayout:
+    """
+    Placement of the per-core profiler buffers in L1, the core id is the index in cores.
+    The device reads it from profiler_layout.h, written by test_config before every build
+    like build.h and not tracked, the host from this class.
+    """
+
+    cores: tuple[ProfilerCore, ...]
+    buffers_end: int = 0x16E000
+    buffer_length: int = 0x400  # words per core
+
+    HEADER = "tests/helpers/include/profiler_layout.h"
+
+    @property
+    def threads(self) -> list[str]:
+        return [core.thread for core in self.cores]
+
+    @property
+    def buffers_start(self) -> int:
+        return self.buffers_end - len(self.cores) * self.buffer_length * 4
+
+    @property
+    def barrier_start(self) -> int:
+        return self.buffers_start - len(self.cores) * 4
+
+    @property
+    def thread_buffers(self) -> list[int]:
+        return [
+            self.buffers_start + core_id * self.buffer_length * 4
+            for core_id in range(len(self.cores))
+        ]
+
+    def header(self) -> str:
+        sync_mask = sum(
+            1 << core_id for core_id, core in enumerate(self.cores) if core.synced
+        )
+
+        lines = [
+            "// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC",
+            "//",
+            "// SPDX-License-Identifier: Apache-2.0",
+            "// AUTO-GENERATED PROFILER LAYOUT HEADER. DO NOT EDIT MANUALLY!",
+            "",
+            "#pragma once",
+            "",
+            "#include <cstdint>",
+            "",
+            "namespace llk_profiler",
+            "{",
+            "",
+            f"constexpr std::uint32_t NUM_CORES      = {len(self.cores)};",
+            f"constexpr std::uint32_t BUFFER_LENGTH  = {self.buffer_length:#x};",
+            f"constexpr std::uint32_t BUFFERS_END    = 0x{self.buffers_end:X};",
+            f"constexpr std::uint32_t SYNC_CORE_MASK = 0b{sync_mask:0{len(self.cores)}b};",
+            "",
+        ]
+
+        for core_id, core in enumerate(self.cores):
+            directive = "#if" if core_id == 0 else "#elif"
+            lines += [
+                f"{directive} defined({core.define})",
+                f"constexpr std::uint32_t CORE_ID = {core_id}; // {core.thread}",
+            ]
+        lines += [
+            "#else",
+            '#error "Profiler layout has no buffer for this core"',
+            "#endif",
+            "",
+            "} // namespace llk_profiler",
+            "",
+        ]
+
+        return "\n".join(lines)
+
+    def write_header(self) -> None:
+        """Rewritten only on change, the shared BRISC objects depend on it"""
+        llk_home = Path(os.environ.get("LLK_HOME"))
+        path = llk_home / self.HEADER
+
+        content = self.header()
+        if path.exists() and path.read_text() == content:
+            return
+        path.write_text(content)
+
+
+_TRISC_CORES = (
+    ProfilerCore("UNPACK", "LLK_TRISC_UNPACK"),
+    ProfilerCore("MATH", "LLK_TRISC_MATH"),
+    ProfilerCore("PACK", "LLK_TRISC_PACK"),
+)
+
+# BRISC only runs the device setup, so it never waits on the TRISC barrier
+PROFILER_LAYOUTS = {
+    ChipArchitecture.WORMHOLE: ProfilerLayout(
+        (ProfilerCore("BRISC", "LLK_BRISC", synced=False), *_TRISC_CORES)
+    ),
+    ChipArchitecture.BLACKHOLE: ProfilerLayout(
+        (ProfilerCore("BRISC", "LLK_BRISC", synced=False), *_TRISC_CORES)
+    ),
+    ChipArchitecture.QUASAR: ProfilerLayout(_TRISC_CORES),
+}
+
+
+def get_profiler_layout() -> ProfilerLayout:
+    return PROFILER_LAYOUTS[get_chip_architecture()]
+
+
 class ProfilerData:
     """
     Used to query the underlying Pandas DataFrame
@@ -35,7 +151,7 @@ class ProfilerData:
 
     The raw event view:
     - Has three entry types: TIMESTAMP, ZONE_START, ZONE_END
-    - Data from each thead is concatenated together (all UNPACK -> MATH -> PACK)
+    - Data from each thead is concatenated together in core id order (e.g. BRISC -> UNPACK -> MATH -> PACK)
     - Each ZONE_START entry is immediately followed by its corresponding ZONE_END entry.
     - There is no "duration" column included.
 
@@ -139,6 +255,18 @@ class ProfilerData:
         return self._post_profiler_view()
 
     # Filter by thread
+    def thread(self, thread: str) -> "ProfilerData":
+        """Filter: Data of one thread, see ProfilerLayout.threads"""
+        return ProfilerData(self.df, self.mask & (self.df["thread"] == thread))
+
+    def triscs(self) -> "ProfilerData":
+        """Filter: Data of the cores running the kernel"""
+        return ProfilerData(self.df, self.mask & (self.df["thread"] != "BRISC"))
+
+    def brisc(self) -> "ProfilerData":
+        """Filter: BRISC data (device setup, WH/BH only)"""
+        return self.thread("BRISC")
+
     def unpack(self) -> "ProfilerData":
         """Filter: Unpack thread data"""
         return ProfilerData(self.df, self.mask & (self.df["thread"] == "UNPACK"))
@@ -168,6 +296,122 @@ class ProfilerData:
         """Filter: Marker"""
         return ProfilerData(self.df, self.mask & (self.df["marker"] == marker))
 
+    # Export
+    def trace_events(
+        self,
+        pid: int = 0,
+        name: str = "Tensix",
+        flows: list[tuple[str, str]] | None = None,
+        cycles_per_us: float = 1000.0,
+        origin: int | None = None,
+    ) -> list[dict]:
+        """
+        Chrome trace events (also loaded by Perfetto) for this data, as one process with one track per thread.
+
+        - Zones become complete slices, nesting follows from their time ranges.
+        - TIMESTAMP entries become instant events, TIMESTAMP_DATA entries counter tracks named after the marker.
+        - flows pairs (producer marker, consumer marker): the n-th producer entry on a thread gets an arrow to the
+          n-th consumer entry, e.g. a tile's dvalid/semaphore handoff between two TRISCs.
+
+        Timestamps are relative to origin (first entry by default) and converted from cycles to microseconds.
+        """
+        frame = self.frame()
+        if frame.empty:
+            return []
+
+        origin = frame["timestamp"].min() if origin is None else origin
+        to_us = lambda cycles: (int(cycles) - origin) / cycles_per_us
+
+        threads = [thread for thread in frame["thread"].cat.categories]
+        tids = {thread: tid for tid, thread in enumerate(threads)}
+
+        events = [
+            {"ph": "M", "pid": pid, "name": "process_name", "args": {"name": name}}
+        ]
+        events += [
+            {
+                "ph": "M",
+                "pid": pid,
+                "tid": tid,
+                "name": "thread_name",
+                "args": {"name": thread},
+            }
+            for thread, tid in tids.items()
+        ]
+        events += [
+            {
+                "ph": "M",
+                "pid": pid,
+                "tid": tid,
+                "name": "thread_sort_index",
+                "args": {"sort_index": tid},
+            }
+            for tid in tids.values()
+        ]
+
+        for entry in frame.itertuples(index=False):
+            event = {
+                "pid": pid,
+                "tid": tids[entry.thread],
+                "name": entry.marker,
+                "ts": to_us(entry.timestamp),
+                "args": {"file": entry.file, "line": int(entry.line)},
+            }
+
+            if entry.type == "ZONE":
+                event.update(
+                    ph="X", cat="zone", dur=int(entry.duration) / cycles_per_us
+                )
+            elif pd.isna(entry.data):
+                event.update(ph="i", cat="timestamp", s="t")
+            else:
+                event.update(
+                    ph="C",
+                    name=f"{entry.thread}:{entry.marker}",
+                    args={"data": int(entry.data)},
+                )
+
+            events.append(event)
+
+        for flow_id, (producer, consumer) in enumerate(flows or []):
+            producers = frame[frame["marker"] == producer]
+            consumers = frame[frame["marker"] == consumer]
+
+            for index, (start, end) in enumerate(
+                zip(
+                    producers.itertuples(index=False), consumers.itertuples(index=False)
+                )
+            ):
+                flow = {
+                    "pid": pid,
+                    "cat": "handoff",
+                    "name": f"{producer} -> {consumer}",
+                    "id": f"{pid}.{flow_id}.{index}",
+                }
+                # a flow starting at the end of the producer slice reads as a handoff
+                start_ts = start.timestamp + (
+                    0 if pd.isna(start.duration) else start.duration
+                )
+                events.append(
+                    {
+                        **flow,
+                        "ph": "s",
+                        "tid": tids[start.thread],
+                        "ts": to_us(start_ts),
+                    }
+                )
+                events.append(
+                    {
+                        **flow,
+                        "ph": "f",
+                        "bp": "e",
+                        "tid": tids[end.thread],
+                        "ts": to_us(end.timestamp),
+                    }
+                )
+
+        return events
+
 
 class Profiler:
 
@@ -175,19 +419,18 @@ class Profiler:
         r"(?P<full_marker>LLK_PROFILER:(?P<file>[^:]+):(?P<line>\d+):(?P<marker>[^']+))",
     )
 
-    BUFFER_LENGTH = 0x400
-    THREAD_BUFFER = [
-        0x16B000,  # Unpack
-        0x16C000,  # Math
-        0x16D000,  # Pack
-    ]
-
+    # Entry layout, see profiler.h: [31:28] type, [27:12] marker id, [11:0] delta
     ENTRY_TYPE_SHAMT = 28
     ENTRY_ID_SHAMT = ENTRY_TYPE_SHAMT - 16
 
     ENTRY_TYPE_MASK = 0xF << ENTRY_TYPE_SHAMT
     ENTRY_ID_MASK = 0xFFFF << ENTRY_ID_SHAMT
-    ENTRY_TIME_HIGH_MASK = 0xFFF
+    ENTRY_DELTA_MASK = (1 << ENTRY_ID_SHAMT) - 1
+
+    # SYNC: [27] bit 31 of the low timestamp word, [26:0] high timestamp word
+    SYNC_LOW_MSB_BIT = 1 << (ENTRY_TYPE_SHAMT - 1)
+    SYNC_HIGH_MASK = SYNC_LOW_MSB_BIT - 1
+    SYNC_LOW_MSB_SHAMT = 31 - (ENTRY_TYPE_SHAMT - 1)
 
     ENTRY_EXISTS_BIT = 0b1000 << ENTRY_TYPE_SHAMT
 
@@ -196,6 +439,7 @@ class Profiler:
         TIMESTAMP_DATA = 0b1001
         ZONE_START = 0b1010
         ZONE_END = 0b1011
+        SYNC = 0b1100
 
     @staticmethod
     def dump_csv(profiler_data, filename: str = "profiler_data.csv") -> None:
@@ -205,6 +449,37 @@ class Profiler:
         output_path.parent.mkdir(parents=True, exist_ok=True)
         profiler_data.to_csv(output_path, index=False)
 
+    @staticmethod
+    def dump_trace(
+        runs: "ProfilerData | list[ProfilerData]",
+        filename: str = "profiler_trace.json",
+        flows: list[tuple[str, str]] | None = None,
+        cycles_per_us: float = 1000.0,
+    ) -> Path:
+        """
+        Write a Chrome JSON trace, open it in ui.perfetto.dev or chrome://tracing.
+        Multiple runs are merged as separate processes, each aligned to its own first entry.
+        """
+        if isinstance(runs, ProfilerData):
+            runs = [runs]
+
+        events = [
+            event
+            for pid, run in enumerate(runs)
+            for event in run.trace_events(
+                pid, f"Run {pid}", flows=flows, cycles_per_us=cycles_per_us
+            )
+        ]
+
+        llk_home = Path(os.environ.get("LLK_HOME"))
+        output_path = llk_home / "tests" / "build" / filename
+
+        output_path.parent.mkdir(parents=True, exist_ok=True)
+        with open(output_path, "w") as f:
+            json.dump({"traceEvents": events, "displayTimeUnit": "ns"}, f)
+
+        return output_path
+
     @staticmethod
     def _hash_meta(s: str) -> int:
         hash32 = 2166136261
@@ -250,16 +525,8 @@ class Profiler:
             / "profiler"
         )
 
-        files = [
-            profiler_dir / "unpack.meta.bin",
-            profiler_dir / "math.meta.bin",
-            profiler_dir / "pack.meta.bin",
-        ]
-
         meta = {}
-        for file in files:
-            if not file.exists():
-                continue
+        for file in sorted(profiler_dir.glob("*.meta.bin")):
             with open(file, "rb") as f:
                 binary = f.read()
                 strings = [s.decode("ascii") for s in binary.split(b"\0")]
@@ -276,20 +543,21 @@ class Profiler:
         return Profiler._parse_buffers(Profiler._load_buffers(), meta)
 
     @staticmethod
-    def _load_buffers(location="0,0", word_count=BUFFER_LENGTH) -> list[list[int]]:
+    def _load_buffers(location="0,0") -> list[list[int]]:
         """Load profiler buffers from device memory for each thread."""
+        layout = get_profiler_layout()
         return [
             read_words_from_device(
-                location=location, addr=buffer_address, word_count=word_count
+                location=location, addr=buffer_address, word_count=layout.buffer_length
             )
-            for buffer_address in Profiler.THREAD_BUFFER
+            for buffer_address in layout.thread_buffers
         ]
 
     @staticmethod
     def _dataframe(rows: list[dict] | None = None) -> pd.DataFrame:
         # Define the schema
         schema = {
-            "thread": pd.CategoricalDtype(categories=["UNPACK", "MATH", "PACK"]),
+            "thread": pd.CategoricalDtype(categories=get_profiler_layout().threads),
             "type": pd.CategoricalDtype(
                 categories=["TIMESTAMP", "ZONE_START", "ZONE_END"]
             ),
@@ -305,12 +573,10 @@ class Profiler:
 
     @staticmethod
     def _parse_buffers(buffers, profiler_meta) -> pd.DataFrame:
-        THREADS = ["UNPACK", "MATH", "PACK"]
-
         # Parse each thread and append to the DataFrame
         threads = [
             parsed_thread
-            for thread, buffer in zip(THREADS, buffers)
+            for thread, buffer in zip(get_profiler_layout().threads, buffers)
             for parsed_thread in Profiler._parse_thread(thread, buffer, profiler_meta)
         ]
 
@@ -322,12 +588,26 @@ class Profiler:
         rows = []
         zone_stack = []
 
+        # Entries only carry the delta from the previous one, SYNC entries restore the full value
+        timestamp = 0
+
         word_stream = iter(words)
         for word in word_stream:
             if not (word & Profiler.ENTRY_EXISTS_BIT):
                 break
 
             type = (word & Profiler.ENTRY_TYPE_MASK) >> Profiler.ENTRY_TYPE_SHAMT
+            entry_type = Profiler.EntryType(type)
+
+            if entry_type == Profiler.EntryType.SYNC:
+                timestamp_high = word & Profiler.SYNC_HIGH_MASK
+                timestamp_low = next(word_stream) | (
+                    (word & Profiler.SYNC_LOW_MSB_BIT) << Profiler.SYNC_LOW_MSB_SHAMT
+                )
+                timestamp = (timestamp_high << 32) | timestamp_low
+                continue
+
+            timestamp += word & Profiler.ENTRY_DELTA_MASK
             marker_id = (word & Profiler.ENTRY_ID_MASK) >> Profiler.ENTRY_ID_SHAMT
 
             try:
@@ -337,11 +617,6 @@ class Profiler:
                     f"Marker with ID {marker_id} not found in profiler metadata"
                 )
 
-            timestamp_high = word & Profiler.ENTRY_TIME_HIGH_MASK
-            timestamp_low = next(word_stream)
-            timestamp = (timestamp_high << 32) | timestamp_low
-
-            entry_type = Profiler.EntryType(type)
             match entry_type:
                 case Profiler.EntryType.TIMESTAMP:
                     rows.append(
@@ -0,0 +1,201 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Roofline model for the perf tests.
+
+A perf test declares the work of its measured zone (FLOPs and the L1 bytes the
+unpackers read and the packer writes) with the helpers below. Combined with the
+per-arch peaks this gives the ideal cycle count of each unit, the unit that bounds
+the kernel and how close the measured zone time is to it. update_report adds the
+result to the PerfReport next to the raw cycle statistics.
+
+Peaks are per Tensix core figures in units of one clock cycle, see ARCH_PEAKS for the
+source of each:
+- FPU: MVMUL computes D[8,16] += B[8,16] * A[16,16] per cycle and fidelity phase,
+  ELWADD/ELWSUB process 8x16 datums per cycle, ELWMUL per cycle and fidelity phase,
+  GAPOOL/GMPOOL reduce a 16x16 face.
+- Unpack: both unpackers together, pack: the packers together.
+"""
+
+from dataclasses import dataclass
+from enum import Enum
+
+import pandas as pd
+
+from .chip_architecture import ChipArchitecture, get_chip_architecture
+from .llk_params import MathFidelity, MathOperation
+
+TILE_ELEMENTS = 1024
+TILE_DIM = 32
+
+
+class FpuPipe(Enum):
+    MATMUL = "matmul"
+    ELTWISE = "eltwise"
+    REDUCE = "reduce"
+
+
+@dataclass(frozen=True)
+class ArchPeaks:
+    flops_per_cycle: dict[FpuPipe, int]
+    unpack_bytes_per_cycle: int
+    pack_bytes_per_cycle: int
+
+
+# FPU datapath of the Wormhole and Blackhole Tensix, one instruction per cycle (Tensix ISA documentation
+# of MVMUL, ELWADD and GAPOOL). The matmul peak is what the LoFi (FP8) TFLOPS of the cards work out to:
+# Blackhole p150: 774 TFLOPS / (140 cores * 1.35 GHz) = 4096 FLOPs per cycle, the full 8x16x16 MVMUL.
+# Wormhole n150: 262 TFLOPS / (72 cores * 1 GHz) = 3640 FLOPs per cycle, below the MVMUL geometry.
+_WORMHOLE_FPU_PEAKS = {
+    FpuPipe.MATMUL: 3640,
+    FpuPipe.ELTWISE: 8 * 16,
+    FpuPipe.REDUCE: 16 * 16,
+}
+
+_BLACKHOLE_FPU_PEAKS = {
+    FpuPipe.MATMUL: 2 * 8 * 16 * 16,
+    FpuPipe.ELTWISE: 8 * 16,
+    FpuPipe.REDUCE: 16 * 16,
+}
+
+# There is no published per-core L1 bandwidth of the unpackers and packers. 128B (unpack) and
+# 64B (pack) per cycle are the nominal L1 port widths used so far, the perf tests of the
+# UNPACK_ISOLATE and PACK_ISOLATE run types measure the real ones. Quasar has no published
+# figures at all and takes the Blackhole ones.
+ARCH_PEAKS = {
+    ChipArchitecture.WORMHOLE: ArchPeaks(_WORMHOLE_FPU_PEAKS, 128, 64),
+    ChipArchitecture.BLACKHOLE: ArchPeaks(_BLACKHOLE_FPU_PEAKS, 128, 64),
+    ChipArchitecture.QUASAR: ArchPeaks(_BLACKHOLE_FPU_PEAKS, 128, 64),
+}
+
+BOUNDS = ("compute", "unpack", "pack")
+
+ROOFLINE_COLUMNS = ("flops", "intensity", "ideal_cycles", "bound")
+
+# Run types that time a single unit, measured against that unit's ideal instead of the bound
+RUN_TYPE_UNITS = {
+    "UNPACK_ISOLATE": "unpack",
+    "MATH_ISOLATE": "compute",
+    "PACK_ISOLATE": "pack",
+    "L1_CONGESTION[UNPACK]": "unpack",
+    "L1_CONGESTION[PACK]": "pack",
+}
+
+
+@dataclass(frozen=True)
+class KernelWork:
+    """Work done by one perf zone, summed over its whole loop"""
+
+    flops: int
+    unpack_bytes: int
+    pack_bytes: int
+    fpu: FpuPipe = FpuPipe.ELTWISE
+    fidelity_phases: int = 1
+
+    def ideal_cycles(self, peaks: ArchPeaks) -> dict[str, float]:
+        fpu_flops = self.flops * self.fidelity_phases
+        return {
+            "compute": fpu_flops / peaks.flops_per_cycle[self.fpu],
+            "unpack": self.unpack_bytes / peaks.unpack_bytes_per_cycle,
+            "pack": self.pack_bytes / peaks.pack_bytes_per_cycle,
+        }
+
+    @property
+    def intensity(self) -> float:
+        """FLOPs per byte of L1 traffic"""
+        traffic = self.unpack_bytes + self.pack_bytes
+        return self.flops / traffic if traffic else float("inf")
+
+
+def _fidelity_phases(math_fidelity: MathFidelity | None) -> int:
+    return math_fidelity.value + 1 if math_fidelity is not None else 1
+
+
+def matmul_work(
+    formats,
+    rt_dim: int,
+    ct_dim: int,
+    kt_dim: int,
+    loop_factor: int = 1,
+    math_fidelity: MathFidelity | None = None,
+) -> KernelWork:
+    """[rt_dim, kt_dim] x [kt_dim, ct_dim] tiles, every input tile is unpacked once per loop"""
+    tile_in = formats.input_format.num_bytes_per_tile(TILE_ELEMENTS)
+    tile_out = formats.output_format.num_bytes_per_tile(TILE_ELEMENTS)
+    return KernelWork(
+        flops=loop_factor * 2 * rt_dim * ct_dim * kt_dim * TILE_DIM**3,
+        unpack_bytes=loop_factor * kt_dim * (rt_dim + ct_dim) * tile_in,
+        pack_bytes=loop_factor * rt_dim * ct_dim * tile_out,
+        fpu=FpuPipe.MATMUL,
+        fidelity_phases=_fidelity_phases(math_fidelity),
+    )
+
+
+def eltwise_work(
+    formats,
+    tile_cnt: int,
+    operands: int = 2,
+    loop_factor: int = 1,
+    math_fidelity: MathFidelity | None = None,
+    mathop: MathOperation | None = None,
+) -> KernelWork:
+    """
+    One FLOP per output datum, operands input tiles per output tile.
+    Only ELWMUL repeats per fidelity phase, ELWADD/ELWSUB take one pass whatever the fidelity.
+    """
+    tile_in = formats.input_format.num_bytes_per_tile(TILE_ELEMENTS)
+    tile_out = formats.output_format.num_bytes_per_tile(TILE_ELEMENTS)
+    return KernelWork(
+        flops=loop_factor * tile_cnt * TILE_ELEMENTS,
+        unpack_bytes=loop_factor * tile_cnt * operands * tile_in,
+        pack_bytes=loop_factor * tile_cnt * tile_out,
+        fpu=FpuPipe.ELTWISE,
+        fidelity_phases=(
+            _fidelity_phases(math_fidelity) if mathop == MathOperation.Elwmul else 1
+        ),
+    )
+
+
+def reduce_work(formats, tile_cnt: int, loop_factor: int = 1) -> KernelWork:
+    """One FLOP per input datum, the scaler tile is unpacked once and not counted"""
+    tile_in = formats.input_format.num_bytes_per_tile(TILE_ELEMENTS)
+    tile_out = formats.output_format.num_bytes_per_tile(TILE_ELEMENTS)
+    return KernelWork(
+        flops=loop_factor * tile_cnt * TILE_ELEMENTS,
+        unpack_bytes=loop_factor * tile_cnt * tile_in,
+        pack_bytes=loop_factor * tile_cnt * tile_out,
+        fpu=FpuPipe.REDUCE,
+    )
+
+
+def roofline(
+    results: pd.DataFrame,
+    work: KernelWork,
+    marker: str = "TILE_LOOP",
+    peaks: ArchPeaks | None = None,
+) -> pd.DataFrame:
+    """
+    Adds roofline columns to the rows of `marker`:
+    flops, intensity, ideal_cycles, bound and peak%(RUN_TYPE) for every mean(RUN_TYPE),
+    the ideal cycle count as a percentage of the measured one. Run types that isolate a
+    unit are compared with the ideal of that unit, the others with the bound.
+    """
+    peaks = peaks or ARCH_PEAKS[get_chip_architecture()]
+    ideal = work.ideal_cycles(peaks)
+    bound = max(BOUNDS, key=ideal.get)
+
+    results = results.copy()
+    rows = results["marker"] == marker
+
+    results["flops"] = pd.Series(work.flops, index=results.index).where(rows)
+    results["intensity"] = pd.Series(work.intensity, index=results.index).where(rows)
+    results["ideal_cycles"] = pd.Series(ideal[bound], index=results.index).where(rows)
+    results["bound"] = pd.Series(bound, index=results.index).where(rows)
+
+    for column in [c for c in results.columns if c.startswith("mean(")]:
+        run_type = column[len("mean(") : -1]
+        unit_ideal = ideal[RUN_TYPE_UNITS.get(run_type, bound)]
+        results[f"peak%({run_type})"] = (100 * unit_ideal / results[column]).where(rows)
+
+    return results
@@ -14,7 +14,12 @@ class TestTargetConfig:
         return cls._instance
 
     def __init__(
-        self, run_simulator=False, simulator_port=5555, device_id=0, log_level="INFO"
+        self,
+        run_simulator=False,
+        simulator_port=5555,
+        device_id=0,
+        log_level="INFO",
+        resident=False,
     ):
         """
             Initializes the test configuration in regards to using the simulator.
@@ -23,6 +28,7 @@ class TestTargetConfig:
             simulator_port (int): Simulator server port number
             device_id (int): ID number of the device to send message to.
             log_level (str): Log level
+            resident (bool): True if the TRISCs stay booted in a dispatch loop between tests
         """
         # Only initialize once
         if not TestTargetConfig._initialized:
@@ -30,12 +36,14 @@ class TestTargetConfig:
             self.simulator_port: int = simulator_port
             self.device_id: int = device_id
             self.log_level: str = log_level
+            self.resident: bool = resident
             TestTargetConfig._initialized = True
 
     def update_from_pytest_config(self, config):
-        """Update only the simulator related settings from pytest config"""
+        """Update only the simulator and resident mode settings from pytest config"""
         self.run_simulator = config.getoption("--run_simulator", default=False)
         self.simulator_port = config.getoption("--port", default=5555)
+        self.resident = config.getoption("--resident", default=False)
 
 
 def initialize_test_target_from_pytest(config):
@@ -2,6 +2,7 @@
 # SPDX-License-Identifier: Apache-2.0
 
 import os
+import struct
 from enum import Enum
 from pathlib import Path
 
@@ -9,11 +10,14 @@ from .chip_architecture import get_chip_architecture
 from .data_format_inference import data_formats, is_format_combination_outlier
 from .device import (
     BootMode,
+    ResidentDispatcher,
     resolve_default_boot_mode,
     run_elf_files,
+    run_resident,
     wait_for_tensix_operations_finished,
 )
 from .format_config import DataFormat, FormatConfig
+from .l1_layout import ARENA_START, L1Arena
 from .llk_params import (
     FPU_BINARY_OPERATIONS,
     REDUCE_OPERATIONS,
@@ -25,14 +29,27 @@ from .llk_params import (
     ImpliedMathFormat,
     MathFidelity,
     MathOperation,
+    RopeAngles,
     StochasticRounding,
     Tilize,
     Transpose,
+    TriscLayoutOperation,
     format_tile_sizes,
 )
 from .matmul_sweep import validate_tile_dimensions
+from .profiler import get_profiler_layout
+from .target_config import TestTargetConfig
 from .utils import run_shell_command
 
+# Raw container of one datum for the TRISC data movement kernels, which do not look at the values
+TRISC_LAYOUT_CONTAINERS = {
+    DataFormat.Float16: "std::uint16_t",
+    DataFormat.Float16_b: "std::uint16_t",
+    DataFormat.Float32: "std::uint32_t",
+    DataFormat.Int32: "std::int32_t",
+    DataFormat.Int8: "std::int8_t",
+}
+
 
 class ProfilerBuild(Enum):
     Yes = "true"
@@ -171,6 +188,15 @@ def generate_build_header(test_config):
         acc_to_dest = str(test_config["acc_to_dest"]).lower()
         header_content.append(f"constexpr bool ACC_TO_DEST = {acc_to_dest};")
 
+    # Keep reduce partials in fp32 Dest across the whole strip
+    if "enforce_fp32_accumulation" in test_config:
+        enforce_fp32_accumulation = str(
+            test_config["enforce_fp32_accumulation"]
+        ).lower()
+        header_content.append(
+            f"constexpr bool ENFORCE_FP32_ACCUMULATION = {enforce_fp32_accumulation};"
+        )
+
     # Reuse destination type
     if "reuse_dest" in test_config:
         reuse_dest = test_config["reuse_dest"]
@@ -435,10 +461,13 @@ def generate_build_header(test_config):
     header_content.append(f"constexpr int TILE_CNT = {tile_cnt};")
 
     # Unpack + result buffer addresses arrays generations
-    buffer_A_address = test_config.get("buffer_A_address", 0x1A000)
-    buffer_B_address = test_config.get("buffer_B_address", 0x1B000)
+    # Defaults for tests that do not place stimuli, one 4KB slot each at the start of the L1 arena
+    buffer_A_address = test_config.get("buffer_A_address", ARENA_START)
+    buffer_B_address = test_config.get("buffer_B_address", ARENA_START + 0x1000)
     buffer_C_address = test_config.get("buffer_C_address", None)
-    result_buffer_address = test_config.get("result_buffer_address", 0x1C000)
+    result_buffer_address = test_config.get(
+        "result_buffer_address", ARENA_START + 0x2000
+    )
 
     # Generate buffer declarations with optional buffer_C
     buffer_A_line = f"constexpr Operand buffer_A({hex(buffer_A_address)}, {format_tile_sizes[formats.input_format if formats is not None else DataFormat.Float16_b]});"
@@ -486,6 +515,173 @@ def generate_build_header(test_config):
         header_content.append(f"constexpr uint32_t CT_DIM = {test_config['ct_dim']};")
     if "kt_dim" in test_config:
         header_content.append(f"constexpr uint32_t KT_DIM = {test_config['kt_dim']};")
+    # Runtime shape table of the Quasar matmul, written to L1 by the test
+    if "matmul_shapes_address" in test_config:
+        header_content.append(
+            f"constexpr uint32_t MATMUL_SHAPES_ADDRESS = {hex(test_config['matmul_shapes_address'])};"
+        )
+    if "unit_dim" in test_config:
+        header_content.append(
+            f"constexpr uint32_t UNIT_DIM = {test_config['unit_dim']};"
+        )
+
+    # SFPU typecast source/target formats and rounding mode, typecast_output names a target packed from its Dest container
+    typecast_rounding = test_config.get("typecast_rounding", None)
+    if typecast_rounding is not None:
+        header_content.extend(
+            [
+                '#include "sfpu/ckernel_sfpu_typecast.h"',
+                f"constexpr auto TYPECAST_IN = ckernel::sfpu::TypecastFormat::{formats.input_format};",
+                f"constexpr auto TYPECAST_OUT = ckernel::sfpu::TypecastFormat::{test_config.get('typecast_output', formats.output_format)};",
+                f"constexpr auto TYPECAST_ROUNDING = ckernel::sfpu::{typecast_rounding.value};",
+            ]
+        )
+
+    # RoPE pairing of the head elements and source of the angles
+    rope_layout = test_config.get("rope_layout", None)
+    if rope_layout is not None:
+        rope_angles = test_config.get("rope_angles", RopeAngles.Precomputed)
+        header_content.extend(
+            [
+                '#include "sfpu/ckernel_sfpu_rope.h"',
+                f"constexpr auto ROPE_LAYOUT = ckernel::sfpu::{rope_layout.value};",
+                f"constexpr auto ROPE_ANGLES = ckernel::sfpu::{rope_angles.value};",
+            ]
+        )
+
+    # Row gather/scatter: operation, index width and the Dest tiles on either side
+    gather_operation = test_config.get("gather_operation", None)
+    if gather_operation is not None:
+        index_bits = (
+            16 if test_config["gather_index_format"] == DataFormat.UInt16 else 32
+        )
+        header_content.extend(
+            [
+                f"constexpr auto GATHER_OPERATION = SfpuType::{gather_operation.value};",
+                f"using GatherIndex = std::uint{index_bits}_t;",
+                f"constexpr uint32_t GATHER_SRC_TILES = {test_config['gather_src_tiles']};",
+                f"constexpr uint32_t GATHER_DST_TILES = {test_config['gather_dst_tiles']};",
+            ]
+        )
+
+    # TRISC data movement of ckernel_trisc_layout.h: operation and the element containers on either side
+    trisc_layout = test_config.get("trisc_layout", None)
+    if trisc_layout is not None:
+        operations = ", ".join(operation.value for operation in TriscLayoutOperation)
+        header_content.extend(
+            [
+                f"enum class TriscLayoutOperation {{ {operations} }};",
+                f"constexpr auto TRISC_LAYOUT = TriscLayoutOperation::{trisc_layout.value};",
+                f"using LayoutSrc = {TRISC_LAYOUT_CONTAINERS[formats.input_format]};",
+                f"using LayoutDst = {TRISC_LAYOUT_CONTAINERS[formats.output_format]};",
+            ]
+        )
+
+    # argmax/argmin: operation, tie-break and index format, over ARG_REDUCE_TILES tiles in two chunks
+    arg_reduce_operation = test_config.get("arg_reduce_operation", None)
+    if arg_reduce_operation is not None:
+        header_content.extend(
+            [
+                '#include "sfpu/ckernel_sfpu_arg_reduce.h"',
+                f"constexpr auto ARG_REDUCE_OPERATION = SfpuType::{arg_reduce_operation.value};",
+                f"constexpr auto ARG_TIE_BREAK = ckernel::sfpu::{test_config['arg_tie_break'].value};",
+                f"constexpr auto ARG_INDEX_FORMAT = ckernel::sfpu::ArgIndexFormat::{formats.output_format};",
+                f"constexpr uint32_t ARG_REDUCE_TILES = {test_config['arg_reduce_tiles']};",
+            ]
+        )
+
+    # k x k pooling: one window per output position over POOL_WINDOW_TILES Dest tiles, scaled by 1 / divisor
+    pool_window_size = test_config.get("pool_window_size", None)
+    if pool_window_size is not None:
+        scales = ", ".join(
+            f"0x{struct.unpack('<I', struct.pack('<f', 1.0 / divisor))[0]:08X}"
+            for divisor in test_config["pool_divisors"]
+        )
+        header_content.extend(
+            [
+                f"constexpr auto POOL_TYPE = ckernel::PoolType::{test_config['pool_type'].value};",
+                f"constexpr uint32_t POOL_WINDOW_SIZE = {pool_window_size};",
+                f"constexpr uint32_t POOL_WINDOW_TILES = {test_config['pool_window_tiles']};",
+                f"constexpr uint32_t POOL_OUTPUTS = {len(test_config['pool_divisors'])};",
+                f"constexpr uint32_t POOL_SCALES[POOL_OUTPUTS] = {{{scales}}};",
+            ]
+        )
+        # Max pooling reads and writes its indices tiles in an integer format of their own
+        pool_index_format = test_config["pool_index_format"]
+        header_content.extend(
+            [
+                f"constexpr auto POOL_INDEX_FORMAT = static_cast<std::underlying_type_t<DataFormat>>(DataFormat::{pool_index_format.name});",
+                f"constexpr uint32_t POOL_INDEX_TILE_SIZE = {format_tile_sizes[pool_index_format] // 16};",
+            ]
+        )
+
+    # Order of adding up the tiles of a multi-tile reduction
+    reduce_summation = test_config.get("reduce_summation", None)
+    if reduce_summation is not None:
+        header_content.append(
+            f"constexpr auto REDUCE_SUMMATION = ckernel::{reduce_summation.value};"
+        )
+
+    # Broadcast second operand of an SFPU binary op: a scalar's bits, or a row or column of the in1 tile.
+    # The op is SFPU_BINARY_OPERATION, or the SfpuType of a comparison or bitwise op.
+    binary_broadcast = test_config.get("binary_broadcast", None)
+    if binary_broadcast is not None:
+        bcast_sfpu_type = test_config.get("binary_bcast_sfpu_type", None)
+        bcast_operation = (
+            f"SfpuType::{bcast_sfpu_type.value}"
+            if bcast_sfpu_type is not None
+            else "SFPU_BINARY_OPERATION"
+        )
+        header_content.extend(
+            [
+                f"constexpr auto SFPU_BINARY_BROADCAST = ckernel::{binary_broadcast.value};",
+                f"constexpr auto SFPU_BINARY_BCAST_OPERATION = {bcast_operation};",
+                f"constexpr uint32_t BROADCAST_ROW = {test_config['broadcast_row']};",
+                f"constexpr uint32_t BROADCAST_COLUMN = {test_config['broadcast_column']};",
+                f"constexpr uint32_t BROADCAST_SCALAR = 0x{test_config['broadcast_scalar']:08X};",
+            ]
+        )
+
+    # Linear recurrence over SCAN_TILES time tiles, starting from the state SCAN_INITIAL_STATE in fp32 bits
+    scan_tiles = test_config.get("scan_tiles", None)
+    if scan_tiles is not None:
+        initial_state = struct.unpack(
+            "<I", struct.pack("<f", test_config["scan_initial_state"])
+        )[0]
+        header_content.extend(
+            [
+                f"constexpr uint32_t SCAN_TILES = {scan_tiles};",
+                f"constexpr bool SCAN_WITH_B = {str(test_config['scan_with_b']).lower()};",
+                f"constexpr uint32_t SCAN_INITIAL_STATE = 0x{initial_state:08X};",
+            ]
+        )
+
+    # Integer divmod: signedness from the input format, and the scalar divisor's bits unless dividing by a tile
+    int_div_rounding = test_config.get("int_div_rounding", None)
+    if int_div_rounding is not None:
+        int_div_divisor = test_config.get("int_div_divisor", None)
+        header_content.extend(
+            [
+                '#include "sfpu/ckernel_sfpu_div_int.h"',
+                f"constexpr bool DIV_INT_SIGNED = {str(formats.input_format == DataFormat.Int32).lower()};",
+                f"constexpr auto DIV_INT_ROUNDING = ckernel::sfpu::{int_div_rounding.value};",
+                f"constexpr bool DIV_INT_BY_SCALAR = {str(int_div_divisor is not None).lower()};",
+                f"constexpr uint32_t DIV_INT_DIVISOR = 0x{(int_div_divisor or 0) & 0xFFFFFFFF:08X};",
+            ]
+        )
+
+    # Piecewise activation table, a PiecewiseFit from helpers.piecewise
+    piecewise_table = test_config.get("piecewise_table", None)
+    if piecewise_table is not None:
+        header_content.extend(
+            [
+                '#include "sfpu/ckernel_sfpu_piecewise.h"',
+                "namespace ckernel::sfpu",
+                "{",
+                piecewise_table.declaration("PIECEWISE_TABLE"),
+                "} // namespace ckernel::sfpu",
+            ]
+        )
 
     header_content.append("")
 
@@ -494,16 +690,47 @@ def generate_build_header(test_config):
         header_content.append(
             f"constexpr auto PERF_RUN_TYPE = PerfRunType::{perf_run_type.name};"
         )
+        header_content.extend(generate_perf_buffers(test_config, formats))
 
     header_content.append("")
     return "\n".join(header_content)
 
 
+def generate_perf_buffers(test_config, formats) -> list[str]:
+    """
+    Perf kernels get their own buffers above any stimuli, each as large as the tile count of the run
+    (perf_buffer_tiles to override), so a pass over the tiles never aliases L1.
+    """
+    stimuli_arena = test_config.get("l1_arena")
+    arena = L1Arena(start=stimuli_arena.top if stimuli_arena else ARENA_START)
+
+    tile_count = test_config.get("perf_buffer_tiles", test_config.get("tile_cnt", 1))
+    perf_buffers = [
+        ("PERF_INPUT_A", formats.input_format),
+        ("PERF_INPUT_B", formats.input_format),
+        ("PERF_INPUT_C", formats.input_format),
+        ("PERF_OUTPUT", formats.output_format),
+    ]
+
+    lines = ["", "// Perf buffers placed by the L1 arena"]
+    for name, data_format in perf_buffers:
+        buffer = arena.allocate_tiles(name, data_format, tile_count)
+        lines.append(
+            f"constexpr PerfBuffer {name} = {{{hex(buffer.address)}, {buffer.tile_size}, {buffer.tile_count}}};"
+        )
+    return lines
+
+
 def write_build_header(test_config):
     header_content = generate_build_header(test_config)
     llk_home = Path(os.environ.get("LLK_HOME"))
-    with open(llk_home / "tests/helpers/include/build.h", "w") as f:
-        f.write(header_content)
+    build_header = llk_home / "tests/helpers/include/build.h"
+
+    # an unchanged header keeps make from rebuilding every kernel that includes it
+    if not build_header.exists() or build_header.read_text() != header_content:
+        build_header.write_text(header_content)
+
+    get_profiler_layout().write_header()
 
 
 def generate_make_command(
@@ -517,6 +744,9 @@ def generate_make_command(
     # Simplified make command - only basic build parameters
     make_cmd = f"make -j 6 --silent testname={test_config.get('testname')} bootmode={boot_mode.value} profiler_build={profiler_build.value} all "
 
+    if TestTargetConfig().resident:
+        make_cmd += "resident=true "
+
     if profiler_build == ProfilerBuild.Yes:
         make_cmd += "profiler "
 
@@ -544,8 +774,27 @@ def run_test(
 ):
     """Run the test with the given configuration"""
 
-    build_test(test_config, boot_mode, profiler_build)
+    if TestTargetConfig().resident:
+        image = resident_image(test_config, boot_mode, profiler_build)
+        if not ResidentDispatcher.is_booted(image):
+            build_test(test_config, boot_mode, profiler_build)
+        run_resident(test_config["testname"], image, boot_mode)
+    else:
+        build_test(test_config, boot_mode, profiler_build)
+        run_elf_files(test_config["testname"], boot_mode)
 
-    # run test
-    run_elf_files(test_config["testname"], boot_mode)
     wait_for_tensix_operations_finished()
+
+
+def resident_image(
+    test_config,
+    boot_mode: BootMode,
+    profiler_build: ProfilerBuild,
+):
+    """Identifies a build, tests with equal images run on the booted ELFs without rebuilding or reloading them"""
+    return (
+        test_config["testname"],
+        generate_build_header(test_config),
+        resolve_default_boot_mode(boot_mode),
+        profiler_build,
+    )
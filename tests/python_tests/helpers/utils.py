@@ -214,3 +214,38 @@ def passed_test(
         target_pcc = pow(0.99, L1_to_L1_iterations)
     print("PCC:", pcc)
     return is_within_tolerance and (pcc > target_pcc)
+
+
+# Relative error of a result rounded once to the output format, with margin for the fp32 math before it
+ROUNDING_RTOL = {DataFormat.Float16_b: 2.0**-7, DataFormat.Float32: 2.0**-20}
+ROUNDING_ATOL = 2.0**-20
+
+
+def assert_within_tolerance(
+    golden_tensor,
+    res_tensor,
+    output_data_format: DataFormat,
+    rtol: float | None = None,
+    atol=ROUNDING_ATOL,
+    inputs=None,
+):
+    """
+    Asserts |result - golden| <= rtol * |golden| + atol on every element, compared in float64.
+    rtol defaults to ROUNDING_RTOL of the output format, atol may be a tensor of per element bounds.
+    The message gives the number of mismatches, the largest difference and the first failing
+    elements, with their inputs when given.
+    """
+    if rtol is None:
+        rtol = ROUNDING_RTOL[output_data_format]
+
+    golden_tensor = golden_tensor.to(torch.float64)
+    res_tensor = res_tensor.to(torch.float64)
+    difference = (res_tensor - golden_tensor).abs()
+    mismatches = difference > rtol * golden_tensor.abs() + atol
+
+    first_inputs = "" if inputs is None else f"{inputs[mismatches][:8].tolist()} -> "
+    assert not torch.any(mismatches), (
+        f"{int(mismatches.sum())} mismatches, largest {difference.max().item()}, first: "
+        f"{first_inputs}{res_tensor[mismatches][:8].tolist()}, "
+        f"expected {golden_tensor[mismatches][:8].tolist()}"
+    )
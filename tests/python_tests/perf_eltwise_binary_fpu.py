@@ -6,6 +6,7 @@ from helpers.format_config import DataFormat
 from helpers.llk_params import DestAccumulation, MathFidelity, MathOperation
 from helpers.param_config import input_output_formats, parametrize
 from helpers.perf import ALL_RUN_TYPES, perf_benchmark, update_report
+from helpers.roofline import eltwise_work
 
 
 @pytest.mark.perf
@@ -41,5 +42,7 @@ def test_perf_eltwise_binary_fpu(
         "dest_acc": dest_acc,
     }
 
+    work = eltwise_work(formats, tile_count, math_fidelity=math_fidelity, mathop=mathop)
+
     results = perf_benchmark(test_config, ALL_RUN_TYPES)
-    update_report(perf_report, test_config, results)
+    update_report(perf_report, test_config, results, work)
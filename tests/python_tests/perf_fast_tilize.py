@@ -51,8 +51,15 @@ def generate_input_dimensions(max_size: int) -> list[tuple[int, int]]:
 )
 @pytest.mark.parametrize("fp32_dest", [DestAccumulation.Yes, DestAccumulation.No])
 @pytest.mark.parametrize("input_width, input_height", generate_input_dimensions(16))
+@pytest.mark.parametrize("unit_dim", [2, 4])
 def test_fast_tilize_perf(
-    perf_report, input_format, output_format, fp32_dest, input_width, input_height
+    perf_report,
+    input_format,
+    output_format,
+    fp32_dest,
+    input_width,
+    input_height,
+    unit_dim,
 ):
 
     input_dimensions = [input_height * 32, input_width * 32]
@@ -71,6 +78,7 @@ def test_fast_tilize_perf(
         "input_A_dimensions": input_dimensions,
         "input_B_dimensions": input_dimensions,
         "dest_acc": fp32_dest,
+        "unit_dim": unit_dim,
     }
 
     res_address = write_stimuli_to_l1(
@@ -84,4 +92,12 @@ def test_fast_tilize_perf(
     )
 
     results = perf_benchmark(test_config, [PerfRunType.L1_TO_L1], 2)
+
+    # throughput of the whole tile loop, makes widths and unit_dims directly comparable
+    tile_loop = results["marker"] == "TILE_LOOP"
+    loop_tiles = test_config["loop_factor"] * test_config["tile_cnt"]
+    results.loc[tile_loop, "tiles_per_cycle"] = (
+        loop_tiles / results.loc[tile_loop, f"mean({PerfRunType.L1_TO_L1.name})"]
+    )
+
     update_report(perf_report, test_config, results)
@@ -12,6 +12,7 @@ from helpers.matmul_sweep import (
 )
 from helpers.param_config import input_output_formats, parametrize
 from helpers.perf import PerfRunType, perf_benchmark, update_report
+from helpers.roofline import matmul_work
 
 # Important K dimensions to test
 KT_DIMS = [1, 2, 3, 4, 8, 64]
@@ -90,5 +91,14 @@ def test_perf_matmul(perf_report, test_name, combos, math_fidelity):
         "math_fidelity": math_fidelity,
     }
 
+    work = matmul_work(
+        formats,
+        dims.rt_dim,
+        dims.ct_dim,
+        dims.kt_dim,
+        loop_factor=test_config["loop_factor"],
+        math_fidelity=math_fidelity,
+    )
+
     results = perf_benchmark(test_config, run_types)
-    update_report(perf_report, test_config, results)
+    update_report(perf_report, test_config, results, work)
@@ -18,6 +18,7 @@ from helpers.perf import (
     perf_benchmark,
     update_report,
 )
+from helpers.roofline import reduce_work
 
 REDUCE_MATHOP = {
     ReduceDimension.Row: MathOperation.ReduceRow,
@@ -56,4 +57,4 @@ def test_perf_reduce(
     }
 
     results = perf_benchmark(test_config, ALL_RUN_TYPES)
-    update_report(perf_report, test_config, results)
+    update_report(perf_report, test_config, results, reduce_work(formats, tile_count))
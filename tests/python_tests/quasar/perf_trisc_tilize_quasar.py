@@ -0,0 +1,37 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+from conftest import skip_for_blackhole, skip_for_wormhole
+from helpers.format_config import DataFormat
+from helpers.param_config import input_output_formats, parametrize
+from helpers.perf import PerfRunType, perf_benchmark, update_report
+
+
+# TRISC_TILIZE (scalar data movement on the unpack TRISC) against UNPACK_TILIZE (fused unpacker tilize),
+# timing only: test_trisc_layout_quasar checks _trisc_tilize_ against the golden
+@skip_for_blackhole
+@skip_for_wormhole
+@pytest.mark.perf
+@parametrize(
+    test_name="trisc_tilize_quasar_perf",
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    ct_dim=[1, 2, 4, 8],
+)
+def test_perf_trisc_tilize_quasar(perf_report, test_name, formats, ct_dim):
+    dimensions = [32, ct_dim * 32]
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "loop_factor": 4,
+        "tile_cnt": ct_dim,
+        "input_A_dimensions": dimensions,
+        "input_B_dimensions": dimensions,
+    }
+
+    results = perf_benchmark(test_config, [PerfRunType.UNPACK_ISOLATE])
+    update_report(perf_report, test_config, results)
@@ -6,6 +6,7 @@ import pytest
 import torch
 from conftest import skip_for_blackhole, skip_for_wormhole
 from helpers.device import BootMode, collect_results, write_stimuli_to_l1
+from ttexalens.tt_exalens_lib import write_words_to_device
 from helpers.format_config import DataFormat
 from helpers.golden_generators import (
     MatmulGolden,
@@ -30,6 +31,7 @@ from helpers.tilize_untilize import tilize_block
 from helpers.utils import passed_test
 
 TILE_DIM = 32  # Standard tile dimension for row and column
+ELEMENTS_PER_TILE = TILE_DIM * TILE_DIM
 MAX_TILES_32_BIT_DEST = 4
 kt_dims = [1, 2, 4]
 matmul_dimensions_32_bit_dest = [
@@ -62,12 +64,28 @@ MATMUL_FORMAT = input_output_formats(
     ],
     same=True,
 )
-DEST_ACC_MODES = [DestAccumulation.No, DestAccumulation.Yes]
 IMPLIED_MATH_FORMAT = [ImpliedMathFormat.No, ImpliedMathFormat.Yes]
-DEST_SYNC_MODES = [DestSync.Half, DestSync.Full]
 TRANSPOSE_MODES = [Transpose.No]
 
 
+def shape_groups(dimensions, size):
+    """Consecutive shapes of one dest accumulation mode, run back to back by one ELF"""
+    return [dimensions[i : i + size] for i in range(0, len(dimensions), size)]
+
+
+# The kernel reads the shapes from a table in L1. Under SyncHalf pack flips the dest bank after
+# every section and the math side of this kernel does not follow, so SyncHalf runs one shape per ELF.
+SHAPES_PER_RUN = 4
+DEST_SYNC_SHAPES = [
+    (DestSync.Full, group)
+    for dimensions in (matmul_dimensions_32_bit_dest, matmul_dimensions_16_bit_dest)
+    for group in shape_groups(dimensions, SHAPES_PER_RUN)
+] + [
+    (DestSync.Half, [shape])
+    for shape in matmul_dimensions_32_bit_dest + matmul_dimensions_16_bit_dest
+]
+
+
 @skip_for_blackhole
 @skip_for_wormhole
 @parametrize(
@@ -79,22 +97,21 @@ TRANSPOSE_MODES = [Transpose.No]
         MathFidelity.HiFi3,
         MathFidelity.HiFi4,
     ],
-    dimensions_dest_acc=matmul_dimensions_32_bit_dest + matmul_dimensions_16_bit_dest,
+    dest_sync_shapes=DEST_SYNC_SHAPES,
     format=MATMUL_FORMAT,
-    dest_sync_mode=DEST_SYNC_MODES,
     transpose=TRANSPOSE_MODES,
 )
 # Note: this test is used to test boot modes, that is why it has them piped as default arguments to the test itself
 def test_matmul(
     test_name,
     math_fidelity,
-    dimensions_dest_acc,
+    dest_sync_shapes,
     format,
     implied_math_format,
-    dest_sync_mode,
     transpose,
 ):
-    input_A_dimensions, input_B_dimensions, dest_acc = dimensions_dest_acc
+    dest_sync_mode, shapes = dest_sync_shapes
+    dest_acc = shapes[0][2]
 
     if (format.input_format, dest_acc) == (DataFormat.Float16, DestAccumulation.Yes):
         pytest.skip(
@@ -102,95 +119,112 @@ def test_matmul(
         )
 
     torch_format = format_dict[format.output_format]
+    generate_golden = get_golden_generator(MatmulGolden)
 
-    src_A, _, tile_cnt_A = generate_stimuli(
-        format.input_format,
-        format.input_format,
-        input_dimensions=input_A_dimensions,
-        sfpu=False,
-    )
-    src_B, _, tile_cnt_B = generate_stimuli(
-        format.input_format,
-        format.input_format,
-        input_dimensions=input_B_dimensions,
-        sfpu=False,
-    )
-
-    src_B_golden = src_B
-    if transpose == Transpose.Yes:
-        t_matrix = get_golden_generator(TransposeGolden)
-
-        src_B_golden = t_matrix.transpose_faces_multi_tile(
-            src_B,
+    # Every shape gets its own tiles, one after the other in each buffer
+    tilized_A, tilized_B, goldens, shape_table = [], [], [], []
+    for input_A_dimensions, input_B_dimensions, _ in shapes:
+        src_A, _, tile_cnt_A = generate_stimuli(
             format.input_format,
-            num_tiles=tile_cnt_B,
-            tilize=True,
-            input_dimensions=input_B_dimensions,
+            format.input_format,
+            input_dimensions=input_A_dimensions,
+            sfpu=False,
         )
-        src_B_golden = t_matrix.transpose_within_faces_multi_tile(
-            src_B_golden,
+        src_B, _, tile_cnt_B = generate_stimuli(
+            format.input_format,
             format.input_format,
-            num_tiles=tile_cnt_B,
-            untilize=True,
             input_dimensions=input_B_dimensions,
+            sfpu=False,
         )
 
-    # Calculate all matmul dimensions using helper function
-    matmul_dims = generate_tile_dims((input_A_dimensions, input_B_dimensions))
+        src_B_golden = src_B
+        if transpose == Transpose.Yes:
+            t_matrix = get_golden_generator(TransposeGolden)
+
+            src_B_golden = t_matrix.transpose_faces_multi_tile(
+                src_B,
+                format.input_format,
+                num_tiles=tile_cnt_B,
+                tilize=True,
+                input_dimensions=input_B_dimensions,
+            )
+            src_B_golden = t_matrix.transpose_within_faces_multi_tile(
+                src_B_golden,
+                format.input_format,
+                num_tiles=tile_cnt_B,
+                untilize=True,
+                input_dimensions=input_B_dimensions,
+            )
+
+        # Calculate all matmul dimensions using helper function
+        matmul_dims = generate_tile_dims((input_A_dimensions, input_B_dimensions))
+        shape_table += [matmul_dims.ct_dim, matmul_dims.rt_dim, matmul_dims.kt_dim]
+
+        goldens.append(
+            generate_golden(
+                src_A,
+                src_B_golden,
+                format.output_format,
+                math_fidelity,
+                input_A_dimensions=input_A_dimensions,
+                input_B_dimensions=input_B_dimensions,
+                tilize=True,  # Golden cannot model FPU strided for tilized data computation, so we tilize output after computation
+            )
+        )
+        tilized_A.append(
+            tilize_block(
+                src_A, dimensions=input_A_dimensions, stimuli_format=format.input_format
+            ).flatten()
+        )
+        tilized_B.append(
+            tilize_block(
+                src_B, dimensions=input_B_dimensions, stimuli_format=format.input_format
+            ).flatten()
+        )
 
-    generate_golden = get_golden_generator(MatmulGolden)
-    golden_tensor = generate_golden(
-        src_A,
-        src_B_golden,
-        format.output_format,
-        math_fidelity,
-        input_A_dimensions=input_A_dimensions,
-        input_B_dimensions=input_B_dimensions,
-        tilize=True,  # Golden cannot model FPU strided for tilized data computation, so we tilize output after computation
-    )
-
-    tilized_A = tilize_block(
-        src_A, dimensions=input_A_dimensions, stimuli_format=format.input_format
-    )
-    tilized_B = tilize_block(
-        src_B, dimensions=input_B_dimensions, stimuli_format=format.input_format
-    )
+    tile_cnt_A = sum(len(tiles) for tiles in tilized_A) // ELEMENTS_PER_TILE
+    tile_cnt_B = sum(len(tiles) for tiles in tilized_B) // ELEMENTS_PER_TILE
+    tile_cnt_res = sum(len(golden) for golden in goldens) // ELEMENTS_PER_TILE
 
     test_config = {
         "formats": format,
         "testname": test_name,
         "dest_acc": dest_acc,
         "math_fidelity": math_fidelity,
-        "tile_cnt": matmul_dims.output_tile_cnt,
-        "input_A_dimensions": input_A_dimensions,
-        "input_B_dimensions": input_B_dimensions,
-        "output_dimensions": matmul_dims.output_dimensions,
-        "rt_dim": matmul_dims.rt_dim,
-        "ct_dim": matmul_dims.ct_dim,
-        "kt_dim": matmul_dims.kt_dim,
+        "tile_cnt": tile_cnt_res,
         "implied_math_format": implied_math_format,
-        "dest_sync_mode": dest_sync_mode,
+        "dest_sync": dest_sync_mode,
         "unpack_transpose_faces": transpose,
     }
 
     # Use the new helper function for writing stimuli
     res_address = write_stimuli_to_l1(
         test_config,
-        tilized_A.flatten(),
-        tilized_B.flatten(),
+        torch.cat(tilized_A),
+        torch.cat(tilized_B),
         format.input_format,
         format.input_format,
         tile_cnt_A,
         tile_cnt_B,
+        tile_count_res=tile_cnt_res,
     )
 
-    run_test(test_config, BootMode.TRISC)
-
-    res_from_L1 = collect_results(
-        format, tile_count=matmul_dims.output_tile_cnt, address=res_address
+    # Shape table after the stimuli: count, then ct, rt, kt of every shape
+    table = test_config["l1_arena"].allocate(
+        "matmul_shapes", 4 * (1 + len(shape_table))
     )
-    assert len(res_from_L1) == len(golden_tensor)
+    write_words_to_device("0,0", table.address, [len(shapes), *shape_table])
+    test_config["matmul_shapes_address"] = table.address
 
-    res_tensor = torch.tensor(res_from_L1, dtype=torch_format)
+    run_test(test_config, BootMode.TRISC)
 
-    assert passed_test(golden_tensor, res_tensor, format.output_format)
+    res_from_L1 = collect_results(format, tile_count=tile_cnt_res, address=res_address)
+    res_tensor = torch.tensor(res_from_L1, dtype=torch_format)
+    assert len(res_tensor) == sum(len(golden) for golden in goldens)
+
+    for (input_A_dimensions, input_B_dimensions, _), golden_tensor, res_shape in zip(
+        shapes, goldens, res_tensor.split([len(golden) for golden in goldens])
+    ):
+        assert passed_test(
+            golden_tensor, res_shape, format.output_format
+        ), f"A{input_A_dimensions} x B{input_B_dimensions} differs from the golden"
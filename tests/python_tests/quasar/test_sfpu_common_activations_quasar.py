@@ -0,0 +1,111 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from conftest import skip_for_blackhole, skip_for_wormhole
+from helpers.device import BootMode, collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat
+from helpers.golden_generators import UnarySFPUGolden, get_golden_generator
+from helpers.llk_params import (
+    DestAccumulation,
+    ImpliedMathFormat,
+    MathOperation,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import run_test
+from helpers.utils import passed_test
+
+# Every kernel of tt_llk_common/sfpu, activations and nonlinear
+COMMON_ACTIVATIONS = [
+    MathOperation.Abs,
+    MathOperation.Neg,
+    MathOperation.Square,
+    MathOperation.Hardtanh,
+    MathOperation.Hardsigmoid,
+    MathOperation.Hardswish,
+    MathOperation.Threshold,
+    MathOperation.Sign,
+    MathOperation.Fill,
+]
+COMMON_NONLINEAR = [
+    MathOperation.Sigmoid,
+    MathOperation.Silu,
+    MathOperation.Elu,
+    MathOperation.Celu,
+    MathOperation.Gelu,
+    MathOperation.Softsign,
+    MathOperation.Tanhshrink,
+    MathOperation.Rsqrt,
+]
+
+
+@skip_for_blackhole
+@skip_for_wormhole
+@parametrize(
+    test_name="sfpu_common_activations_quasar_test",
+    formats=input_output_formats(
+        [DataFormat.Float16, DataFormat.Float16_b, DataFormat.Float32], same=True
+    ),
+    mathop=COMMON_ACTIVATIONS + COMMON_NONLINEAR,
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    implied_math_format=[ImpliedMathFormat.No, ImpliedMathFormat.Yes],
+)
+def test_sfpu_common_activations_quasar(
+    test_name, formats, mathop, dest_acc, implied_math_format
+):
+    if (formats.input_format, dest_acc) in [
+        (DataFormat.Float16, DestAccumulation.Yes),
+        (DataFormat.Float32, DestAccumulation.No),
+    ]:
+        pytest.skip(
+            "Float16 with 32-bit dest or Float32 without 32-bit dest is not supported"
+        )
+
+    torch.manual_seed(0)
+    input_dimensions = [64, 64]
+
+    src_A, src_B, tile_cnt = generate_stimuli(
+        formats.input_format, formats.input_format, input_dimensions=input_dimensions
+    )
+    # Default stimuli are in [0.1, 1.1), spread them over [-6, 6) so both sides of
+    # every clamp, threshold and sign branch are taken. rsqrt keeps the positive range.
+    if mathop != MathOperation.Rsqrt:
+        src_A = (src_A - 0.6) * 12
+
+    generate_golden = get_golden_generator(UnarySFPUGolden)
+    golden_tensor = generate_golden(
+        mathop, src_A, formats.output_format, dest_acc, formats.input_format
+    )
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": dest_acc,
+        "input_A_dimensions": input_dimensions,
+        "input_B_dimensions": input_dimensions,
+        "mathop": mathop,
+        "implied_math_format": implied_math_format,
+        "tile_cnt": tile_cnt,
+    }
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        src_A,
+        src_B,
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=tile_cnt,
+        tile_count_B=tile_cnt,
+    )
+
+    run_test(test_config, BootMode.TRISC)
+
+    res_from_L1 = collect_results(formats, tile_count=tile_cnt, address=res_address)
+    assert len(res_from_L1) == len(golden_tensor)
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
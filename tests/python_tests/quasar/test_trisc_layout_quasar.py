@@ -0,0 +1,118 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from conftest import skip_for_blackhole, skip_for_wormhole
+from helpers.device import BootMode, collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.llk_params import TriscLayoutOperation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import run_test
+from helpers.tilize_untilize import tilize_block
+
+ELEMENTS_PER_TILE = 1024
+FACE_DIM = 16
+
+# Narrowing saturates, widening sign extends
+CONVERT_FORMATS = [
+    InputOutputFormat(DataFormat.Int32, DataFormat.Int8),
+    InputOutputFormat(DataFormat.Int8, DataFormat.Int32),
+]
+
+
+def trisc_layout_stimuli(operation, formats, dimensions):
+    """
+    Source data and the indices of gather (random, with repeats) and scatter (a permutation,
+    so every output is written once). Narrowing convert sources span past the int8 range.
+    """
+    element_count = dimensions[0] * dimensions[1]
+    if operation == TriscLayoutOperation.Convert:
+        bound = 1000 if formats.input_format == DataFormat.Int32 else 128
+        src = torch.randint(-bound, bound, (element_count,)).to(
+            format_dict[formats.input_format]
+        )
+    else:
+        src, _, _ = generate_stimuli(
+            formats.input_format, formats.input_format, input_dimensions=dimensions
+        )
+
+    if operation == TriscLayoutOperation.Scatter:
+        indices = torch.randperm(element_count)
+    else:
+        indices = torch.randint(0, element_count, (element_count,))
+    return src, indices
+
+
+def trisc_layout_golden(operation, src, indices, dimensions, formats):
+    if operation == TriscLayoutOperation.Tilize:
+        return tilize_block(src, dimensions, formats.input_format).flatten()
+    if operation == TriscLayoutOperation.Untilize:
+        # The source is the tilized input, the result the input as it was
+        return src
+    if operation == TriscLayoutOperation.TransposeFaces:
+        return src.view(-1, FACE_DIM, FACE_DIM).transpose(1, 2).flatten()
+    if operation == TriscLayoutOperation.Gather:
+        return src[indices]
+    if operation == TriscLayoutOperation.Scatter:
+        golden = torch.empty_like(src)
+        golden[indices] = src
+        return golden
+    if operation == TriscLayoutOperation.Fill:
+        return torch.full_like(src, src[0].item())
+    info = torch.iinfo(format_dict[formats.output_format])
+    return src.clamp(info.min, info.max).to(format_dict[formats.output_format])
+
+
+@skip_for_blackhole
+@skip_for_wormhole
+@parametrize(
+    test_name="trisc_layout_quasar_test",
+    formats=input_output_formats([DataFormat.Float16_b, DataFormat.Float32], same=True)
+    + CONVERT_FORMATS,
+    operation=list(TriscLayoutOperation),
+    dimensions=[[32, 32], [64, 96]],
+)
+def test_trisc_layout_quasar(test_name, formats, operation, dimensions):
+    if (operation == TriscLayoutOperation.Convert) != (formats in CONVERT_FORMATS):
+        pytest.skip(
+            "Convert runs on the integer formats, the data movement on the float ones"
+        )
+
+    torch.manual_seed(0)
+    tile_cnt = dimensions[0] * dimensions[1] // ELEMENTS_PER_TILE
+
+    src, indices = trisc_layout_stimuli(operation, formats, dimensions)
+    golden_tensor = trisc_layout_golden(operation, src, indices, dimensions, formats)
+    if operation == TriscLayoutOperation.Untilize:
+        src = tilize_block(src, dimensions, formats.input_format).flatten()
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "input_A_dimensions": dimensions,
+        "input_B_dimensions": dimensions,
+        "trisc_layout": operation,
+        "tile_cnt": tile_cnt,
+    }
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        src,
+        indices,
+        formats.input_format,
+        DataFormat.UInt32,
+        tile_count_A=tile_cnt,
+        tile_count_B=tile_cnt,
+    )
+
+    run_test(test_config, BootMode.TRISC)
+
+    res_from_L1 = collect_results(formats, tile_count=tile_cnt, address=res_address)
+    assert len(res_from_L1) == len(golden_tensor)
+
+    # Data movement is bit exact and convert is integer arithmetic
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+    mismatches = int((res_tensor != golden_tensor).sum())
+    assert mismatches == 0, f"{mismatches} of {len(golden_tensor)} elements differ"
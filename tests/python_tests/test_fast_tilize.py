@@ -55,8 +55,9 @@ def generate_input_dimensions(max_size: int) -> list[tuple[int, int]]:
     ),
     dest_acc=[DestAccumulation.Yes, DestAccumulation.No],
     dimensions=generate_input_dimensions(25),
+    unit_dim=[2, 4],
 )
-def test_fast_tilize(test_name, formats, dest_acc, dimensions):
+def test_fast_tilize(test_name, formats, dest_acc, dimensions, unit_dim):
 
     input_width, input_height = dimensions
 
@@ -79,6 +80,7 @@ def test_fast_tilize(test_name, formats, dest_acc, dimensions):
         "input_A_dimensions": input_dimensions,
         "input_B_dimensions": input_dimensions,
         "dest_acc": dest_acc,
+        "unit_dim": unit_dim,
     }
 
     res_address = write_stimuli_to_l1(
@@ -0,0 +1,133 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import math
+import shutil
+import subprocess
+from pathlib import Path
+
+import pytest
+from helpers.minimax import (
+    Format,
+    Symmetry,
+    emit_header,
+    lowest_degree,
+    round_bf16,
+    round_fp32,
+    sfpu_eval,
+)
+
+LLK_ROOT = Path(__file__).resolve().parents[2]
+QUARTER_PI = math.pi / 4
+
+
+def fit_sin(fmt: Format, max_ulp: float, coeff_format: Format = Format.FLOAT32):
+    return lowest_degree(
+        math.sin,
+        -QUARTER_PI,
+        QUARTER_PI,
+        fmt,
+        max_ulp,
+        Symmetry.ODD,
+        relative=True,
+        coeff_format=coeff_format,
+    )
+
+
+def test_round_bf16_ties_to_even():
+    # Halfway between bf16 neighbours, the even mantissa wins
+    assert round_bf16(1.0 + 2.0**-8) == 1.0
+    assert round_bf16(1.0 + 3 * 2.0**-8) == 1.0 + 2.0**-6
+    assert round_bf16(1.0 + 2.0**-8 + 2.0**-20) == 1.0 + 2.0**-7
+    assert round_bf16(-(1.0 + 3 * 2.0**-8)) == -(1.0 + 2.0**-6)
+    # Rounding up past the largest finite bf16 overflows
+    assert round_bf16(3.4e38) == math.inf
+    assert math.isnan(round_bf16(math.nan))
+
+
+def test_round_fp32():
+    assert round_fp32(1.0 + 2.0**-24) == 1.0
+    assert round_fp32(1.0 + 3 * 2.0**-24) == 1.0 + 2.0**-22
+    assert round_fp32(1e39) == math.inf and round_fp32(-1e39) == -math.inf
+
+
+@pytest.mark.parametrize(
+    "fmt, max_ulp, x_degree",
+    [
+        (Format.BFLOAT16, 1.0, 3),
+        # Every 2048th fp32 value, about 40s
+        (Format.FLOAT32, 2.0, 7),
+    ],
+)
+def test_fit_sin(fmt, max_ulp, x_degree):
+    result = fit_sin(fmt, max_ulp)
+
+    assert result is not None
+    assert result.x_degree == x_degree
+    assert len(result.coeffs) == x_degree // 2 + 1
+    assert result.report.max_ulp <= max_ulp
+    # Near the leading Taylor terms, a low degree minimax moves them by a few percent
+    assert result.coeffs[0] == pytest.approx(1.0, abs=1e-3)
+    assert result.coeffs[1] == pytest.approx(-1 / 6, rel=5e-2)
+    # Every coefficient is loaded as a float32
+    assert all(c == round_fp32(c) for c in result.coeffs)
+
+
+def test_fit_sin_bf16_coefficients():
+    result = fit_sin(Format.BFLOAT16, 1.0, coeff_format=Format.BFLOAT16)
+
+    assert result is not None
+    assert all(c == round_bf16(c) for c in result.coeffs)
+    # The refit after each rounding keeps bf16 coefficients inside the budget
+    assert result.report.max_ulp <= 1.0
+    assert sfpu_eval(result.coeffs, 0.0, Symmetry.ODD) == 0.0
+
+
+@pytest.mark.skipif(shutil.which("g++") is None, reason="needs a host g++")
+def test_emit_header_compiles(tmp_path):
+    result = fit_sin(Format.BFLOAT16, 1.0)
+    header = emit_header(
+        "SIN",
+        "sin",
+        -QUARTER_PI,
+        QUARTER_PI,
+        Format.BFLOAT16,
+        Format.FLOAT32,
+        True,
+        result,
+    )
+    (tmp_path / "ckernel_sfpu_sin_coeffs.h").write_text(header)
+
+    # PolynomialEvaluator is generic in T, so the table is checked with T = float on the host
+    expected = sfpu_eval(result.coeffs, 0.5, Symmetry.ODD)
+    source = tmp_path / "check.cpp"
+    source.write_text(
+        "\n".join(
+            [
+                '#include "ckernel_sfpu_polyval.h"',
+                '#include "ckernel_sfpu_sin_coeffs.h"',
+                "",
+                "using namespace ckernel::sfpu;",
+                "",
+                f"constexpr float value = 0.5f * PolynomialEvaluator<{len(result.coeffs)}, float, float>"
+                "::eval(SIN_COEFFS, 0.5f * 0.5f);",
+                f"static_assert(value - {expected!r}f < 1e-6f && {expected!r}f - value < 1e-6f);",
+                "",
+            ]
+        )
+    )
+
+    for arch in ("tt_llk_wormhole_b0", "tt_llk_blackhole"):
+        subprocess.run(
+            [
+                "g++",
+                "-std=c++17",
+                "-fsyntax-only",
+                "-Wall",
+                "-Werror",
+                f"-I{LLK_ROOT / arch / 'common' / 'inc' / 'sfpu'}",
+                f"-I{tmp_path}",
+                str(source),
+            ],
+            check=True,
+        )
@@ -0,0 +1,90 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat
+from helpers.golden_generators import UntilizeGolden, get_golden_generator
+from helpers.llk_params import DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import run_test
+from helpers.utils import passed_test
+
+
+def pack_untilize_stream(test_name, formats, dest_acc, ct_dims, rt_dim):
+    full_ct_dim, block_ct_dim = ct_dims
+    input_dimensions = [32 * rt_dim, 32 * full_ct_dim]
+
+    src_A, src_B, tile_cnt = generate_stimuli(
+        formats.input_format, formats.input_format, input_dimensions=input_dimensions
+    )
+
+    generate_golden = get_golden_generator(UntilizeGolden)
+    golden_tensor = generate_golden(src_A, formats.output_format, input_dimensions)
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "tile_cnt": tile_cnt,
+        "input_A_dimensions": input_dimensions,
+        "input_B_dimensions": input_dimensions,
+        "block_ct_dim": block_ct_dim,
+        "unpack_to_dest": formats.input_format.is_32_bit(),
+        "dest_acc": dest_acc,
+    }
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        src_A,
+        src_B,
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=tile_cnt,
+        tile_count_B=tile_cnt,
+    )
+
+    run_test(test_config)
+
+    res_from_L1 = collect_results(formats, tile_count=tile_cnt, address=res_address)
+    assert len(res_from_L1) == len(golden_tensor)
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
+
+
+@parametrize(
+    test_name="pack_untilize_stream_test",
+    formats=input_output_formats(
+        [
+            DataFormat.Float16_b,
+            DataFormat.Float16,
+        ]  # 16-bit Dest, so a Dest half holds a full 8 tile block
+    ),
+    dest_acc=[DestAccumulation.No],
+    # (full_ct_dim, block_ct_dim): multiple blocks per row, including a narrower tail block
+    ct_dims=[(8, 8), (12, 4), (20, 8), (33, 8)],
+    # Rows after the first start full_ct_dim tiles further into the output
+    rt_dim=[1, 3],
+)
+def test_pack_untilize_stream(test_name, formats, dest_acc, ct_dims, rt_dim):
+    pack_untilize_stream(test_name, formats, dest_acc, ct_dims, rt_dim)
+
+
+@parametrize(
+    test_name="pack_untilize_stream_test",
+    formats=input_output_formats(
+        [
+            DataFormat.Float32,
+            DataFormat.Int32,
+        ],  # 32-bit Dest, so a Dest half holds a 4 tile block
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.Yes],
+    # The row pitch of 4 byte datums, with a tail block
+    ct_dims=[(4, 4), (10, 4)],
+    rt_dim=[1, 2],
+)
+def test_pack_untilize_stream_32bit(test_name, formats, dest_acc, ct_dims, rt_dim):
+    pack_untilize_stream(test_name, formats, dest_acc, ct_dims, rt_dim)
@@ -0,0 +1,152 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import pandas as pd
+import pytest
+from helpers.perf_db import (
+    MIN_SAMPLES,
+    PerfDatabase,
+    bootstrap_change,
+    compare,
+    resolve_revision,
+)
+
+ARCH = "wormhole"
+BASELINE = "aaaaaaaaaaaa"
+CANDIDATE = "bbbbbbbbbbbb"
+
+
+@pytest.fixture
+def database(tmp_path, monkeypatch):
+    # Not a git checkout, so nothing resolves as a commit-ish
+    monkeypatch.setenv("LLK_HOME", str(tmp_path))
+    database = PerfDatabase(tmp_path / "perf_history.sqlite")
+    yield database
+    database.close()
+
+
+def samples(marker: str, values, params: str = "tile_cnt=1") -> pd.DataFrame:
+    return pd.DataFrame(
+        {
+            "params": params,
+            "marker": marker,
+            "run_type": "L1_TO_L1",
+            "value": list(values),
+        }
+    )
+
+
+def noisy(mean: float, count: int = 20, seed: int = 0) -> np.ndarray:
+    # ±1% around the mean
+    return mean * (1 + np.random.default_rng(seed).uniform(-0.01, 0.01, count))
+
+
+def verdicts(result: pd.DataFrame) -> dict:
+    return dict(zip(result["marker"], result["verdict"]))
+
+
+def test_bootstrap_change_interval():
+    baseline = noisy(1000)
+    candidate = noisy(1100, seed=1)
+
+    change, low, high = bootstrap_change(baseline, candidate)
+
+    assert change == pytest.approx(candidate.mean() / baseline.mean() - 1)
+    assert low < change < high
+    assert 0.08 < low and high < 0.12
+
+
+def test_compare_verdicts(database):
+    database.store(
+        "perf_test",
+        ARCH,
+        BASELINE,
+        pd.concat(
+            [
+                samples("SLOWER", noisy(1000)),
+                samples("FASTER", noisy(1000, seed=2)),
+                samples("SAME", noisy(1000, seed=4)),
+                samples("ONLY_BASELINE", noisy(1000, seed=6)),
+            ]
+        ),
+    )
+    database.store(
+        "perf_test",
+        ARCH,
+        CANDIDATE,
+        pd.concat(
+            [
+                samples("SLOWER", noisy(1100, seed=1)),
+                samples("FASTER", noisy(900, seed=3)),
+                samples("SAME", noisy(1000, seed=5)),
+                samples("ONLY_CANDIDATE", noisy(1000, seed=7)),
+            ]
+        ),
+    )
+
+    result = compare(database, BASELINE, CANDIDATE)
+
+    # Quantities measured on one side only are not compared
+    assert verdicts(result) == {
+        "SLOWER": "REGRESSION",
+        "FASTER": "IMPROVEMENT",
+        "SAME": "-",
+    }
+    assert (result["baseline_n"] == 20).all()
+    assert (result["candidate_n"] == 20).all()
+
+
+def test_compare_pools_runs_of_a_revision(database):
+    for seed in range(2):
+        database.store(
+            "perf_test", ARCH, BASELINE, samples("ZONE", noisy(1000, 10, seed))
+        )
+    database.store(
+        "perf_test", ARCH, CANDIDATE, samples("ZONE", noisy(1100, 10, seed=2))
+    )
+
+    result = compare(database, BASELINE, CANDIDATE)
+
+    assert result["baseline_n"].tolist() == [20]
+    assert verdicts(result) == {"ZONE": "REGRESSION"}
+
+
+def test_compare_too_few_samples(database):
+    database.store(
+        "perf_test", ARCH, BASELINE, samples("ZONE", noisy(1000, MIN_SAMPLES - 1))
+    )
+    database.store(
+        "perf_test", ARCH, CANDIDATE, samples("ZONE", noisy(2000, 20, seed=1))
+    )
+
+    result = compare(database, BASELINE, CANDIDATE)
+
+    # Even a 2x slowdown is not flagged from too few samples
+    assert verdicts(result) == {"ZONE": "TOO FEW SAMPLES"}
+    assert result["change"].iloc[0] == pytest.approx(1.0, abs=0.05)
+    assert np.isnan(result["ci_low"].iloc[0]) and np.isnan(result["ci_high"].iloc[0])
+
+
+def test_compare_filters_test_and_arch(database):
+    for revision, mean in [(BASELINE, 1000), (CANDIDATE, 1100)]:
+        database.store("perf_a", ARCH, revision, samples("ZONE", noisy(mean)))
+        database.store("perf_b", "blackhole", revision, samples("ZONE", noisy(mean)))
+
+    assert compare(database, BASELINE, CANDIDATE, test="perf_a")["test"].tolist() == [
+        "perf_a"
+    ]
+    assert compare(database, BASELINE, CANDIDATE, arch="blackhole")[
+        "test"
+    ].tolist() == ["perf_b"]
+    assert compare(database, BASELINE, CANDIDATE, test="perf_c").empty
+
+
+def test_resolve_revision(database):
+    database.store("perf_test", ARCH, BASELINE, samples("ZONE", noisy(1000)))
+
+    # Recorded keys are taken as is
+    assert resolve_revision(database, BASELINE) == BASELINE
+    # A key that is neither recorded nor a commit is returned unchanged and matches nothing
+    assert resolve_revision(database, "missing") == "missing"
+    assert compare(database, "missing", BASELINE).empty
@@ -0,0 +1,271 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+from helpers.llk_params import DstSync
+from helpers.pipeline_sim import (
+    SEMAPHORES,
+    ClearDvalid,
+    Delay,
+    InstructionCosts,
+    Issue,
+    SemGet,
+    SemPost,
+    SemWait,
+    SetDvalid,
+    StallWait,
+    decode_disassembly,
+    decode_instruction,
+    simulate,
+    tile_pipeline,
+)
+
+
+# Instruction words as built by the TT_OP_* macros of ckernel_ops.h
+def TT_OP(opcode, params):
+    return (opcode << 24) + params
+
+
+def TT_OP_UNPACR(Unpack_block_selection, SetDatValid):
+    return TT_OP(0x42, (Unpack_block_selection << 23) + (SetDatValid << 6))
+
+
+def TT_OP_UNPACR_NOP(Unpack_block_selection, NoOp):
+    return TT_OP(0x43, (Unpack_block_selection << 23) + NoOp)
+
+
+def TT_OP_ELWADD(clear_dvalid, dest_accum_en, instr_mod19, addr_mode, dst):
+    return TT_OP(
+        0x28,
+        (clear_dvalid << 22)
+        + (dest_accum_en << 21)
+        + (instr_mod19 << 19)
+        + (addr_mode << 15)
+        + dst,
+    )
+
+
+def TT_OP_PACR(AddrMode, ZeroWrite, PackSel, OvrdThreadId, Concat, Flush, Last):
+    return TT_OP(
+        0x41,
+        (AddrMode << 15)
+        + (ZeroWrite << 12)
+        + (PackSel << 8)
+        + (OvrdThreadId << 7)
+        + (Concat << 4)
+        + (Flush << 1)
+        + Last,
+    )
+
+
+def TT_OP_MOP(mop_type, loop_count, zmask_lo16):
+    return TT_OP(0x01, (mop_type << 23) + (loop_count << 16) + zmask_lo16)
+
+
+def TT_OP_SETDVALID(setvalid):
+    return TT_OP(0x57, setvalid)
+
+
+def TT_OP_CLEARDVALID(cleardvalid, reset):
+    return TT_OP(0x36, (cleardvalid << 22) + reset)
+
+
+def TT_OP_STALLWAIT(stall_res, wait_res):
+    return TT_OP(0xA2, (stall_res << 15) + wait_res)
+
+
+def TT_OP_SEMPOST(sem_sel):
+    return TT_OP(0xA4, sem_sel << 2)
+
+
+def TT_OP_SEMGET(sem_sel):
+    return TT_OP(0xA5, sem_sel << 2)
+
+
+def TT_OP_SEMWAIT(stall_res, sem_sel, wait_sem_cond):
+    return TT_OP(0xA6, (stall_res << 15) + (sem_sel << 2) + wait_sem_cond)
+
+
+def TT_OP_SFPLOAD(lreg_ind, instr_mod0, sfpu_addr_mode, dest_reg_addr):
+    return TT_OP(
+        0x70,
+        (lreg_ind << 20) + (instr_mod0 << 16) + (sfpu_addr_mode << 14) + dest_reg_addr,
+    )
+
+
+# ckernel_instr_params.h p_stall, ckernel_structs.h semaphore
+STALL_MATH, STALL_PACK = 0x40, 0x4
+MATH, PACK0, SRCA_CLR, SRCB_VLD, WAIT_SFPU = 0x80, 0x8, 0x100, 0x800, 0x4000
+STALL_ON_ZERO, STALL_ON_MAX = 0x1, 0x2
+MATH_PACK = SEMAPHORES["MATH_PACK"]
+SEM_MATH_PACK = 1 << MATH_PACK  # semaphore::t6_sem
+
+COSTS = InstructionCosts(unpack=16, fpu=16, sfpu=2, pack=16, mop=64, other=1)
+
+
+@pytest.mark.parametrize(
+    "thread, word, expected",
+    [
+        (
+            "UNPACK",
+            TT_OP_UNPACR(0, 1),
+            [Issue("UNPACK0", 16, sets=("A",), name="UNPACR")],
+        ),
+        (
+            "UNPACK",
+            TT_OP_UNPACR(1, 1),
+            [Issue("UNPACK1", 16, sets=("B",), name="UNPACR")],
+        ),
+        ("UNPACK", TT_OP_UNPACR(0, 0), [Issue("UNPACK0", 16, name="UNPACR")]),
+        (
+            "UNPACK",
+            TT_OP_UNPACR_NOP(1, 0b111),
+            [Issue("UNPACK1", 1, sets=("B",), name="UNPACR_NOP")],
+        ),
+        (
+            "MATH",
+            TT_OP_ELWADD(3, 0, 0, 0, 0),
+            [Issue("FPU", 16, reads=("A", "B"), clears=("A", "B"), name="ELWADD")],
+        ),
+        (
+            "MATH",
+            TT_OP_ELWADD(1, 1, 0, 2, 4),
+            [Issue("FPU", 16, reads=("A",), clears=("A",), name="ELWADD")],
+        ),
+        ("MATH", TT_OP_MOP(0, 3, 0), [Issue("FPU", 64, name="MOP")]),
+        ("UNPACK", TT_OP_MOP(0, 3, 0), [Issue("UNPACK0", 64, name="MOP")]),
+        ("MATH", TT_OP_SFPLOAD(0, 0, 3, 0), [Issue("SFPU", 2, name="SFP")]),
+        ("PACK", TT_OP_PACR(1, 0, 1, 0, 0, 0, 1), [Issue("PACK", 16, name="PACR")]),
+        ("UNPACK", TT_OP_SETDVALID(0b11), [SetDvalid(("A", "B"))]),
+        ("MATH", TT_OP_CLEARDVALID(0b10, 0), [ClearDvalid(("B",))]),
+        ("MATH", TT_OP_SEMPOST(SEM_MATH_PACK), [SemPost(MATH_PACK)]),
+        ("PACK", TT_OP_SEMGET(SEM_MATH_PACK), [SemGet(MATH_PACK)]),
+        (
+            "MATH",
+            TT_OP_SEMWAIT(STALL_MATH, SEM_MATH_PACK, STALL_ON_MAX),
+            [SemWait(MATH_PACK, "max")],
+        ),
+        (
+            "PACK",
+            TT_OP_SEMWAIT(STALL_PACK, SEM_MATH_PACK, STALL_ON_ZERO),
+            [SemWait(MATH_PACK, "zero")],
+        ),
+        (
+            "MATH",
+            TT_OP_STALLWAIT(STALL_MATH, MATH | WAIT_SFPU),
+            [StallWait(units=("FPU", "SFPU"))],
+        ),
+        (
+            "MATH",
+            TT_OP_STALLWAIT(STALL_MATH, SRCA_CLR | SRCB_VLD),
+            [StallWait(src_valid=("B",), src_clear=("A",))],
+        ),
+        ("PACK", TT_OP_STALLWAIT(STALL_PACK, PACK0), [StallWait(units=("PACK",))]),
+    ],
+)
+def test_decode_instruction(thread, word, expected):
+    assert decode_instruction(word, thread, COSTS) == expected
+
+
+def test_decode_unknown_opcode():
+    assert decode_instruction(TT_OP(0xFF, 0), "MATH", COSTS) is None
+
+
+def objdump_line(address, word, mnemonic, swizzle):
+    # .ttinsn rotates the TT_OP word left by 2 bits into the RISC-V stream
+    raw = (word << 2 | word >> 30) & 0xFFFFFFFF if swizzle else word
+    return f"  {address:x}:\t{raw:08x}          \t{mnemonic}\t0x0"
+
+
+@pytest.mark.parametrize("swizzle", [False, True])
+def test_decode_disassembly(swizzle):
+    listing = "\n".join(
+        [
+            "00000010 <_Z10run_kernelv>:",
+            objdump_line(
+                0x10,
+                TT_OP_SEMWAIT(STALL_MATH, SEM_MATH_PACK, STALL_ON_MAX),
+                "ttsemwait",
+                swizzle,
+            ),
+            "  14:\t00f00793          \tli\ta5,15",
+            objdump_line(0x18, TT_OP_ELWADD(3, 0, 0, 0, 0), "ttelwadd", swizzle),
+            objdump_line(0x1C, TT_OP_SEMPOST(SEM_MATH_PACK), "ttsempost", swizzle),
+        ]
+    )
+
+    # RISC-V code between the Tensix instructions is not part of the stream
+    assert decode_disassembly(listing, "MATH", COSTS) == [
+        SemWait(MATH_PACK, "max"),
+        Issue("FPU", 16, reads=("A", "B"), clears=("A", "B"), name="ELWADD"),
+        SemPost(MATH_PACK),
+    ]
+
+
+def test_simulate_mop():
+    # One tile: both operands unpacked, math adds them and runs a MOP on the result, pack drains Dest
+    streams = {
+        "UNPACK": [
+            *decode_instruction(TT_OP_UNPACR(0, 1), "UNPACK", COSTS),
+            *decode_instruction(TT_OP_UNPACR(1, 1), "UNPACK", COSTS),
+        ],
+        "MATH": [
+            *decode_instruction(
+                TT_OP_SEMWAIT(STALL_MATH, SEM_MATH_PACK, STALL_ON_MAX), "MATH", COSTS
+            ),
+            *decode_instruction(TT_OP_ELWADD(3, 0, 0, 0, 0), "MATH", COSTS),
+            *decode_instruction(TT_OP_MOP(0, 3, 0), "MATH", COSTS),
+            *decode_instruction(TT_OP_STALLWAIT(STALL_MATH, MATH), "MATH", COSTS),
+            *decode_instruction(TT_OP_SEMPOST(SEM_MATH_PACK), "MATH", COSTS),
+        ],
+        "PACK": [
+            *decode_instruction(
+                TT_OP_SEMWAIT(STALL_PACK, SEM_MATH_PACK, STALL_ON_ZERO), "PACK", COSTS
+            ),
+            *decode_instruction(TT_OP_PACR(1, 0, 1, 0, 0, 0, 1), "PACK", COSTS),
+            *decode_instruction(TT_OP_STALLWAIT(STALL_PACK, PACK0), "PACK", COSTS),
+            *decode_instruction(TT_OP_SEMGET(SEM_MATH_PACK), "PACK", COSTS),
+        ],
+    }
+
+    result = simulate(streams, DstSync.SyncHalf)
+
+    # srcB is valid at 17, ELWADD runs 17-33, the MOP 33-97, the SEMPOST at 97
+    # releases pack, PACR runs 98-114 and the SEMGET retires at 115
+    assert not result.deadlocked
+    assert result.cycles == 115
+    assert result.threads["UNPACK"].end == 2
+    assert result.threads["MATH"].end == 98
+    assert result.threads["PACK"].end == 115
+
+    assert result.unit_busy["FPU"] == 16 + 64
+    assert result.threads["MATH"].stalls["srcA_valid"] == 15
+    assert result.threads["MATH"].stalls["srcB_valid"] == 1
+    assert result.threads["MATH"].stalls["unit:FPU"] == 15
+    assert result.threads["MATH"].stalls["stallwait"] == 63
+    assert result.bottleneck == ("MATH", "FPU")
+
+
+def test_simulate_tile_pipeline_steady_state():
+    # Math bound: after the first tile is unpacked every tile costs the math time
+    tiles, unpack, math, pack = 16, 20, 100, 30
+    result = simulate(tile_pipeline(tiles, unpack, math, pack), DstSync.SyncHalf)
+
+    assert not result.deadlocked
+    assert result.unit_busy["FPU"] == tiles * math
+    assert tiles * math <= result.cycles <= tiles * math + 2 * unpack + 8 * pack + 50
+    assert result.bottleneck == ("MATH", "FPU")
+
+
+def test_simulate_reports_deadlock():
+    # Pack waits for a Dest section math never posts
+    streams = {
+        "UNPACK": [],
+        "MATH": [Delay(10)],
+        "PACK": [SemWait(MATH_PACK, "zero")],
+    }
+
+    result = simulate(streams)
+
+    assert result.deadlocked == ("PACK",)
+    assert result.threads["PACK"].stalls[f"sem{MATH_PACK}"] == 10
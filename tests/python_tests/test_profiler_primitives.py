@@ -1,8 +1,16 @@
 # SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
 # SPDX-License-Identifier: Apache-2.0
 
+import json
+
 import pandas as pd
-from helpers.profiler import Profiler
+import pytest
+from helpers.chip_architecture import ChipArchitecture, get_chip_architecture
+from helpers.device import write_stimuli_to_l1
+from helpers.format_config import DataFormat
+from helpers.param_config import input_output_formats
+from helpers.profiler import Profiler, get_profiler_layout
+from helpers.stimuli_generator import generate_stimuli
 from helpers.test_config import ProfilerBuild, run_test
 
 
@@ -93,3 +101,106 @@ def test_profiler_primitives():
     assert (
         timestamp_data["data"] == 0xBADC0FFE0DDF00D
     ), f"Expected data = 0xBADC0FFE0DDF00D, got {hex(int(timestamp_data['data']))}"
+
+    # Trace export - one track per thread, zone as a slice, data as a counter
+    events = runtime.trace_events()
+    thread_names = {
+        event["args"]["name"] for event in events if event["name"] == "thread_name"
+    }
+    assert thread_names == set(get_profiler_layout().threads)
+
+    slices = [event for event in events if event["ph"] == "X"]
+    assert any(event["name"] == "TEST_ZONE" for event in slices)
+    assert all(event["dur"] > 0 for event in slices)
+
+    counters = [event for event in events if event["ph"] == "C"]
+    assert [event["args"]["data"] for event in counters] == [0xBADC0FFE0DDF00D]
+
+    # BRISC - device setup is profiled when BRISC boots the TRISCs
+    if get_chip_architecture() != ChipArchitecture.QUASAR:
+        setup = runtime.brisc().zones().marker("DEVICE_SETUP").frame()
+        assert len(setup) == 1, "Expected exactly one DEVICE_SETUP entry"
+        assert setup.iloc[0]["duration"] > 0
+
+        kernel = runtime.unpack().zones().marker("KERNEL").frame()
+        release = runtime.brisc().timestamps().marker("TRISC_RELEASE").frame()
+        assert (
+            release.iloc[0]["timestamp"] < kernel.iloc[0]["timestamp"]
+        ), "Expected TRISCs to start after BRISC released them"
+
+
+@pytest.mark.skipif(
+    get_chip_architecture() == ChipArchitecture.QUASAR,
+    reason="handoff kernel uses the WH/BH datacopy LLKs",
+)
+def test_profiler_handoff():
+
+    formats = input_output_formats([DataFormat.Float16_b])[0]
+    input_dimensions = [64, 64]
+
+    src_A, src_B, tile_cnt = generate_stimuli(
+        formats.input_format, formats.input_format, input_dimensions=input_dimensions
+    )
+
+    test_config = {
+        "formats": formats,
+        "testname": "profiler_handoff_test",
+        "input_A_dimensions": input_dimensions,
+        "input_B_dimensions": input_dimensions,
+        "tile_cnt": tile_cnt,
+    }
+
+    write_stimuli_to_l1(
+        test_config,
+        src_A,
+        src_B,
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=tile_cnt,
+        tile_count_B=tile_cnt,
+    )
+
+    run_test(test_config, profiler_build=ProfilerBuild.Yes)
+
+    runtime = Profiler.get_data(test_config["testname"])
+
+    handoffs = [("UNPACK_TILE", "MATH_TILE"), ("MATH_TILE", "PACK_TILE")]
+    threads = {
+        "UNPACK_TILE": runtime.unpack(),
+        "MATH_TILE": runtime.math(),
+        "PACK_TILE": runtime.pack(),
+    }
+    for marker, data in threads.items():
+        zones = data.zones().marker(marker).frame()
+        assert len(zones) == tile_cnt, f"Expected {tile_cnt} {marker}, got {len(zones)}"
+
+    # Round trip through the written trace, as loaded by Perfetto
+    path = Profiler.dump_trace(runtime, "profiler_handoff_trace.json", flows=handoffs)
+    with open(path) as f:
+        events = json.load(f)["traceEvents"]
+
+    tids = {
+        event["args"]["name"]: event["tid"]
+        for event in events
+        if event["name"] == "thread_name"
+    }
+    flows = [event for event in events if event.get("cat") == "handoff"]
+    assert len(flows) == 2 * len(handoffs) * tile_cnt
+
+    origin = runtime.frame()["timestamp"].min()
+    for flow_id, (producer, consumer) in enumerate(handoffs):
+        producer_zones = threads[producer].zones().marker(producer).frame()
+        consumer_tid = tids[threads[consumer].frame()["thread"].iloc[0]]
+
+        for index, (_, zone) in enumerate(producer_zones.iterrows()):
+            pair = [e for e in flows if e["id"] == f"0.{flow_id}.{index}"]
+            start = next(e for e in pair if e["ph"] == "s")
+            finish = next(e for e in pair if e["ph"] == "f")
+
+            # the n-th arrow leaves the producer track at the end of the n-th zone and lands on the consumer track
+            assert start["name"] == finish["name"] == f"{producer} -> {consumer}"
+            assert start["tid"] == tids[zone["thread"]]
+            assert start["ts"] == pytest.approx(
+                (zone["timestamp"] + zone["duration"] - origin) / 1000.0
+            )
+            assert finish["tid"] == consumer_tid and finish["bp"] == "e"
@@ -0,0 +1,109 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat
+from helpers.golden_generators import ReduceGolden, get_golden_generator
+from helpers.llk_params import (
+    DestAccumulation,
+    MathOperation,
+    ReduceDimension,
+    ReducePool,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import run_test
+from helpers.tilize_untilize import untilize
+from helpers.utils import passed_test
+
+# Helper dictionary to map reduce dimensions to math operations
+mathop_mapping = {
+    ReduceDimension.Row: MathOperation.ReduceRow,
+    ReduceDimension.Column: MathOperation.ReduceColumn,
+    ReduceDimension.Scalar: MathOperation.ReduceScalar,
+}
+
+
+@parametrize(
+    test_name="reduce_block_test",
+    formats=input_output_formats(
+        [
+            DataFormat.Float16_b,
+            DataFormat.Float32,
+        ]
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    reduce_dim=[ReduceDimension.Row, ReduceDimension.Column, ReduceDimension.Scalar],
+    pool_type=[ReducePool.Max, ReducePool.Average, ReducePool.Sum],
+    tile_cnt=[1, 2, 8],
+)
+def test_reduce_block(test_name, formats, dest_acc, reduce_dim, pool_type, tile_cnt):
+
+    # Whole strip reduces into one tile, strip is laid out as consecutive tiles
+    input_dimensions = [32, 32 * tile_cnt]
+
+    src_A, _, tile_cnt = generate_stimuli(
+        formats.input_format, formats.input_format, input_dimensions=input_dimensions
+    )
+
+    # Scaler is a single tile shared by the whole strip
+    if pool_type in [ReducePool.Max, ReducePool.Sum]:
+        src_B = torch.full((1024,), 1)
+    elif reduce_dim in [ReduceDimension.Column, ReduceDimension.Row]:
+        src_B = torch.full((1024,), 1 / (32 * tile_cnt))
+    else:
+        src_B = torch.full((1024,), torch.sqrt(torch.tensor(1 / (1024 * tile_cnt))))
+
+    # Golden of the strip is the per-tile golden combined across tiles
+    generate_golden = get_golden_generator(ReduceGolden)
+    tile_goldens = torch.stack(
+        [
+            generate_golden(
+                src_A[tile * 1024 : (tile + 1) * 1024],
+                reduce_dim,
+                pool_type,
+                formats.output_format,
+            )
+            for tile in range(tile_cnt)
+        ]
+    )
+    if pool_type == ReducePool.Max:
+        golden_tensor = torch.max(tile_goldens, dim=0).values
+    elif pool_type == ReducePool.Sum:
+        golden_tensor = torch.sum(tile_goldens, dim=0)
+    else:
+        golden_tensor = torch.mean(tile_goldens, dim=0)
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": dest_acc,
+        # fp32 Dest keeps the partials of the whole strip in fp32
+        "enforce_fp32_accumulation": dest_acc == DestAccumulation.Yes,
+        "reduce_dim": reduce_dim,
+        "pool_type": pool_type,
+        "mathop": mathop_mapping[reduce_dim],
+        "tile_cnt": tile_cnt,
+    }
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        src_A,
+        src_B,
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=tile_cnt,
+        tile_count_B=1,
+    )
+
+    run_test(test_config)
+
+    res_from_L1 = collect_results(formats, tile_count=1, address=res_address)
+    assert len(res_from_L1) == len(golden_tensor)
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+    res_tensor = untilize(res_tensor, formats.output_format)
+
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
@@ -0,0 +1,60 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+from helpers.device import (
+    BootMode,
+    ResidentDispatcher,
+    wait_for_tensix_operations_finished,
+)
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.l1_layout import L1Arena
+from helpers.target_config import TestTargetConfig
+from helpers.test_config import ProfilerBuild, resident_image, run_test
+from ttexalens.tt_exalens_lib import read_words_from_device
+
+
+@pytest.mark.skipif(
+    not TestTargetConfig().resident, reason="Resident mode requires --resident"
+)
+def test_resident_dispatch():
+
+    test_config = {
+        "testname": "resident_dispatch_test",
+        "formats": InputOutputFormat(DataFormat.Float16_b, DataFormat.Float16_b),
+    }
+
+    # One result word per TRISC, the kernels take the address from build.h
+    arena = L1Arena()
+    result_address = arena.allocate("buffer_Res", 3 * 4).address
+    test_config["result_buffer_address"] = result_address
+    test_config["l1_arena"] = arena
+
+    # First run boots the image, kernel 0 without args
+    run_test(test_config)
+    assert read_words_from_device("0,0", result_address, word_count=3) == [1, 1, 1]
+
+    image = resident_image(test_config, BootMode.DEFAULT, ProfilerBuild.No)
+    assert ResidentDispatcher.is_booted(image)
+
+    # Following commands reuse the booted ELFs, pick kernels and pass runtime args
+    for kernel_id, arg in [(0, 10), (1, 10), (1, 1000), (0, 7)]:
+        ResidentDispatcher.dispatch(kernel_id, [arg])
+        wait_for_tensix_operations_finished()
+
+        expected = (kernel_id + 1) * arg + 1
+        result = read_words_from_device("0,0", result_address, word_count=3)
+        assert result == [expected] * 3, f"kernel {kernel_id}, arg {arg}: {result}"
+
+    # Ids outside the kernel table are reported, the loop keeps serving commands
+    ResidentDispatcher.dispatch(2, [10])
+    with pytest.raises(RuntimeError, match="does not link"):
+        wait_for_tensix_operations_finished()
+
+    # Same build through run_test is dispatched without a reload
+    run_test(test_config)
+    assert ResidentDispatcher.is_booted(image)
+    assert read_words_from_device("0,0", result_address, word_count=3) == [1, 1, 1]
+
+    ResidentDispatcher.exit()
+    assert not ResidentDispatcher.is_booted(image)
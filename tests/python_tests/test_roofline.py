@@ -0,0 +1,120 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pandas as pd
+import pytest
+from helpers.chip_architecture import ChipArchitecture
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.llk_params import MathFidelity, MathOperation
+from helpers.roofline import (
+    ARCH_PEAKS,
+    ArchPeaks,
+    FpuPipe,
+    eltwise_work,
+    matmul_work,
+    roofline,
+)
+
+# Round figures so the expected cycles can be checked by hand
+PEAKS = ArchPeaks(
+    {FpuPipe.MATMUL: 4096, FpuPipe.ELTWISE: 128, FpuPipe.REDUCE: 256},
+    unpack_bytes_per_cycle=128,
+    pack_bytes_per_cycle=64,
+)
+
+BF16 = InputOutputFormat(DataFormat.Float16_b, DataFormat.Float16_b)
+
+
+def test_arch_peaks_cover_every_arch_and_pipe():
+    assert set(ARCH_PEAKS) == set(ChipArchitecture)
+    for peaks in ARCH_PEAKS.values():
+        assert set(peaks.flops_per_cycle) == set(FpuPipe)
+
+
+def test_matmul_ideal_cycles():
+    # 4x4 output tiles over kt 4: 2 * 4 * 4 * 4 * 32^3 FLOPs, 4 * (4 + 4) input and 16 output 2KB tiles
+    work = matmul_work(BF16, rt_dim=4, ct_dim=4, kt_dim=4)
+
+    assert work.ideal_cycles(PEAKS) == {"compute": 1024, "unpack": 512, "pack": 512}
+
+    # Every fidelity phase is another pass through the FPU
+    hifi4 = matmul_work(
+        BF16, rt_dim=4, ct_dim=4, kt_dim=4, math_fidelity=MathFidelity.HiFi4
+    )
+    assert hifi4.ideal_cycles(PEAKS)["compute"] == 4 * 1024
+    assert hifi4.flops == work.flops
+
+
+def test_eltwise_fidelity_only_repeats_multiply():
+    add = eltwise_work(
+        BF16, tile_cnt=4, math_fidelity=MathFidelity.HiFi4, mathop=MathOperation.Elwadd
+    )
+    mul = eltwise_work(
+        BF16, tile_cnt=4, math_fidelity=MathFidelity.HiFi4, mathop=MathOperation.Elwmul
+    )
+
+    assert add.ideal_cycles(PEAKS)["compute"] == 32
+    assert mul.ideal_cycles(PEAKS)["compute"] == 4 * 32
+
+
+def results(means: dict) -> pd.DataFrame:
+    return pd.DataFrame(
+        {
+            "marker": ["TILE_LOOP", "INIT"],
+            **{f"mean({run_type})": [mean, 10.0] for run_type, mean in means.items()},
+        }
+    )
+
+
+@pytest.mark.parametrize(
+    "output_format, bound, ideal",
+    [
+        # 4 bf16 tiles: 32 compute, 128 unpack and 128 pack cycles, ties go to the first of BOUNDS
+        (DataFormat.Float16_b, "unpack", 128),
+        # Float32 output doubles the packed bytes
+        (DataFormat.Float32, "pack", 256),
+    ],
+)
+def test_roofline_bound(output_format, bound, ideal):
+    formats = InputOutputFormat(DataFormat.Float16_b, output_format)
+    work = eltwise_work(formats, tile_cnt=4)
+
+    result = roofline(results({"L1_TO_L1": 512.0}), work, peaks=PEAKS)
+    tile_loop = result.iloc[0]
+
+    assert tile_loop["bound"] == bound
+    assert tile_loop["ideal_cycles"] == ideal
+    assert tile_loop["flops"] == 4 * 1024
+    assert tile_loop["peak%(L1_TO_L1)"] == pytest.approx(100 * ideal / 512)
+
+
+def test_roofline_isolated_units_use_their_own_ideal():
+    work = matmul_work(BF16, rt_dim=4, ct_dim=4, kt_dim=4)
+    measured = {
+        "L1_TO_L1": 2048.0,
+        "UNPACK_ISOLATE": 1024.0,
+        "MATH_ISOLATE": 2048.0,
+        "PACK_ISOLATE": 512.0,
+        "L1_CONGESTION[PACK]": 1024.0,
+    }
+
+    result = roofline(results(measured), work, peaks=PEAKS)
+    tile_loop = result.iloc[0]
+
+    # Compute bound, so the unisolated run is measured against the compute ideal
+    assert tile_loop["bound"] == "compute"
+    assert tile_loop["peak%(L1_TO_L1)"] == pytest.approx(50)
+    assert tile_loop["peak%(UNPACK_ISOLATE)"] == pytest.approx(50)
+    assert tile_loop["peak%(MATH_ISOLATE)"] == pytest.approx(50)
+    assert tile_loop["peak%(PACK_ISOLATE)"] == pytest.approx(100)
+    assert tile_loop["peak%(L1_CONGESTION[PACK])"] == pytest.approx(50)
+
+
+def test_roofline_only_fills_the_marker_rows():
+    work = matmul_work(BF16, rt_dim=1, ct_dim=1, kt_dim=1)
+
+    result = roofline(results({"L1_TO_L1": 100.0}), work, peaks=PEAKS)
+    init = result.iloc[1]
+
+    assert init[["flops", "intensity", "ideal_cycles", "bound"]].isna().all()
+    assert pd.isna(init["peak%(L1_TO_L1)"])
@@ -0,0 +1,126 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.llk_params import (
+    ArgReduceOperation,
+    ArgTieBreak,
+    DestAccumulation,
+    MathOperation,
+    format_dict,
+)
+from helpers.param_config import parametrize
+from helpers.test_config import run_test
+from helpers.tilize_untilize import tilize_block, untilize_block
+
+TILE_DIM = 32
+# Reduced in two chunks, the second one merged with the result of the first
+TILE_COUNT = 3
+
+# Values come from a handful of integers, so most maxima and minima are tied
+VALUE_RANGE = 6
+
+
+def arg_reduce_golden(x, operation, tie_break, dim):
+    """Index of the max/min along dim, the lowest or highest one among ties"""
+    best = x.amax(dim) if operation == ArgReduceOperation.ArgMax else x.amin(dim)
+    hit = x == best.unsqueeze(dim)
+    positions = torch.arange(x.shape[dim]).view(
+        [-1 if d == dim else 1 for d in range(x.dim())]
+    )
+    if tie_break == ArgTieBreak.First:
+        return torch.where(hit, positions, x.shape[dim]).amin(dim)
+    return torch.where(hit, positions, -1).amax(dim)
+
+
+@parametrize(
+    test_name="sfpu_arg_reduce_test",
+    formats=[
+        InputOutputFormat(input_format, index_format)
+        for input_format in [DataFormat.Float16_b, DataFormat.Float32]
+        for index_format in [DataFormat.Int32, DataFormat.UInt16]
+    ],
+    operation=[ArgReduceOperation.ArgMax, ArgReduceOperation.ArgMin],
+    tie_break=[ArgTieBreak.First, ArgTieBreak.Last],
+    mathop=[
+        MathOperation.ReduceColumn,
+        MathOperation.ReduceRow,
+        MathOperation.ReduceScalar,
+    ],
+)
+def test_sfpu_arg_reduce(test_name, formats, operation, tie_break, mathop):
+    torch_format = format_dict[formats.input_format]
+
+    torch.manual_seed(0)
+    if mathop == MathOperation.ReduceRow:
+        # Tiles side by side, every row reduced over all of them
+        x = torch.randint(-VALUE_RANGE, VALUE_RANGE, (TILE_DIM, TILE_DIM * TILE_COUNT))
+        tiles = x.view(TILE_DIM, TILE_COUNT, TILE_DIM).permute(1, 0, 2)
+    else:
+        # Tiles stacked, every column or the whole block reduced over all of them
+        x = torch.randint(-VALUE_RANGE, VALUE_RANGE, (TILE_DIM * TILE_COUNT, TILE_DIM))
+        tiles = x.view(TILE_COUNT, TILE_DIM, TILE_DIM)
+    x = x.to(torch_format)
+
+    if mathop == MathOperation.ReduceColumn:
+        golden = arg_reduce_golden(x.to(torch.float64), operation, tie_break, 0)
+    elif mathop == MathOperation.ReduceRow:
+        golden = arg_reduce_golden(x.to(torch.float64), operation, tie_break, 1)
+    else:
+        golden = arg_reduce_golden(
+            x.to(torch.float64).flatten(), operation, tie_break, 0
+        ).view(1)
+
+    stimuli = torch.cat(
+        [
+            tilize_block(
+                tile.to(torch_format).flatten(),
+                [TILE_DIM, TILE_DIM],
+                formats.input_format,
+            ).flatten()
+            for tile in tiles
+        ]
+    )
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": DestAccumulation.Yes,
+        "input_A_dimensions": [TILE_DIM, TILE_DIM * TILE_COUNT],
+        "input_B_dimensions": [TILE_DIM, TILE_DIM * TILE_COUNT],
+        "mathop": mathop,
+        "unpack_to_dest": formats.input_format.is_32_bit(),
+        "arg_reduce_operation": operation,
+        "arg_tie_break": tie_break,
+        "arg_reduce_tiles": TILE_COUNT,
+        "tile_cnt": TILE_COUNT,
+    }
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        stimuli,
+        stimuli,
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=TILE_COUNT,
+        tile_count_B=TILE_COUNT,
+    )
+
+    run_test(test_config)
+
+    # Only the indices tile is packed, its row 0 holds the result
+    res_from_L1 = collect_results(formats, tile_count=1, address=res_address)
+    res_tile = untilize_block(
+        torch.tensor(res_from_L1, dtype=format_dict[formats.output_format]),
+        formats.output_format,
+        [TILE_DIM, TILE_DIM],
+    ).view(TILE_DIM, TILE_DIM)
+    res_indices = res_tile[0, : len(golden)].to(torch.int64)
+
+    mismatches = res_indices != golden
+    assert not torch.any(mismatches), (
+        f"{int(mismatches.sum())} mismatches, "
+        f"{res_indices[mismatches][:8].tolist()} instead of {golden[mismatches][:8].tolist()}"
+    )
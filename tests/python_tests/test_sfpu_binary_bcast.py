@@ -0,0 +1,230 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import struct
+
+import torch
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat
+from helpers.golden_generators import BinarySFPUGolden, get_golden_generator
+from helpers.llk_params import (
+    BinaryBcastSfpuType,
+    BinaryBroadcast,
+    DestAccumulation,
+    MathOperation,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.test_config import run_test
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import passed_test
+
+TILE_DIM = 32
+TILE_COUNT = 2
+
+# Row and column of the in1 tiles that are broadcast, in the lower and the right faces
+BROADCAST_ROW = 21
+BROADCAST_COLUMN = 19
+FLOAT_SCALAR = -0.75
+SHIFT_SCALAR = 7
+BITWISE_SCALAR = 0x5A3C0FF1
+
+COMPARISONS = {
+    BinaryBcastSfpuType.Equal: torch.eq,
+    BinaryBcastSfpuType.NotEqual: torch.ne,
+    BinaryBcastSfpuType.Greater: torch.gt,
+    BinaryBcastSfpuType.Less: torch.lt,
+    BinaryBcastSfpuType.GreaterEqual: torch.ge,
+    BinaryBcastSfpuType.LessEqual: torch.le,
+}
+BITWISE_OPS = {
+    BinaryBcastSfpuType.BitwiseAnd: torch.bitwise_and,
+    BinaryBcastSfpuType.BitwiseOr: torch.bitwise_or,
+    BinaryBcastSfpuType.BitwiseXor: torch.bitwise_xor,
+}
+
+
+def tilize_tiles(tiles, data_format):
+    return torch.cat(
+        [
+            tilize_block(tile.flatten(), [TILE_DIM, TILE_DIM], data_format).flatten()
+            for tile in tiles
+        ]
+    )
+
+
+def sfpu_binary_bcast(test_name, formats, op, broadcast, src_A, src_B, scalar):
+    torch_format = format_dict[formats.input_format]
+    src_A = src_A.to(torch_format)
+    src_B = src_B.to(torch_format)
+
+    if broadcast == BinaryBroadcast.Scalar:
+        operand = torch.full_like(src_A, scalar)
+        scalar_bits = (
+            struct.unpack("<I", struct.pack("<f", scalar))[0]
+            if isinstance(scalar, float)
+            else scalar & 0xFFFFFFFF
+        )
+    elif broadcast == BinaryBroadcast.Row:
+        operand = src_B[:, BROADCAST_ROW : BROADCAST_ROW + 1].expand_as(src_A)
+        scalar_bits = 0
+    else:
+        operand = src_B[:, :, BROADCAST_COLUMN : BROADCAST_COLUMN + 1].expand_as(src_A)
+        scalar_bits = 0
+
+    if op in COMPARISONS:
+        golden = COMPARISONS[op](src_A, operand).to(torch_format).flatten()
+    elif op in BITWISE_OPS:
+        golden = BITWISE_OPS[op](src_A, operand).flatten()
+    else:
+        generate_golden = get_golden_generator(BinarySFPUGolden)
+        golden = generate_golden(
+            op, src_A.flatten(), operand.flatten(), formats.output_format
+        )
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": DestAccumulation.Yes,
+        "input_A_dimensions": [TILE_DIM, TILE_DIM * TILE_COUNT],
+        "input_B_dimensions": [TILE_DIM, TILE_DIM * TILE_COUNT],
+        "unpack_to_dest": formats.input_format.is_32_bit(),
+        "binary_broadcast": broadcast,
+        "broadcast_row": BROADCAST_ROW,
+        "broadcast_column": BROADCAST_COLUMN,
+        "broadcast_scalar": scalar_bits,
+        "tile_cnt": TILE_COUNT,
+    }
+    if isinstance(op, BinaryBcastSfpuType):
+        test_config["binary_bcast_sfpu_type"] = op
+    else:
+        test_config["mathop"] = op
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        tilize_tiles(src_A, formats.input_format),
+        tilize_tiles(src_B, formats.input_format),
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=TILE_COUNT,
+        tile_count_B=TILE_COUNT,
+    )
+
+    run_test(test_config)
+
+    res_from_L1 = collect_results(formats, tile_count=TILE_COUNT, address=res_address)
+    res_tensor = untilize_block(
+        torch.tensor(res_from_L1, dtype=format_dict[formats.output_format]),
+        formats.output_format,
+        [TILE_COUNT * TILE_DIM, TILE_DIM],
+    ).flatten()
+
+    assert len(res_tensor) == len(golden)
+    assert passed_test(golden, res_tensor, formats.output_format)
+
+
+ALL_BROADCASTS = [BinaryBroadcast.Scalar, BinaryBroadcast.Row, BinaryBroadcast.Column]
+
+
+@parametrize(
+    test_name="sfpu_binary_bcast_test",
+    formats=input_output_formats(
+        [DataFormat.Float32, DataFormat.Float16_b],
+        same=True,
+    ),
+    mathop=[
+        MathOperation.SfpuElwadd,
+        MathOperation.SfpuElwsub,
+        MathOperation.SfpuElwmul,
+    ],
+    broadcast=ALL_BROADCASTS,
+)
+def test_sfpu_binary_bcast_float(test_name, formats, mathop, broadcast):
+    torch.manual_seed(0)
+    src_A = torch.rand(TILE_COUNT, TILE_DIM, TILE_DIM) * 4 - 2
+    src_B = torch.rand(TILE_COUNT, TILE_DIM, TILE_DIM) * 4 - 2
+
+    sfpu_binary_bcast(test_name, formats, mathop, broadcast, src_A, src_B, FLOAT_SCALAR)
+
+
+@parametrize(
+    test_name="sfpu_binary_bcast_test",
+    formats=input_output_formats(
+        [DataFormat.Float32, DataFormat.Float16_b],
+        same=True,
+    ),
+    mathop=[
+        MathOperation.SfpuElwdiv,
+        MathOperation.SfpuElwpow,
+        MathOperation.SfpuXlogy,
+    ],
+    broadcast=ALL_BROADCASTS,
+)
+def test_sfpu_binary_bcast_float_positive(test_name, formats, mathop, broadcast):
+    # The divisor, the base of pow and y of xlogy are kept in [0.5, 2], away from 0 and the negative NaN cases
+    torch.manual_seed(0)
+    src_A = torch.rand(TILE_COUNT, TILE_DIM, TILE_DIM) * 1.5 + 0.5
+    src_B = torch.rand(TILE_COUNT, TILE_DIM, TILE_DIM) * 1.5 + 0.5
+    if mathop == MathOperation.SfpuElwdiv:
+        src_A = src_A * 4 - 4
+
+    sfpu_binary_bcast(
+        test_name, formats, mathop, broadcast, src_A, src_B, -FLOAT_SCALAR
+    )
+
+
+@parametrize(
+    test_name="sfpu_binary_bcast_test",
+    formats=input_output_formats(
+        [DataFormat.Float32, DataFormat.Float16_b],
+        same=True,
+    ),
+    comparison=list(COMPARISONS),
+    broadcast=ALL_BROADCASTS,
+)
+def test_sfpu_binary_bcast_comparison(test_name, formats, comparison, broadcast):
+    # Both operands are drawn from the halves in [-2, 2], so equal pairs are frequent
+    torch.manual_seed(0)
+    src_A = torch.randint(-4, 5, (TILE_COUNT, TILE_DIM, TILE_DIM)) / 2
+    src_B = torch.randint(-4, 5, (TILE_COUNT, TILE_DIM, TILE_DIM)) / 2
+
+    sfpu_binary_bcast(
+        test_name, formats, comparison, broadcast, src_A, src_B, FLOAT_SCALAR
+    )
+
+
+@parametrize(
+    test_name="sfpu_binary_bcast_test",
+    formats=input_output_formats([DataFormat.Int32]),
+    mathop=[
+        MathOperation.SfpuElwRightShift,
+        MathOperation.SfpuElwLeftShift,
+        MathOperation.SfpuElwLogicalRightShift,
+    ],
+    broadcast=ALL_BROADCASTS,
+)
+def test_sfpu_binary_bcast_int(test_name, formats, mathop, broadcast):
+    torch.manual_seed(0)
+    src_A = torch.randint(
+        -(2**31) + 1, 2**31, (TILE_COUNT, TILE_DIM, TILE_DIM), dtype=torch.int32
+    )
+    src_B = torch.randint(0, 32, (TILE_COUNT, TILE_DIM, TILE_DIM), dtype=torch.int32)
+
+    sfpu_binary_bcast(test_name, formats, mathop, broadcast, src_A, src_B, SHIFT_SCALAR)
+
+
+@parametrize(
+    test_name="sfpu_binary_bcast_test",
+    formats=input_output_formats([DataFormat.Int32]),
+    bitwise_op=list(BITWISE_OPS),
+    broadcast=ALL_BROADCASTS,
+)
+def test_sfpu_binary_bcast_bitwise(test_name, formats, bitwise_op, broadcast):
+    # Non-negative, so the bits are the same in Dest's sign-magnitude and 2's complement Int32
+    torch.manual_seed(0)
+    src_A = torch.randint(0, 2**31, (TILE_COUNT, TILE_DIM, TILE_DIM), dtype=torch.int32)
+    src_B = torch.randint(0, 2**31, (TILE_COUNT, TILE_DIM, TILE_DIM), dtype=torch.int32)
+
+    sfpu_binary_bcast(
+        test_name, formats, bitwise_op, broadcast, src_A, src_B, BITWISE_SCALAR
+    )
@@ -0,0 +1,96 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from conftest import skip_for_quasar
+from helpers.chip_architecture import ChipArchitecture, get_chip_architecture
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.golden_generators import UnarySFPUGolden, get_golden_generator
+from helpers.llk_params import DestAccumulation, MathOperation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.stimuli_generator import generate_stimuli
+from helpers.test_config import run_test
+from helpers.utils import passed_test
+
+# Kernels of tt_llk_common/sfpu/ckernel_sfpu_common_activations.h, the nonlinear ones
+# need single instruction transcendentals and are covered by the Quasar test
+COMMON_ACTIVATIONS = [
+    MathOperation.Abs,
+    MathOperation.Neg,
+    MathOperation.Square,
+    MathOperation.Hardtanh,
+    MathOperation.Hardsigmoid,
+    MathOperation.Hardswish,
+    MathOperation.Threshold,
+    MathOperation.Sign,
+    MathOperation.Fill,
+]
+
+
+@skip_for_quasar
+@parametrize(
+    test_name="sfpu_common_activations_test",
+    formats=input_output_formats(
+        [DataFormat.Float32, DataFormat.Float16, DataFormat.Float16_b]
+    ),
+    mathop=COMMON_ACTIVATIONS,
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+)
+def test_sfpu_common_activations(test_name, formats, mathop, dest_acc):
+    if dest_acc == DestAccumulation.No and get_chip_architecture() == (
+        ChipArchitecture.BLACKHOLE
+    ):
+        if formats.input_format == DataFormat.Float16 or formats == InputOutputFormat(
+            DataFormat.Float32, DataFormat.Float16
+        ):
+            pytest.skip(reason="This combination is not supported on BH architecture")
+
+    torch.manual_seed(0)
+    input_dimensions = [64, 64]
+
+    src_A, src_B, tile_cnt = generate_stimuli(
+        formats.input_format, formats.input_format, input_dimensions=input_dimensions
+    )
+    # Default stimuli are in [0.1, 1.1), spread them over [-6, 6) so both sides of
+    # every clamp, threshold and sign branch are taken
+    src_A = (src_A - 0.6) * 12
+
+    generate_golden = get_golden_generator(UnarySFPUGolden)
+    golden_tensor = generate_golden(
+        mathop, src_A, formats.output_format, dest_acc, formats.input_format
+    )
+
+    unpack_to_dest = (
+        formats.input_format.is_32_bit() and dest_acc == DestAccumulation.Yes
+    )
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": dest_acc,
+        "input_A_dimensions": input_dimensions,
+        "input_B_dimensions": input_dimensions,
+        "mathop": mathop,
+        "unpack_to_dest": unpack_to_dest,
+        "tile_cnt": tile_cnt,
+    }
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        src_A,
+        src_B,
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=tile_cnt,
+        tile_count_B=tile_cnt,
+    )
+
+    run_test(test_config)
+
+    res_from_L1 = collect_results(formats, tile_count=tile_cnt, address=res_address)
+    assert len(res_from_L1) == len(golden_tensor)
+
+    res_tensor = torch.tensor(res_from_L1, dtype=format_dict[formats.output_format])
+
+    assert passed_test(golden_tensor, res_tensor, formats.output_format)
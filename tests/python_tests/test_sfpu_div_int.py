@@ -0,0 +1,141 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import itertools
+
+import pytest
+import torch
+from helpers.chip_architecture import ChipArchitecture, get_chip_architecture
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat
+from helpers.golden_generators import IntDivGolden, get_golden_generator
+from helpers.llk_params import DestAccumulation, IntDivRounding, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.test_config import run_test
+
+ELEMENTS_PER_TILE = 1024
+TILE_COUNT = 4
+
+INT_MIN = -(2**31)
+
+
+def int_range(data_format):
+    """
+    The values Dest holds in data_format. Wormhole keeps Int32 in sign-magnitude, which has no -2^31,
+    Blackhole in 2's complement.
+    """
+    if data_format == DataFormat.UInt32:
+        return 0, 2**32 - 1
+    if get_chip_architecture() == ChipArchitecture.WORMHOLE:
+        return INT_MIN + 1, 2**31 - 1
+    return INT_MIN, 2**31 - 1
+
+
+# Values around the power-of-two boundaries of the quotient, the remainder and the steps' compare
+EDGES = [0, 1, 2, 3, 7, 8, 255, 256, 65535, 65536, 2**24 + 1, 2**31 - 1]
+UNSIGNED_EDGES = [2**31, 2**31 + 1, 2**32 - 2, 2**32 - 1]
+
+# None divides by a tile of divisors, the rest are scalar divisors: 1, 16 and -2^31 take the power-of-two
+# path, 2^31 + 5 the single compare, 0 the division by 0 and -1 the overflowing -2^31 / -1
+DIVISORS = [None, 1, 3, 16, 1000003, 0, -1, -7, -65536, INT_MIN, 2**31 + 5]
+
+
+def div_int_stimuli(data_format):
+    """
+    Every pair of edge values, then random dividends over the whole range against divisors of random
+    bit length, so that every quotient length comes up. Where Dest holds -2^31, it is an edge value too.
+    """
+    torch.manual_seed(0)
+    low, high = int_range(data_format)
+    edges = torch.tensor(EDGES, dtype=torch.int64)
+    if data_format == DataFormat.Int32:
+        edges = torch.cat([edges, -edges[1:]])
+        if low == INT_MIN:
+            edges = torch.cat([edges, torch.tensor([INT_MIN])])
+    else:
+        edges = torch.cat([edges, torch.tensor(UNSIGNED_EDGES, dtype=torch.int64)])
+    pairs = torch.tensor(list(itertools.product(edges.tolist(), repeat=2)))
+
+    count = TILE_COUNT * ELEMENTS_PER_TILE - len(pairs)
+    dividends = torch.randint(low, high + 1, (count,), dtype=torch.int64)
+    bits = torch.randint(0, 33, (count,), dtype=torch.int64)
+    divisors = torch.randint(0, 2**32, (count,), dtype=torch.int64) % torch.pow(2, bits)
+    if data_format == DataFormat.Int32:
+        signs = torch.randint(0, 2, (count,), dtype=torch.int64) * 2 - 1
+        divisors = torch.clamp(divisors * signs, min=low, max=high)
+
+    return torch.cat([pairs[:, 0], dividends]), torch.cat([pairs[:, 1], divisors])
+
+
+@parametrize(
+    test_name="sfpu_div_int_test",
+    formats=input_output_formats(
+        [DataFormat.Int32, DataFormat.UInt32],
+        same=True,
+    ),
+    rounding=[IntDivRounding.Trunc, IntDivRounding.Floor],
+    divisor=DIVISORS,
+)
+def test_sfpu_div_int(test_name, formats, rounding, divisor):
+    low, high = int_range(formats.input_format)
+    if formats.input_format == DataFormat.UInt32 and rounding == IntDivRounding.Floor:
+        pytest.skip("Floor and Trunc are the same for UInt32")
+    if divisor is not None and not low <= divisor <= high:
+        pytest.skip("Divisor outside of the format's range")
+
+    dividends, divisors = div_int_stimuli(formats.input_format)
+    if divisor is not None:
+        divisors = torch.full_like(dividends, divisor)
+
+    generate_golden = get_golden_generator(IntDivGolden)
+    golden_quotient, golden_remainder = generate_golden(
+        dividends, divisors, rounding, formats.input_format
+    )
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": DestAccumulation.Yes,
+        "input_A_dimensions": [32, 32 * TILE_COUNT],
+        "input_B_dimensions": [32, 32 * TILE_COUNT],
+        "unpack_to_dest": True,
+        "int_div_rounding": rounding,
+        "int_div_divisor": divisor,
+        "tile_cnt": TILE_COUNT,
+    }
+
+    # Every input tile has a quotient and a remainder tile
+    torch_format = format_dict[formats.input_format]
+    res_address = write_stimuli_to_l1(
+        test_config,
+        dividends.to(torch_format),
+        divisors.to(torch_format),
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=TILE_COUNT,
+        tile_count_B=TILE_COUNT,
+        tile_count_res=2 * TILE_COUNT,
+    )
+
+    run_test(test_config)
+
+    res_from_L1 = collect_results(
+        formats, tile_count=2 * TILE_COUNT, address=res_address
+    )
+    res_tiles = torch.tensor(res_from_L1, dtype=torch.int64).view(
+        TILE_COUNT, 2, ELEMENTS_PER_TILE
+    )
+    res_quotient = res_tiles[:, 0].flatten()
+    res_remainder = res_tiles[:, 1].flatten()
+
+    # Integer division is exact
+    for name, res, golden in [
+        ("quotient", res_quotient, golden_quotient),
+        ("remainder", res_remainder, golden_remainder),
+    ]:
+        mismatches = (res != golden).nonzero().flatten()
+        assert len(mismatches) == 0, (
+            f"{len(mismatches)} {name} mismatches, first {dividends[mismatches[0]].item()} / "
+            f"{divisors[mismatches[0]].item()} = {res[mismatches[0]].item()}, "
+            f"expected {golden[mismatches[0]].item()}"
+        )
@@ -0,0 +1,149 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat
+from helpers.golden_generators import GatherGolden, get_golden_generator
+from helpers.llk_params import DestAccumulation, GatherOperation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.test_config import run_test
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import ROUNDING_RTOL, assert_within_tolerance
+
+ELEMENTS_PER_TILE = 1024
+TILE_DIM = 32
+
+# Source and output tiles of each operation, together within half of a 32-bit Dest
+TILES = {
+    GatherOperation.GatherRows: (2, 2),
+    GatherOperation.GatherColumns: (2, 1),
+    GatherOperation.ScatterRows: (1, 2),
+    GatherOperation.ScatterAddRows: (2, 1),
+}
+
+# Indices past every source and output, 32-bit ones also past the 16-bit range
+INVALID_INDICES = {
+    DataFormat.UInt16: [60000],
+    DataFormat.UInt32: [60000, 1 << 20],
+}
+
+
+def gather_stimuli(operation, index_format, input_format):
+    """
+    Source rows (columns for GatherColumns) stacked over the source tiles, and the indices: random for
+    gathers and scatter-add, a permutation for scatter. A few indices in every operation are invalid.
+    """
+    torch.manual_seed(0)
+    src_tiles, dst_tiles = TILES[operation]
+    src_rows, dst_rows = src_tiles * TILE_DIM, dst_tiles * TILE_DIM
+
+    if operation == GatherOperation.GatherColumns:
+        source = torch.rand(TILE_DIM, src_rows) * 2 - 1
+        indices = torch.randint(0, src_rows, (TILE_DIM,))
+    elif operation == GatherOperation.GatherRows:
+        source = torch.rand(src_rows, TILE_DIM) * 2 - 1
+        indices = torch.randint(0, src_rows, (dst_rows,))
+    elif operation == GatherOperation.ScatterRows:
+        source = torch.rand(src_rows, TILE_DIM) * 2 - 1
+        indices = torch.randperm(dst_rows)[:src_rows]
+    else:
+        source = torch.rand(src_rows, TILE_DIM) * 2 - 1
+        indices = torch.randint(0, dst_rows, (src_rows,))
+
+    invalid = torch.tensor(INVALID_INDICES[index_format])
+    positions = torch.randperm(len(indices))[: 2 * len(invalid)]
+    indices[positions] = invalid.repeat(2)
+    return source.to(format_dict[input_format]), indices
+
+
+@parametrize(
+    test_name="sfpu_gather_test",
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    operation=list(TILES),
+    index_format=[DataFormat.UInt16, DataFormat.UInt32],
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+)
+def test_sfpu_gather(test_name, formats, operation, index_format, dest_acc):
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("Float32 is unpacked to a 32-bit Dest")
+
+    src_tiles, dst_tiles = TILES[operation]
+    source, indices = gather_stimuli(operation, index_format, formats.input_format)
+
+    generate_golden = get_golden_generator(GatherGolden)
+    golden_tensor = generate_golden(
+        operation, source, indices, dst_tiles * TILE_DIM, formats.output_format
+    )
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": dest_acc,
+        "input_A_dimensions": list(source.shape),
+        "input_B_dimensions": list(source.shape),
+        "unpack_to_dest": formats.input_format.is_32_bit(),
+        "gather_operation": operation,
+        "gather_index_format": index_format,
+        "gather_src_tiles": src_tiles,
+        "gather_dst_tiles": dst_tiles,
+        "tile_cnt": src_tiles,
+    }
+
+    # The indices take less than a tile, written as one whole tile
+    index_tiles = -(-len(indices) // ELEMENTS_PER_TILE)
+    padded_indices = torch.full(
+        (index_tiles * ELEMENTS_PER_TILE,), INVALID_INDICES[index_format][0]
+    )
+    padded_indices[: len(indices)] = indices
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        tilize_block(
+            source.flatten(), list(source.shape), formats.input_format
+        ).flatten(),
+        padded_indices,
+        formats.input_format,
+        index_format,
+        tile_count_A=src_tiles,
+        tile_count_B=index_tiles,
+        tile_count_res=dst_tiles,
+    )
+
+    run_test(test_config)
+
+    res_from_L1 = collect_results(formats, tile_count=dst_tiles, address=res_address)
+    assert len(res_from_L1) == golden_tensor.numel()
+
+    torch_format = format_dict[formats.output_format]
+    res_tensor = untilize_block(
+        torch.tensor(res_from_L1, dtype=torch_format),
+        formats.output_format,
+        list(golden_tensor.shape),
+    )
+
+    # Gathers and scatters move data bit-exactly, the zero rows of invalid indices check the clear of
+    # the output tiles. Scatter-add sums in Dest: a 32-bit Dest rounds once on packing, a 16-bit one
+    # rounds every partial sum, each by at most an ulp of the sum of magnitudes.
+    if operation == GatherOperation.ScatterAddRows and dest_acc == DestAccumulation.Yes:
+        assert_within_tolerance(golden_tensor, res_tensor, formats.output_format)
+    elif operation == GatherOperation.ScatterAddRows:
+        magnitude = generate_golden(
+            operation, source.abs(), indices, dst_tiles * TILE_DIM, DataFormat.Float32
+        ).to(torch.float64)
+        adds = int(torch.bincount(indices[indices < dst_tiles * TILE_DIM]).max())
+        rtol = ROUNDING_RTOL[formats.output_format]
+        assert_within_tolerance(
+            golden_tensor,
+            res_tensor,
+            formats.output_format,
+            atol=adds * rtol * magnitude,
+        )
+    else:
+        assert_within_tolerance(
+            golden_tensor, res_tensor, formats.output_format, rtol=0, atol=0
+        )
@@ -0,0 +1,90 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat
+from helpers.golden_generators import LinearScanGolden, get_golden_generator
+from helpers.llk_params import DestAccumulation, format_dict
+from helpers.param_config import input_output_formats, parametrize
+from helpers.test_config import run_test
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import ROUNDING_RTOL, assert_within_tolerance
+
+TILE_DIM = 32
+# Time tiles of the sequence, the state is carried across them and across Dest sections
+TIME_TILES = 4
+
+# Whether b is read, and the initial state: a recurrence from a nonzero state, and the running product of a
+SCANS = {
+    "recurrence": (True, 0.5),
+    "product": (False, 1.0),
+}
+
+# Absolute tolerance for the outputs cancelling to near 0
+ATOL = 2.0**-14
+
+
+@parametrize(
+    test_name="sfpu_linear_scan_test",
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    scan=list(SCANS),
+)
+def test_sfpu_linear_scan(test_name, formats, scan):
+
+    with_b, initial_state = SCANS[scan]
+    torch_format = format_dict[formats.input_format]
+    dimensions = [TIME_TILES * TILE_DIM, TILE_DIM]
+
+    # Decays close to 1 keep both h and the running product of a in range over the whole sequence
+    torch.manual_seed(0)
+    a = (0.9 + 0.1 * torch.rand(dimensions)).to(torch_format)
+    b = (torch.rand(dimensions) * 2 - 1).to(torch_format)
+
+    generate_golden = get_golden_generator(LinearScanGolden)
+    golden_tensor = generate_golden(
+        a, b if with_b else None, initial_state, formats.output_format
+    )
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": DestAccumulation.Yes,
+        "input_A_dimensions": dimensions,
+        "input_B_dimensions": dimensions,
+        "unpack_to_dest": formats.input_format.is_32_bit(),
+        "scan_tiles": TIME_TILES,
+        "scan_with_b": with_b,
+        "scan_initial_state": initial_state,
+        "tile_cnt": TIME_TILES,
+    }
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        tilize_block(a.flatten(), dimensions, formats.input_format).flatten(),
+        tilize_block(b.flatten(), dimensions, formats.input_format).flatten(),
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=TIME_TILES,
+        tile_count_B=TIME_TILES,
+    )
+
+    run_test(test_config)
+
+    res_from_L1 = collect_results(formats, tile_count=TIME_TILES, address=res_address)
+    assert len(res_from_L1) == golden_tensor.numel()
+
+    res_tensor = untilize_block(
+        torch.tensor(res_from_L1, dtype=format_dict[formats.output_format]),
+        formats.output_format,
+        dimensions,
+    )
+
+    # Rounding to the output format, or the error of one fp32 step per time step when that is larger
+    rtol = max(ROUNDING_RTOL[formats.output_format], TIME_TILES * TILE_DIM * 2.0**-23)
+    assert_within_tolerance(
+        golden_tensor, res_tensor, formats.output_format, rtol=rtol, atol=ATOL
+    )
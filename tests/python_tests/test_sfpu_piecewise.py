@@ -0,0 +1,109 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+from functools import lru_cache
+
+import torch
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat
+from helpers.llk_params import ApproximationMode, DestAccumulation, format_dict
+from helpers.minimax import Format
+from helpers.param_config import input_output_formats, parametrize
+from helpers.piecewise import ACTIVATIONS, fit_piecewise
+from helpers.test_config import run_test
+from helpers.utils import ROUNDING_ATOL, assert_within_tolerance
+
+ELEMENTS_PER_TILE = 1024
+TILE_CNT = 4
+STIMULI_RANGE = 12.0
+
+# Fitted interval of each activation, the asymptotes cover the rest of the stimuli
+INTERVALS = {
+    "mish": (-10.0, 8.0),
+    "softplus": (-10.0, 10.0),
+    "hardswish": (-3.0, 3.0),
+    "gelu": (-5.0, 5.0),
+}
+SEGMENTS = {1: 16, 2: 8}
+
+
+@lru_cache(maxsize=None)
+def piecewise_table(activation, order):
+    lo, hi = INTERVALS[activation]
+    return fit_piecewise(
+        ACTIVATIONS[activation], lo, hi, order, SEGMENTS[order], Format.BFLOAT16
+    )
+
+
+def piecewise_stimuli(table, input_format):
+    """Uniform over the stimuli range, plus every breakpoint and its neighbours"""
+    torch.manual_seed(0)
+    breakpoints = torch.tensor(table.breakpoints, dtype=torch.float64)
+    edges = torch.cat(
+        [breakpoints, breakpoints * (1 - 2.0**-10), breakpoints - 2.0**-10]
+    )
+    uniform = torch.empty(
+        TILE_CNT * ELEMENTS_PER_TILE - len(edges), dtype=torch.float64
+    ).uniform_(-STIMULI_RANGE, STIMULI_RANGE)
+    return torch.cat([edges, uniform]).to(format_dict[input_format])
+
+
+@parametrize(
+    test_name="sfpu_piecewise_test",
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    activation=list(INTERVALS),
+    order=[1, 2],
+    dest_acc=[DestAccumulation.Yes],
+)
+def test_sfpu_piecewise(test_name, formats, activation, order, dest_acc):
+
+    table = piecewise_table(activation, order)
+    src_A = piecewise_stimuli(table, formats.input_format)
+    inputs = src_A.to(torch.float64).tolist()
+
+    function = ACTIVATIONS[activation].function
+    golden = torch.tensor([function(x) for x in inputs], dtype=torch.float64)
+    host = torch.tensor([table.evaluate(x) for x in inputs], dtype=torch.float64)
+    fit_error = (host - golden).abs().max().item()
+
+    input_dimensions = [32, 32 * TILE_CNT]
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": dest_acc,
+        "input_A_dimensions": input_dimensions,
+        "input_B_dimensions": input_dimensions,
+        "approx_mode": ApproximationMode.No,
+        "unpack_to_dest": formats.input_format.is_32_bit(),
+        "piecewise_table": table,
+        "tile_cnt": TILE_CNT,
+    }
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        src_A,
+        src_A,
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=TILE_CNT,
+        tile_count_B=TILE_CNT,
+    )
+
+    run_test(test_config)
+
+    res_from_L1 = collect_results(formats, tile_count=TILE_CNT, address=res_address)
+    assert len(res_from_L1) == len(golden)
+
+    res_tensor = torch.tensor(res_from_L1, dtype=torch.float64)
+
+    # The device has to match the host reference up to rounding, so the fit error is the whole budget
+    assert_within_tolerance(
+        golden,
+        res_tensor,
+        formats.output_format,
+        atol=fit_error + ROUNDING_ATOL,
+        inputs=src_A,
+    )
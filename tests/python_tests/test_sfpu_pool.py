@@ -0,0 +1,216 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import math
+
+import pytest
+import torch
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.golden_generators import PoolGolden, get_golden_generator
+from helpers.llk_params import (
+    DestAccumulation,
+    ReducePool,
+    format_dict,
+    format_tile_sizes,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.test_config import run_test
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import assert_within_tolerance
+
+TILE_DIM = 32
+CHANNELS = 32
+# Only the last output positions are pooled, so the larger inputs stay in L1
+TESTED_OUTPUTS = 16
+
+# Indices are integer tiles, UInt16 ones are loaded as LO16 on 16-bit Dest and Int32 ones as INT32
+INDEX_FORMATS = {
+    DestAccumulation.No: DataFormat.UInt16,
+    DestAccumulation.Yes: DataFormat.Int32,
+}
+
+# kernel, stride, dilation, padding; every one has at least 4 x 4 output positions on 8 x 8
+POOLS = {
+    "2x2": (2, 2, 1, 0),
+    "3x3": (3, 2, 1, 1),
+    "3x3_dilated": (3, 1, 2, 0),
+    "5x5": (5, 2, 1, 2),
+    "7x7": (7, 2, 1, 3),
+}
+
+
+def pool_windows(x, kernel, stride, dilation, padding, pad_value):
+    """
+    What the reader of a pooling kernel stages in L1: for every output position, its window as rows of
+    channels, padded to whole tiles. Returns the windows [outputs, window_tiles * 32, channels] and the
+    number of elements of each window inside the input.
+    """
+    channels = x.shape[0]
+    padded = torch.nn.functional.pad(x, (padding,) * 4, value=pad_value)
+    columns = torch.nn.functional.unfold(
+        padded.unsqueeze(0), kernel, dilation=dilation, stride=stride
+    )[0]
+    windows = columns.view(channels, kernel * kernel, -1).permute(2, 1, 0)
+
+    window_tiles = math.ceil(kernel * kernel / TILE_DIM)
+    staged = torch.full(
+        (windows.shape[0], window_tiles * TILE_DIM, channels),
+        pad_value,
+        dtype=windows.dtype,
+    )
+    staged[:, : kernel * kernel] = windows
+
+    inside = torch.nn.functional.unfold(
+        torch.nn.functional.pad(torch.ones(1, 1, *x.shape[1:]), (padding,) * 4),
+        kernel,
+        dilation=dilation,
+        stride=stride,
+    )[0].sum(dim=0)
+    return staged, inside
+
+
+def tilize_windows(windows, data_format):
+    """Every 32 rows of a window as one tile, the tiles of a window consecutive"""
+    tiles = windows.reshape(-1, TILE_DIM, windows.shape[-1])
+    return torch.cat(
+        [
+            tilize_block(tile.flatten(), [TILE_DIM, TILE_DIM], data_format).flatten()
+            for tile in tiles
+        ]
+    )
+
+
+@parametrize(
+    test_name="sfpu_pool_test",
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    dest_acc=[DestAccumulation.No, DestAccumulation.Yes],
+    pool=[ReducePool.Max, ReducePool.Average],
+    window=list(POOLS),
+    count_include_pad=[True, False],
+    # 20 x 20 has 400 input positions, past what a bfloat16 index could hold exactly
+    input_size=[8, 20],
+)
+def test_sfpu_pool(
+    test_name, formats, dest_acc, pool, window, count_include_pad, input_size
+):
+    if pool == ReducePool.Max and not count_include_pad:
+        pytest.skip("count_include_pad only applies to average pooling")
+    if formats.input_format == DataFormat.Float32 and dest_acc == DestAccumulation.No:
+        pytest.skip("Float32 needs 32-bit Dest")
+    if (
+        pool == ReducePool.Max
+        and formats.input_format == DataFormat.Float16_b
+        and dest_acc == DestAccumulation.Yes
+    ):
+        pytest.skip(
+            "Int32 indices are unpacked to Dest, which Float16_b values are not"
+        )
+
+    kernel, stride, dilation, padding = POOLS[window]
+    torch_format = format_dict[formats.input_format]
+    index_format = INDEX_FORMATS[dest_acc]
+
+    torch.manual_seed(0)
+    x = (torch.rand(CHANNELS, input_size, input_size) * 2 - 1).to(torch_format)
+
+    generate_golden = get_golden_generator(PoolGolden)
+    golden = generate_golden(
+        pool,
+        x,
+        kernel,
+        stride,
+        dilation,
+        padding,
+        formats.output_format,
+        count_include_pad,
+    )
+
+    pad_value = -math.inf if pool == ReducePool.Max else 0.0
+    values, inside = pool_windows(
+        x.to(torch.float64), kernel, stride, dilation, padding, pad_value
+    )
+    values, inside = values[-TESTED_OUTPUTS:], inside[-TESTED_OUTPUTS:]
+    outputs, window_rows, _ = values.shape
+    window_tiles = window_rows // TILE_DIM
+    divisors = [kernel * kernel] * outputs if count_include_pad else inside.tolist()
+
+    # Input position of every window element, the padding is never picked
+    positions = torch.arange(input_size * input_size, dtype=torch.float64)
+    positions = positions.view(1, input_size, input_size).expand(CHANNELS, -1, -1)
+    indices, _ = pool_windows(positions, kernel, stride, dilation, padding, 0.0)
+    indices = indices[-TESTED_OUTPUTS:]
+
+    # Max pooling packs the values tiles of all output positions, then their indices tiles
+    tile_count = outputs * window_tiles
+    result_tiles = 2 * outputs if pool == ReducePool.Max else outputs
+    index_stimuli = tilize_windows(indices.to(format_dict[index_format]), index_format)
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": dest_acc,
+        "input_A_dimensions": [TILE_DIM, TILE_DIM * tile_count],
+        "input_B_dimensions": [TILE_DIM, TILE_DIM * tile_count],
+        "unpack_to_dest": formats.input_format.is_32_bit(),
+        "pool_type": pool,
+        "pool_window_size": kernel * kernel,
+        "pool_window_tiles": window_tiles,
+        "pool_divisors": divisors,
+        "pool_index_format": index_format,
+        "tile_cnt": tile_count,
+    }
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        tilize_windows(values.to(torch_format), formats.input_format),
+        index_stimuli,
+        formats.input_format,
+        index_format,
+        tile_count_A=tile_count,
+        tile_count_B=tile_count,
+        tile_count_res=result_tiles,
+    )
+
+    run_test(test_config)
+
+    def read_row_0(data_format, tile_count, address):
+        """Row 0 of every result tile, where the kernel leaves the result of its output position"""
+        res_from_L1 = collect_results(
+            InputOutputFormat(data_format, data_format),
+            tile_count=tile_count,
+            address=address,
+        )
+        return untilize_block(
+            torch.tensor(res_from_L1, dtype=format_dict[data_format]),
+            data_format,
+            [tile_count * TILE_DIM, TILE_DIM],
+        ).view(tile_count, TILE_DIM, TILE_DIM)[:, 0]
+
+    res_values = read_row_0(formats.output_format, outputs, res_address)
+
+    if pool == ReducePool.Max:
+        golden_values, golden_indices = golden
+        golden_values = golden_values[-TESTED_OUTPUTS:]
+        golden_indices = golden_indices[-TESTED_OUTPUTS:]
+        # The indices tiles take as many bytes as the values tiles
+        indices_address = (
+            res_address + outputs * format_tile_sizes[formats.output_format]
+        )
+        res_values = res_values.to(torch.float64)
+        res_indices = read_row_0(index_format, outputs, indices_address).to(torch.int64)
+
+        assert torch.equal(res_values, golden_values.to(torch.float64))
+        # Ties may resolve to any of the tied elements, so the index has to point at the max
+        picked = x.to(torch.float64).flatten(1).gather(1, res_indices.T).T
+        assert torch.equal(
+            picked, res_values
+        ), f"{int((res_indices != golden_indices).sum())} indices differ from max_pool2d"
+    else:
+        # The average is rounded once to the output format
+        assert_within_tolerance(
+            golden[-TESTED_OUTPUTS:], res_values, formats.output_format
+        )
@@ -1,6 +1,7 @@
 # SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
 # SPDX-License-Identifier: Apache-2.0
 
+import math
 
 import pytest
 import torch
@@ -15,16 +16,18 @@ from helpers.llk_params import (
     DestAccumulation,
     MathOperation,
     ReducePool,
+    ReduceSummation,
     format_dict,
 )
 from helpers.param_config import (
     input_output_formats,
     parametrize,
 )
+from helpers.profiler import Profiler
 from helpers.stimuli_generator import generate_stimuli
-from helpers.test_config import run_test
-from helpers.tilize_untilize import untilize
-from helpers.utils import passed_test
+from helpers.test_config import ProfilerBuild, run_test
+from helpers.tilize_untilize import tilize_block, untilize
+from helpers.utils import assert_within_tolerance, passed_test
 
 max_tiles = 4  # max number of tiles in 32-bit dest is 4
 tile_dim = 32
@@ -143,3 +146,178 @@ def test_sfpu_reduce(
     reduce_tensor = torch.tensor(reduce_result, dtype=torch_format)
     golden_tensor = torch.tensor(golden_result, dtype=torch_format)
     assert passed_test(golden_tensor, reduce_tensor, formats.output_format)
+
+
+# A whole Dest section of tiles is one tall column: 4 tiles of 32-bit Dest, 8 of 16-bit Dest
+SUMMATION_TILES = {DataFormat.Float32: 4, DataFormat.Float16_b: 8}
+# A streamed column, 2048 elements tall, goes through the Dest section a section at a time
+STREAMED_TILES = 64
+
+# Relative size of an ulp of the output format, and the rounding error of the fp32 sum of one tile of its inputs:
+# a tile of Float16_b inputs sums exactly in fp32, one of Float32 inputs in a 5-level tree
+ULP = {DataFormat.Float32: 2.0**-23, DataFormat.Float16_b: 2.0**-7}
+TILE_SUM_ULPS = {DataFormat.Float32: 3, DataFormat.Float16_b: 0}
+
+
+def summation_calls(tile_count, data_format):
+    """
+    Calls of the reduce over a column of tile_count tiles: one per Dest section, every one past the first adding
+    its tiles after the tile holding the running values, so one tile fewer
+    """
+    section_tiles = SUMMATION_TILES[data_format]
+    return 1 + math.ceil(max(tile_count - section_tiles, 0) / (section_tiles - 1))
+
+
+def summation_ulps(summation, tile_count, data_format):
+    """Bound in ulps on the rounding error of adding up tile_count partial sums in Dest"""
+    section_tiles = SUMMATION_TILES[data_format]
+    calls = summation_calls(tile_count, data_format)
+    match summation:
+        case ReduceSummation.Naive:
+            return tile_count
+        case ReduceSummation.Pairwise:
+            return math.ceil(math.log2(min(tile_count, section_tiles))) + calls
+        case ReduceSummation.Kahan:
+            # With the second-order term of Kahan's bound, n * u^2 for a unit roundoff u of half an ulp
+            return 1 + tile_count * ULP[data_format] / 4
+
+
+def run_reduce_summation(
+    test_name,
+    formats,
+    reduce_pool,
+    summation,
+    tile_count,
+    profiler_build=ProfilerBuild.No,
+):
+    """Reduces a column of tile_count tiles, returns its result, the float64 golden and the test config"""
+    torch_format = format_dict[formats.input_format]
+
+    # Positive values so every step of the running sum rounds at the magnitude of the total
+    torch.manual_seed(0)
+    src_A = (torch.rand(tile_count * tile_dim, tile_dim) + 0.5).to(torch_format)
+
+    golden = src_A.to(torch.float64).sum(dim=0)
+    if reduce_pool == ReducePool.Average:
+        golden /= tile_count * tile_dim
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": (
+            DestAccumulation.Yes
+            if formats.input_format.is_32_bit()
+            else DestAccumulation.No
+        ),
+        "input_A_dimensions": [tile_count * tile_dim, tile_dim],
+        "input_B_dimensions": [tile_count * tile_dim, tile_dim],
+        "mathop": MathOperation.ReduceColumn,
+        "pool_type": reduce_pool,
+        "reduce_summation": summation,
+        "unpack_to_dest": formats.input_format.is_32_bit(),
+        "tile_cnt": tile_count,
+    }
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        torch.cat(
+            [
+                tilize_block(tile.flatten(), [tile_dim, tile_dim], formats.input_format)
+                for tile in src_A.view(tile_count, tile_dim, tile_dim)
+            ]
+        ).flatten(),
+        torch.zeros(tile_dim * tile_dim, dtype=torch_format),
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=tile_count,
+        tile_count_B=1,
+        tile_count_res=1,
+    )
+    run_test(test_config, profiler_build=profiler_build)
+
+    res_from_L1 = collect_results(formats, tile_count=1, address=res_address)
+    result = untilize(
+        torch.tensor(res_from_L1, dtype=format_dict[formats.output_format]),
+        formats.output_format,
+    ).flatten()[:tile_dim]
+    return result.to(torch.float64), golden, test_config
+
+
+@parametrize(
+    test_name="sfpu_reduce_summation_test",
+    formats=input_output_formats(
+        [DataFormat.Float16_b, DataFormat.Float32],
+        same=True,
+    ),
+    reduce_pool=[ReducePool.Sum, ReducePool.Average],
+    summation=[
+        ReduceSummation.Naive,
+        ReduceSummation.Pairwise,
+        ReduceSummation.Kahan,
+    ],
+    streamed=[False, True],
+)
+def test_sfpu_reduce_summation(test_name, formats, reduce_pool, summation, streamed):
+    if streamed and reduce_pool == ReducePool.Average:
+        pytest.skip("A streamed column is summed only")
+
+    tile_count = STREAMED_TILES if streamed else SUMMATION_TILES[formats.input_format]
+    result, golden, _ = run_reduce_summation(
+        test_name, formats, reduce_pool, summation, tile_count
+    )
+
+    ulps = summation_ulps(summation, tile_count, formats.input_format)
+    ulps += TILE_SUM_ULPS[formats.input_format]
+    assert_within_tolerance(
+        golden,
+        result,
+        formats.output_format,
+        rtol=ulps * ULP[formats.output_format],
+        atol=0,
+    )
+
+
+@parametrize(
+    test_name="sfpu_reduce_summation_test",
+    formats=input_output_formats([DataFormat.Float16_b], same=True),
+    tile_count=[SUMMATION_TILES[DataFormat.Float16_b], STREAMED_TILES],
+)
+def test_sfpu_reduce_summation_cost(test_name, formats, tile_count):
+    """
+    Accuracy against cycles of the summation modes, on a 16-bit Dest where a naive sum loses the most, over a section
+    and over a 2048 elements tall column
+    """
+    calls = summation_calls(tile_count, formats.input_format)
+    error = {}
+    cycles = {}
+    for summation in ReduceSummation:
+        result, golden, test_config = run_reduce_summation(
+            test_name,
+            formats,
+            ReducePool.Sum,
+            summation,
+            tile_count,
+            profiler_build=ProfilerBuild.Yes,
+        )
+        error[summation] = ((result - golden).abs() / golden.abs()).max().item()
+
+        # One zone per call of the reduce
+        runtime = Profiler.get_data(test_config["testname"])
+        zones = runtime.math().zones().marker("REDUCE_SUMMATION").frame()
+        assert (
+            len(zones) == calls
+        ), f"Expected {calls} REDUCE_SUMMATION zones, got {len(zones)}"
+        cycles[summation] = zones["duration"].sum()
+
+    summary = ", ".join(
+        f"{summation.name}: {error[summation]:.2e} in {cycles[summation]} cycles"
+        for summation in ReduceSummation
+    )
+    assert error[ReduceSummation.Kahan] <= error[ReduceSummation.Naive], summary
+    for summation in (ReduceSummation.Pairwise, ReduceSummation.Kahan):
+        # A store and a load per tile more than the naive sum, next to the 8 loads of the tile itself
+        assert (
+            cycles[ReduceSummation.Naive]
+            < cycles[summation]
+            < 2 * cycles[ReduceSummation.Naive]
+        ), summary
@@ -0,0 +1,149 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import pytest
+import torch
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat
+from helpers.golden_generators import RopeGolden, get_golden_generator
+from helpers.llk_params import (
+    ApproximationMode,
+    DestAccumulation,
+    RopeAngles,
+    RopeLayout,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.test_config import run_test
+from helpers.tilize_untilize import tilize_block, untilize_block
+from helpers.utils import passed_test
+
+ROWS = 32
+ROPE_BASE = 10000.0
+FIRST_POSITION = 1000
+# The kernel's documented range is |theta| < 2^16 * pi / 2, long-context rows reach its edge
+MAX_ANGLE = 1e5
+LONG_CONTEXT_POSITION = 100000
+
+
+def rope_stimuli(rope_layout, rope_angles, head_dim, input_format):
+    """
+    x in [-1, 1], angles (or positions) and inverse frequencies in row-major [ROWS, head_dim],
+    both elements of a pair get the same angle as the model's cos/sin caches hold them.
+    The first half of the rows has short angles, the second half large ones: precomputed
+    angles up to MAX_ANGLE, positions from LONG_CONTEXT_POSITION.
+    """
+    torch.manual_seed(0)
+    torch_format = format_dict[input_format]
+    lo, hi = RopeGolden.pairs(rope_layout, head_dim)
+
+    def per_pair(values):
+        full = torch.empty(ROWS, head_dim)
+        full[:, lo] = values
+        full[:, hi] = values
+        return full.to(torch_format)
+
+    pair_index = torch.arange(head_dim // 2, dtype=torch.float64)
+    inv_freq = per_pair(
+        (ROPE_BASE ** (-2 * pair_index / head_dim)).float().expand(ROWS, -1)
+    )
+    half = ROWS // 2
+    if rope_angles == RopeAngles.Precomputed:
+        scale = torch.tensor([100.0] * half + [MAX_ANGLE] * half).unsqueeze(1)
+        angles = per_pair((torch.rand(ROWS, head_dim // 2) * 2 - 1) * scale)
+    else:
+        positions = torch.cat(
+            [
+                torch.arange(FIRST_POSITION, FIRST_POSITION + half),
+                torch.arange(LONG_CONTEXT_POSITION, LONG_CONTEXT_POSITION + half),
+            ]
+        ).float()
+        angles = per_pair(positions.unsqueeze(1).expand(-1, head_dim // 2))
+
+    x = (torch.rand(ROWS, head_dim) * 2 - 1).to(torch_format)
+    return x, angles, inv_freq
+
+
+@parametrize(
+    test_name="sfpu_rope_test",
+    formats=input_output_formats(
+        [DataFormat.Float32, DataFormat.Float16_b],
+        same=True,
+    ),
+    rope_layout=[RopeLayout.Interleaved, RopeLayout.HalfSplit],
+    rope_angles=[RopeAngles.Precomputed, RopeAngles.FromPositions],
+    head_dim=[32, 64],
+    approx_mode=[ApproximationMode.No, ApproximationMode.Yes],
+)
+def test_sfpu_rope(test_name, formats, rope_layout, rope_angles, head_dim, approx_mode):
+    if rope_angles == RopeAngles.FromPositions and head_dim == 64:
+        pytest.skip(
+            "x, positions and inverse frequencies of two tiles exceed half of Dest"
+        )
+
+    x, angles, inv_freq = rope_stimuli(
+        rope_layout, rope_angles, head_dim, formats.input_format
+    )
+
+    generate_golden = get_golden_generator(RopeGolden)
+    golden_tensor = generate_golden(
+        x,
+        angles,
+        rope_layout,
+        formats.output_format,
+        inv_freq if rope_angles == RopeAngles.FromPositions else None,
+    )
+
+    dimensions = [ROWS, head_dim]
+    tile_cnt = head_dim // 32
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": DestAccumulation.Yes,
+        "approx_mode": approx_mode,
+        "input_A_dimensions": dimensions,
+        "input_B_dimensions": dimensions,
+        "unpack_to_dest": formats.input_format.is_32_bit(),
+        "rope_layout": rope_layout,
+        "rope_angles": rope_angles,
+        "tile_cnt": tile_cnt,
+    }
+
+    tilize = lambda tensor: tilize_block(
+        tensor.flatten(), dimensions, formats.input_format
+    ).flatten()
+    res_address = write_stimuli_to_l1(
+        test_config,
+        tilize(x),
+        tilize(angles),
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=tile_cnt,
+        tile_count_B=tile_cnt,
+        buffer_C=tilize(inv_freq),
+        stimuli_C_format=formats.input_format,
+        tile_count_C=tile_cnt,
+    )
+
+    run_test(test_config)
+
+    res_from_L1 = collect_results(formats, tile_count=tile_cnt, address=res_address)
+    assert len(res_from_L1) == golden_tensor.numel()
+
+    torch_format = format_dict[formats.output_format]
+    res_tensor = untilize_block(
+        torch.tensor(res_from_L1, dtype=torch_format), formats.output_format, dimensions
+    )
+
+    assert passed_test(
+        golden_tensor.flatten(), res_tensor.flatten(), formats.output_format
+    )
+
+    # passed_test's 0.05 would let a broken reduction through at large angles. The FP32 tables
+    # stay near 1e-7 over the documented range, the BF16 tables near 1e-5, bf16 output rounds at 2^-7
+    precise = (
+        formats.output_format == DataFormat.Float32
+        and approx_mode == ApproximationMode.No
+    )
+    max_error = (res_tensor.double() - golden_tensor.double()).abs().max().item()
+    assert max_error < (1e-5 if precise else 2**-6)
@@ -0,0 +1,172 @@
+# SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+# SPDX-License-Identifier: Apache-2.0
+
+import torch
+from helpers.device import collect_results, write_stimuli_to_l1
+from helpers.format_config import DataFormat, InputOutputFormat
+from helpers.golden_generators import TypecastGolden, get_golden_generator
+from helpers.llk_params import (
+    ApproximationMode,
+    DestAccumulation,
+    TypecastRounding,
+    format_dict,
+)
+from helpers.param_config import input_output_formats, parametrize
+from helpers.test_config import run_test
+
+ELEMENTS_PER_TILE = 1024
+STIMULI_COUNT = 1 << 16
+
+BIT_VIEW_DTYPES = {
+    DataFormat.Float16: (torch.int16, torch.float16),
+    DataFormat.Float16_b: (torch.int16, torch.bfloat16),
+    DataFormat.Float32: (torch.int32, torch.float32),
+}
+
+# Targets the packer has no format for are read back from their 32-bit Dest container,
+# Int16 as the saturated int32 and Tf32 as the fp32 with the dropped mantissa bits cleared
+NARROW_TARGET_PACK_FORMATS = {
+    "Int8": DataFormat.Int8,
+    "UInt8": DataFormat.UInt8,
+    "Int16": DataFormat.Int32,
+    "Tf32": DataFormat.Float32,
+}
+
+
+def typecast_stimuli(input_format, typecast_output):
+    """
+    16-bit sources are swept over every bit pattern. 32-bit sources get random bit patterns
+    plus the values sitting on rounding ties and saturation limits of every target format.
+    """
+    torch.manual_seed(0)
+
+    if input_format == DataFormat.UInt16:
+        values = torch.arange(STIMULI_COUNT, dtype=torch.float64)
+    elif input_format in [DataFormat.Float16, DataFormat.Float16_b]:
+        int_dtype, float_dtype = BIT_VIEW_DTYPES[input_format]
+        bits = torch.arange(STIMULI_COUNT, dtype=torch.int32).to(int_dtype)
+        values = bits.view(float_dtype).to(torch.float64)
+    else:
+        edges = [0.0, 0.5, 1.5, 2.5, 127.5, 128.5, 255.5, 32767.5, 65535.5]
+        edges += [2.0**24 + 1, 2.0**31 - 1, 2.0**31, 2.0**32 - 1, 2.0**32]
+        # Ties of the narrow float formats with a sticky bit below fp32 precision
+        edges += [2.0**24 + 2**16 + 1, 2.0**24 + 2**12 + 1, 2.0**31 + 2**7 + 1]
+        edges = torch.tensor(edges, dtype=torch.float64)
+        edges = torch.cat([edges, -edges, edges - 1, edges + 1])
+
+        random_count = STIMULI_COUNT - len(edges)
+        if input_format == DataFormat.Float32:
+            bits = torch.randint(
+                -(2**31), 2**31 - 1, (random_count,), dtype=torch.int32
+            )
+            random_values = bits.view(torch.float32).to(torch.float64)
+            # Keep rounding away from fp32's overflow boundary
+            random_values[random_values.abs() > 2.0**100] = 0
+        else:
+            low, high = TypecastGolden.int_range(input_format)
+            random_values = torch.randint(
+                low, high + 1, (random_count,), dtype=torch.int64
+            ).to(torch.float64)
+        values = torch.cat([edges, random_values])
+
+    # Dest flushes denormals and the fp16 conversion only covers its normal range
+    values[~torch.isfinite(values)] = 0
+    values[values.abs() < 2.0**-126] = 0
+    if typecast_output == "Float16":
+        values[(values.abs() > 65504) | (values.abs() < 2.0**-14)] = 0
+
+    if input_format.is_integer():
+        low, high = TypecastGolden.int_range(input_format)
+        values = torch.clamp(torch.trunc(values), low, high)
+    return values.to(format_dict[input_format])
+
+
+def sfpu_typecast(test_name, formats, typecast_output, rounding):
+    src_A = typecast_stimuli(formats.input_format, typecast_output)
+    tile_cnt = len(src_A) // ELEMENTS_PER_TILE
+    input_dimensions = [32, 32 * tile_cnt]
+
+    generate_golden = get_golden_generator(TypecastGolden)
+    golden_lower, golden_upper = generate_golden(
+        src_A, formats.input_format, typecast_output, rounding
+    )
+
+    test_config = {
+        "formats": formats,
+        "testname": test_name,
+        "dest_acc": DestAccumulation.Yes,
+        "input_A_dimensions": input_dimensions,
+        "input_B_dimensions": input_dimensions,
+        "approx_mode": ApproximationMode.No,
+        "unpack_to_dest": formats.input_format.is_32_bit(),
+        "typecast_rounding": rounding,
+        "typecast_output": typecast_output,
+        "tile_cnt": tile_cnt,
+    }
+
+    res_address = write_stimuli_to_l1(
+        test_config,
+        src_A,
+        src_A[:ELEMENTS_PER_TILE],
+        formats.input_format,
+        formats.input_format,
+        tile_count_A=tile_cnt,
+        tile_count_B=1,
+    )
+
+    run_test(test_config)
+
+    res_from_L1 = collect_results(formats, tile_count=tile_cnt, address=res_address)
+    assert len(res_from_L1) == len(golden_lower)
+
+    res_tensor = torch.tensor(res_from_L1, dtype=torch.float64)
+
+    # Conversions are exact, every result has to be one the reference allows
+    mismatches = (res_tensor != golden_lower) & (res_tensor != golden_upper)
+    assert not torch.any(mismatches), (
+        f"{int(mismatches.sum())} mismatches, first inputs: "
+        f"{src_A[mismatches][:8].tolist()} -> {res_tensor[mismatches][:8].tolist()}"
+    )
+
+
+ROUNDINGS = [
+    TypecastRounding.NearestEven,
+    TypecastRounding.Truncate,
+    TypecastRounding.Stochastic,
+]
+
+
+@parametrize(
+    test_name="sfpu_typecast_test",
+    formats=input_output_formats(
+        [
+            DataFormat.Float32,
+            DataFormat.Float16,
+            DataFormat.Float16_b,
+            DataFormat.Int32,
+            DataFormat.UInt32,
+            DataFormat.UInt16,
+        ]
+    ),
+    rounding=ROUNDINGS,
+)
+def test_sfpu_typecast(test_name, formats, rounding):
+    sfpu_typecast(test_name, formats, str(formats.output_format), rounding)
+
+
+@parametrize(
+    test_name="sfpu_typecast_test",
+    input_format=[
+        DataFormat.Float32,
+        DataFormat.Float16_b,
+        DataFormat.Int32,
+        DataFormat.UInt32,
+    ],
+    typecast_output=list(NARROW_TARGET_PACK_FORMATS),
+    rounding=ROUNDINGS,
+)
+def test_sfpu_typecast_narrow(test_name, input_format, typecast_output, rounding):
+    formats = InputOutputFormat(
+        input_format, NARROW_TARGET_PACK_FORMATS[typecast_output]
+    )
+    sfpu_typecast(test_name, formats, typecast_output, rounding)
@@ -16,46 +16,108 @@ uint32_t unp_cfg_context          = 0;
 uint32_t pack_sync_tile_dst_ptr   = 0;
 uint32_t math_sync_tile_dst_index = 0;
 
-#ifdef LLK_TRISC_UNPACK
-
-#include "llk_unpack_common.h"
-#include "llk_unpack_tilize.h"
-
 // the kernel algorithm is the same across all threads, with the only difference being the particular calls made to the llks
 // the high level algorithm is explained here as well as in the metal compute api where it is copied from
 // the kernel tilizes the input tensor of arbitrary shape (divisible by tile dimensions in both axes)
 // tensor shape is defined by BLOCK_RT_DIM and BLOCK_CT_DIM which represent the number of rows and columns of tiles respectively
 // they are calculated as BLOCK_RT_DIM = TENSOR_HEIGHT / TILE_R_DIM and BLOCK_CT_DIM = TENSOR_WIDTH / TILE_C_DIM
 // the first two loops are part of the kernel, providing looping for the performance measurement and calling the high level algorithm for each row of tiles
-// everything inside the "for (uint32_t i = 0; i < BLOCK_RT_DIM; i++)" loop implements the actual high level algorithm as used in the metal compute api
+// for_each_fast_tilize_bank and for_each_fast_tilize_call implement the actual high level algorithm as used in the metal compute api
 
 // the goal of the high level algorithm is to break down the BLOCK_CT_DIM of the input tensor into a sequence of llk calls
 // using available unit_dim primitives while maximizing the utilization of the destination buffer
 
 // principle of operation is as follows:
 // BLOCK_CT_DIM == 1: Single call with unit_dim == 1
-// BLOCK_CT_DIM == 2: Single call with unit_dim == 2
 // BLOCK_CT_DIM == 3: Single call with unit_dim == 3
-// BLOCK_CT_DIM > 3 && BLOCK_CT_DIM % 2 == 0: BLOCK_CT_DIM / 2 calls with unit_dim == 2
-// BLOCK_CT_DIM > 3 && BLOCK_CT_DIM % 2 == 1: (BLOCK_CT_DIM - 3) / 2 calls with unit_dim == 2, plus one call with unit_dim == 3
-// it is good to note that only unit_dim == 2 is called multiple times and/or with num_units > 1
+// the main unit_dim is 4 if UNIT_DIM == 4 and BLOCK_CT_DIM % 4 is 0 or 3, otherwise it is 2
+// a row is then covered with calls using the main unit_dim, plus one call with unit_dim == 3 if BLOCK_CT_DIM is not divisible by it
+// it is good to note that only the main unit_dim is called multiple times and/or with num_units > 1
 // meaning that unit_dims 1 and 3 will only appear as the last call in the last dest bank
+// unit_dim 3 can be mixed with either 2 or 4 without reconfiguration, 2 and 4 can't be mixed
 
-// each iteration of the while loop represents processing of a single dest bank
-// the idea is to process as many tiles as possible in each iteration, except the last two
+// each bank represents processing of a single dest bank
+// the idea is to process as many tiles as possible in each bank, except the last two
 // where the aim is to balance the number of tiles processed between the two dest banks to minimize the perf hit
 // depending on the number of remaining tiles, algorithm will decide how many tiles to process
 // if remaining_tiles > 2 * dest_size, there will be at least two more dest banks to process so the algorithm is free to process as much tiles as possible
-// if remaining_tiles > dest_size, there will be at least one more dest bank to process so the algorithm will aim to split the remaining tiles eavenly
-// "even_remainder" is calculated by taking half the tiles and rounding it up to be even as all dest banks except the last only use unit_dim 2
-// for all valid inputs ([5, 8] and [9, 16], depending on the dest_size) the number of tiles processed in the last two dest banks will be within 2 of each other
-// and number of tiles left in the last dest bank will be at least 2
-// in the last iteration there are three distinct cases:
-// if the number of remaining tiles is even or unit_dim == 1, the algorithm will process all remaining tiles in a single call
-// if the number of remaining tiles is 3, the algorithm will process them in a single call with unit_dim == 3
-// if the number of remaining tiles is odd and greater than 3, the algorithm will process all but the last three tiles in a single call with unit_dim == 2
+// if remaining_tiles > dest_size, there will be at least one more dest bank to process so the algorithm will aim to split the remaining tiles evenly
+// half the tiles are rounded up to a multiple of the main unit_dim as all dest banks except the last only use the main unit_dim
+// in the last bank there are two distinct cases:
+// if the number of remaining tiles is divisible by the main unit_dim, the algorithm will process all remaining tiles in a single call
+// otherwise the algorithm will process all but the last three tiles in a single call with the main unit_dim (if there are any)
 // followed by a call with unit_dim == 3 for the last three tiles
 
+constexpr uint32_t fast_tilize_unit_dim()
+{
+    if (BLOCK_CT_DIM == 1)
+    {
+        return 1;
+    }
+    if (UNIT_DIM == 4 && (BLOCK_CT_DIM % 4 == 0 || BLOCK_CT_DIM % 4 == 3))
+    {
+        return 4;
+    }
+    return 2;
+}
+
+constexpr uint32_t FAST_TILIZE_UNIT_DIM  = fast_tilize_unit_dim();
+constexpr uint32_t FAST_TILIZE_DEST_SIZE = is_fp32_dest_acc_en ? 4 : 8;
+
+// calls bank(tile_offset, bank_tiles) for each dest bank needed by a row of tiles
+template <typename Bank>
+inline void for_each_fast_tilize_bank(Bank&& bank)
+{
+    constexpr uint32_t unit_dim  = FAST_TILIZE_UNIT_DIM;
+    constexpr uint32_t dest_size = FAST_TILIZE_DEST_SIZE;
+
+    uint32_t packed_tiles    = 0;
+    uint32_t remaining_tiles = BLOCK_CT_DIM;
+
+    while (remaining_tiles > 0)
+    {
+        uint32_t bank_tiles = remaining_tiles;
+        if (remaining_tiles > 2 * dest_size)
+        {
+            bank_tiles = dest_size;
+        }
+        else if (remaining_tiles > dest_size)
+        {
+            uint32_t half = remaining_tiles / 2;
+            bank_tiles    = std::min(dest_size, ((half + unit_dim - 1) / unit_dim) * unit_dim);
+        }
+
+        bank(packed_tiles, bank_tiles);
+
+        packed_tiles += bank_tiles;
+        remaining_tiles -= bank_tiles;
+    }
+}
+
+// calls call(dst_index, unit_dim, num_units) for each llk call needed by a single dest bank
+template <typename Call>
+inline void for_each_fast_tilize_call(const uint32_t bank_tiles, Call&& call)
+{
+    constexpr uint32_t unit_dim = FAST_TILIZE_UNIT_DIM;
+
+    if (bank_tiles % unit_dim == 0)
+    {
+        call(0, unit_dim, bank_tiles / unit_dim);
+        return;
+    }
+
+    if (bank_tiles > 3)
+    {
+        call(0, unit_dim, (bank_tiles - 3) / unit_dim);
+    }
+    call(bank_tiles - 3, 3, 1);
+}
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_common.h"
+#include "llk_unpack_tilize.h"
+
 void run_kernel()
 {
     {
@@ -72,50 +134,17 @@ void run_kernel()
             {
                 uint32_t read_offset = i * BLOCK_CT_DIM * TILE_R_DIM;
 
-                uint32_t packed_tiles    = 0;
-                uint32_t remaining_tiles = BLOCK_CT_DIM;
-                uint32_t dest_size       = is_fp32_dest_acc_en ? 4 : 8;
-                uint32_t unit_dim        = BLOCK_CT_DIM == 1 ? 1 : 2;
-                uint32_t num_units       = dest_size / unit_dim;
-
-                while (packed_tiles < BLOCK_CT_DIM)
-                {
-                    uint32_t tile_index = read_offset + packed_tiles;
-                    if (remaining_tiles > 2 * dest_size)
-                    {
-                        _llk_unpack_fast_tilize_block_(L1_ADDRESS(buffer_A[0]), tile_index, formats.unpack_src, unit_dim, num_units, BLOCK_CT_DIM);
-                        packed_tiles += dest_size;
-                        remaining_tiles -= dest_size;
-                    }
-                    else if (remaining_tiles > dest_size)
+                for_each_fast_tilize_bank(
+                    [&](uint32_t tile_offset, uint32_t bank_tiles)
                     {
-                        uint32_t even_remainder = remaining_tiles / 2 + ((remaining_tiles / 2) % 2);
-                        num_units               = even_remainder / unit_dim;
-                        _llk_unpack_fast_tilize_block_(L1_ADDRESS(buffer_A[0]), tile_index, formats.unpack_src, unit_dim, num_units, BLOCK_CT_DIM);
-                        packed_tiles += even_remainder;
-                        remaining_tiles -= even_remainder;
-                    }
-                    else
-                    {
-                        if (remaining_tiles % 2 == 0 || unit_dim == 1)
-                        {
-                            num_units = remaining_tiles / unit_dim;
-                            _llk_unpack_fast_tilize_block_(L1_ADDRESS(buffer_A[0]), tile_index, formats.unpack_src, unit_dim, num_units, BLOCK_CT_DIM);
-                        }
-                        else if (remaining_tiles == 3)
-                        {
-                            _llk_unpack_fast_tilize_block_(L1_ADDRESS(buffer_A[0]), tile_index, formats.unpack_src, 3, 1, BLOCK_CT_DIM);
-                        }
-                        else
-                        {
-                            num_units = (remaining_tiles - 3) / unit_dim;
-                            _llk_unpack_fast_tilize_block_(L1_ADDRESS(buffer_A[0]), tile_index, formats.unpack_src, unit_dim, num_units, BLOCK_CT_DIM);
-                            _llk_unpack_fast_tilize_block_(L1_ADDRESS(buffer_A[0]), tile_index + remaining_tiles - 3, formats.unpack_src, 3, 1, BLOCK_CT_DIM);
-                        }
-                        packed_tiles += remaining_tiles;
-                        remaining_tiles = 0;
-                    }
-                }
+                        for_each_fast_tilize_call(
+                            bank_tiles,
+                            [&](uint32_t dst_index, uint32_t unit_dim, uint32_t num_units)
+                            {
+                                _llk_unpack_fast_tilize_block_(
+                                    L1_ADDRESS(buffer_A[0]), read_offset + tile_offset + dst_index, formats.unpack_src, unit_dim, num_units, BLOCK_CT_DIM);
+                            });
+                    });
             }
         }
         PROFILER_SYNC();
@@ -137,7 +166,7 @@ void run_kernel()
         ZONE_SCOPED("INIT")
         _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
         _llk_math_hw_configure_(formats.math, formats.math);
-        _llk_math_fast_tilize_init_(formats.math, BLOCK_CT_DIM == 1 ? 1 : 2);
+        _llk_math_fast_tilize_init_(formats.math, FAST_TILIZE_UNIT_DIM);
         PROFILER_SYNC();
     }
     {
@@ -146,53 +175,18 @@ void run_kernel()
         {
             for (uint32_t i = 0; i < BLOCK_RT_DIM; i++)
             {
-                uint32_t packed_tiles    = 0;
-                uint32_t remaining_tiles = BLOCK_CT_DIM;
-                uint32_t dest_size       = is_fp32_dest_acc_en ? 4 : 8;
-                uint32_t unit_dim        = BLOCK_CT_DIM == 1 ? 1 : 2;
-                uint32_t num_units       = dest_size / unit_dim;
+                for_each_fast_tilize_bank(
+                    [&](uint32_t, uint32_t bank_tiles)
+                    {
+                        _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
 
-                while (packed_tiles < BLOCK_CT_DIM)
-                {
-                    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+                        for_each_fast_tilize_call(
+                            bank_tiles,
+                            [&](uint32_t dst_index, uint32_t unit_dim, uint32_t num_units)
+                            { _llk_math_fast_tilize_block_(dst_index, formats.math, unit_dim, num_units); });
 
-                    if (remaining_tiles > 2 * dest_size)
-                    {
-                        _llk_math_fast_tilize_block_(0, formats.math, unit_dim, num_units);
-                        packed_tiles += dest_size;
-                        remaining_tiles -= dest_size;
-                    }
-                    else if (remaining_tiles > dest_size)
-                    {
-                        uint32_t even_remainder = remaining_tiles / 2 + ((remaining_tiles / 2) % 2);
-                        num_units               = even_remainder / unit_dim;
-                        _llk_math_fast_tilize_block_(0, formats.math, unit_dim, num_units);
-                        packed_tiles += even_remainder;
-                        remaining_tiles -= even_remainder;
-                    }
-                    else
-                    {
-                        if (remaining_tiles % 2 == 0 || unit_dim == 1)
-                        {
-                            num_units = remaining_tiles / unit_dim;
-                            _llk_math_fast_tilize_block_(0, formats.math, unit_dim, num_units);
-                        }
-                        else if (remaining_tiles == 3)
-                        {
-                            _llk_math_fast_tilize_block_(0, formats.math, 3, 1);
-                        }
-                        else
-                        {
-                            num_units = (remaining_tiles - 3) / unit_dim;
-                            _llk_math_fast_tilize_block_(0, formats.math, unit_dim, num_units);
-                            _llk_math_fast_tilize_block_(remaining_tiles - 3, formats.math, 3, 1);
-                        }
-                        packed_tiles += remaining_tiles;
-                        remaining_tiles = 0;
-                    }
-
-                    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
-                }
+                        _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+                    });
             }
         }
         PROFILER_SYNC();
@@ -215,7 +209,7 @@ void run_kernel()
         ZONE_SCOPED("INIT")
         _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileFaceLayout::RowMajor, false>();
         _llk_pack_fast_tilize_hw_configure_<is_fp32_dest_acc_en>(formats.pack_src, formats.pack_dst);
-        _llk_pack_fast_tilize_init_<DstSync::SyncHalf>(use_32bit_dest, formats.pack_dst, BLOCK_CT_DIM == 1 ? 1 : 2);
+        _llk_pack_fast_tilize_init_<DstSync::SyncHalf>(use_32bit_dest, formats.pack_dst, FAST_TILIZE_UNIT_DIM);
         PROFILER_SYNC();
     }
     {
@@ -226,54 +220,18 @@ void run_kernel()
             {
                 uint32_t write_offset = i * BLOCK_CT_DIM;
 
-                uint32_t packed_tiles    = 0;
-                uint32_t remaining_tiles = BLOCK_CT_DIM;
-                uint32_t dest_size       = is_fp32_dest_acc_en ? 4 : 8;
-                uint32_t unit_dim        = BLOCK_CT_DIM == 1 ? 1 : 2;
-                uint32_t num_units       = dest_size / unit_dim;
+                for_each_fast_tilize_bank(
+                    [&](uint32_t tile_offset, uint32_t bank_tiles)
+                    {
+                        _llk_packer_wait_for_math_done_();
 
-                while (packed_tiles < BLOCK_CT_DIM)
-                {
-                    _llk_packer_wait_for_math_done_();
+                        for_each_fast_tilize_call(
+                            bank_tiles,
+                            [&](uint32_t dst_index, uint32_t unit_dim, uint32_t num_units)
+                            { _llk_pack_fast_tilize_block_(dst_index, L1_ADDRESS(buffer_Res[write_offset + tile_offset + dst_index]), unit_dim, num_units); });
 
-                    uint32_t tile_index = write_offset + packed_tiles;
-                    if (remaining_tiles > 2 * dest_size)
-                    {
-                        _llk_pack_fast_tilize_block_(0, L1_ADDRESS(buffer_Res[tile_index]), unit_dim, num_units);
-                        packed_tiles += dest_size;
-                        remaining_tiles -= dest_size;
-                    }
-                    else if (remaining_tiles > dest_size)
-                    {
-                        uint32_t even_remainder = remaining_tiles / 2 + ((remaining_tiles / 2) % 2);
-                        num_units               = even_remainder / unit_dim;
-                        _llk_pack_fast_tilize_block_(0, L1_ADDRESS(buffer_Res[tile_index]), unit_dim, num_units);
-                        packed_tiles += even_remainder;
-                        remaining_tiles -= even_remainder;
-                    }
-                    else
-                    {
-                        if (remaining_tiles % 2 == 0 || unit_dim == 1)
-                        {
-                            num_units = remaining_tiles / unit_dim;
-                            _llk_pack_fast_tilize_block_(0, L1_ADDRESS(buffer_Res[tile_index]), unit_dim, num_units);
-                        }
-                        else if (remaining_tiles == 3)
-                        {
-                            _llk_pack_fast_tilize_block_(0, L1_ADDRESS(buffer_Res[tile_index]), 3, 1);
-                        }
-                        else
-                        {
-                            num_units = (remaining_tiles - 3) / unit_dim;
-                            _llk_pack_fast_tilize_block_(0, L1_ADDRESS(buffer_Res[tile_index]), unit_dim, num_units);
-                            _llk_pack_fast_tilize_block_(remaining_tiles - 3, L1_ADDRESS(buffer_Res[tile_index + remaining_tiles - 3]), 3, 1);
-                        }
-                        packed_tiles += remaining_tiles;
-                        remaining_tiles = 0;
-                    }
-
-                    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
-                }
+                        _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+                    });
             }
         }
         PROFILER_SYNC();
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+
+// Globals
+uint32_t unp_cfg_context          = 0;
+uint32_t pack_sync_tile_dst_ptr   = 0;
+uint32_t math_sync_tile_dst_index = 0;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+#include "params.h"
+
+void run_kernel()
+{
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_src, formats.unpack_dst);
+    _llk_unpack_A_hw_configure_<is_fp32_dest_acc_en, StochRndType::None>(formats.unpack_src, formats.unpack_dst, FACE_R_DIM, 0, 4);
+    for (int i = 0; i < TILE_CNT; ++i)
+    {
+        _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+            L1_ADDRESS(buffer_A[i]), 0, formats.unpack_src, formats.unpack_dst);
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "params.h"
+
+using namespace ckernel;
+
+void run_kernel()
+{
+    const bool is_int_fpu_en = false;
+
+// copy srca to dest
+#ifdef ARCH_BLACKHOLE
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, is_int_fpu_en>(0, 0, 4, formats.math);
+#else
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, is_int_fpu_en>(0, 0, 4, formats.math);
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<true, false>(formats.math, formats.math);
+
+    // One Dest section per untilize block, packer drains one half while the other one is filled
+    for (uint32_t row = 0; row < FULL_RT_DIM; ++row)
+    {
+        for (uint32_t block_start = 0; block_start < FULL_CT_DIM; block_start += BLOCK_CT_DIM)
+        {
+            const uint32_t block_tiles = std::min(BLOCK_CT_DIM, FULL_CT_DIM - block_start);
+
+            _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+            for (uint32_t tile = 0; tile < block_tiles; ++tile)
+            {
+                _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+                    tile, formats.math, formats.math);
+            }
+            _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+        }
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+#include "llk_pack_untilize.h"
+#include "params.h"
+
+void run_kernel()
+{
+    const bool UNTILIZE = true;
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, UNTILIZE, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileFaceLayout::RowMajor>();
+    _llk_pack_untilize_stream_init_(formats.pack_src, formats.pack_dst, BLOCK_CT_DIM, FULL_CT_DIM, FACE_R_DIM, 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, UNTILIZE>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileFaceLayout::RowMajor, UNTILIZE>();
+    _llk_pack_untilize_stream_init_(formats.pack_dst, BLOCK_CT_DIM, FULL_CT_DIM, FACE_R_DIM, 4);
+#endif
+
+    // Each row of tiles is FULL_CT_DIM tiles of row-major output, starting at its first tile's address
+    for (uint32_t row = 0; row < FULL_RT_DIM; ++row)
+    {
+        _llk_pack_untilize_stream_<DstSync::SyncHalf, is_fp32_dest_acc_en>(
+            L1_ADDRESS(buffer_Res[row * FULL_CT_DIM]), formats.pack_dst, BLOCK_CT_DIM, FULL_CT_DIM, FACE_R_DIM, 4);
+    }
+}
+
+#endif
@@ -22,8 +22,8 @@ void run_kernel()
         uint32_t cnt = i;
         {
             // The body of the loop without the zone should take i*10 cycles
-            // however the ZONE_SCOPED macro will add around 36 cycles of overhead
-            // so the total time should be around i*10 + 36 cycles
+            // however the ZONE_SCOPED macro will add around 13 cycles of overhead
+            // so the total time should be around i*10 + 13 cycles
             ZONE_SCOPED("OVERHEAD");
         loop:
             asm volatile("addi %0, %1, -1" : "=r"(cnt) : "r"(cnt));
@@ -44,9 +44,17 @@ void run_kernel()
 
 #ifdef LLK_TRISC_MATH
 
+#include "ckernel.h"
+#include "profiler.h"
+
 void run_kernel()
 {
-    // Only unpack kernel is measuring profiler overhead
+    // Zones longer than the 12-bit entry delta have to be restored from SYNC entries
+    for (uint32_t cycles : {1000u, 5000u, 100000u})
+    {
+        ZONE_SCOPED("LONG_ZONE");
+        ckernel::wait(cycles);
+    }
 }
 
 #endif
@@ -8,6 +8,7 @@
 
 #include "ckernel.h"
 #include "llk_defs.h"
+#include "params.h"
 
 // Globals
 uint32_t unp_cfg_context          = 0;
@@ -19,10 +20,35 @@ constexpr uint32_t BUF_DESC_ID_SRC_A = 29; // Source A matrix input buffer
 constexpr uint32_t BUF_DESC_ID_SRC_B = 30; // Source B matrix input buffer
 constexpr uint32_t BUF_DESC_ID_DST   = 31; // Destination matrix output buffer
 
+// Shapes are read from L1 at runtime, so one ELF runs every shape of the table back to back.
+// Each shape takes the next rt x kt tiles of buffer_A, kt x ct tiles of buffer_B and rt x ct tiles of buffer_Res.
+struct matmul_shape_t
+{
+    uint32_t ct_dim;
+    uint32_t rt_dim;
+    uint32_t kt_dim;
+};
+
+// Table layout: shape count, then ct_dim, rt_dim, kt_dim of every shape
+inline const volatile uint32_t* matmul_shape_table()
+{
+    return reinterpret_cast<const volatile uint32_t*>(MATMUL_SHAPES_ADDRESS);
+}
+
+inline uint32_t matmul_shape_count()
+{
+    return matmul_shape_table()[0];
+}
+
+inline matmul_shape_t matmul_shape(const uint32_t index)
+{
+    const volatile uint32_t* shape = matmul_shape_table() + 1 + index * 3;
+    return {shape[0], shape[1], shape[2]};
+}
+
 #ifdef LLK_TRISC_UNPACK
 
 #include "llk_unpack_matmul.h"
-#include "params.h"
 
 void run_kernel()
 {
@@ -54,12 +80,22 @@ void run_kernel()
     _llk_unpack_hw_configure_<ckernel::p_unpacr::UNP_B>(tdma_desc_src_a);
     _llk_unpack_hw_configure_<ckernel::p_unpacr::UNP_A>(tdma_desc_src_b);
 
-    _llk_unpack_matmul_init_<BUF_DESC_ID_SRC_A, BUF_DESC_ID_SRC_B, UNPACK_TRANSPOSE_FACES, CT_DIM, RT_DIM, KT_DIM>(); // transpose in src_A not supported for
-                                                                                                                      // quasar
-
-    for (uint32_t j = 0; j < KT_DIM; j++)
+    uint32_t tile_A = 0;
+    uint32_t tile_B = 0;
+    for (uint32_t shape = 0; shape < matmul_shape_count(); shape++)
     {
-        _llk_unpack_matmul_<BUF_DESC_ID_SRC_A, BUF_DESC_ID_SRC_B, CT_DIM, RT_DIM, KT_DIM>(j, j * CT_DIM);
+        const auto [ct_dim, rt_dim, kt_dim] = matmul_shape(shape);
+
+        _llk_unpack_matmul_init_<BUF_DESC_ID_SRC_A, BUF_DESC_ID_SRC_B, UNPACK_TRANSPOSE_FACES>(ct_dim, rt_dim, kt_dim); // transpose in src_A not supported for
+                                                                                                                        // quasar
+
+        for (uint32_t j = 0; j < kt_dim; j++)
+        {
+            _llk_unpack_matmul_(tile_A + j, tile_B + j * ct_dim, ct_dim, rt_dim, kt_dim);
+        }
+
+        tile_A += rt_dim * kt_dim;
+        tile_B += kt_dim * ct_dim;
     }
 }
 
@@ -69,7 +105,6 @@ void run_kernel()
 
 #include "llk_math_common.h"
 #include "llk_math_matmul.h"
-#include "params.h"
 
 void run_kernel()
 {
@@ -81,14 +116,22 @@ void run_kernel()
         false,
         static_cast<DataFormat>(formats.math),
         static_cast<DataFormat>(formats.math)>();
-    _llk_math_matmul_init_<(ckernel::MathFidelity)MATH_FIDELITY, CT_DIM, RT_DIM, false, false>(); // disable flags for matmul with indexing and mxfp_2x not part
-                                                                                                  // of P0 test suite
 
-    for (uint32_t i = 0; i < KT_DIM; i++)
+    for (uint32_t shape = 0; shape < matmul_shape_count(); shape++)
     {
-        _llk_math_matmul_block_<CT_DIM, RT_DIM>();
+        const auto [ct_dim, rt_dim, kt_dim] = matmul_shape(shape);
+
+        _llk_math_matmul_init_<(ckernel::MathFidelity)MATH_FIDELITY, false, false>(ct_dim, rt_dim); // disable flags for matmul with indexing and mxfp_2x not part
+                                                                                                    // of P0 test suite
+
+        for (uint32_t i = 0; i < kt_dim; i++)
+        {
+            _llk_math_matmul_block_(ct_dim, rt_dim);
+        }
+
+        // One dest section per shape, accumulated over kt_dim and handed to pack
+        _llk_math_set_dvalid_<p_cleardvalid::FPU>();
     }
-    _llk_math_set_dvalid_<p_cleardvalid::FPU>();
 }
 
 #endif
@@ -97,7 +140,6 @@ void run_kernel()
 
 #include "llk_pack.h"
 #include "llk_pack_matmul.h"
-#include "params.h"
 
 void run_kernel()
 {
@@ -114,10 +156,19 @@ void run_kernel()
     tdma_desc_dst.reg_data_format         = static_cast<uint8_t>(formats.pack_src);
 
     _llk_pack_hw_configure_<p_pacr::PACK0>(tdma_desc_dst);
-    _llk_pack_matmul_init_<p_pacr::PACK0, BUF_DESC_ID_DST, RT_DIM, CT_DIM, 1>(); // Use destination buffer descriptor for packing output
 
-    _llk_pack_matmul_<p_pacr::PACK0>(0, 0);
-    _llk_pack_dest_dvalid_section_done_<dest_sync, is_fp32_dest_acc_en>();
+    uint32_t tile_Res = 0;
+    for (uint32_t shape = 0; shape < matmul_shape_count(); shape++)
+    {
+        const auto [ct_dim, rt_dim, kt_dim] = matmul_shape(shape);
+
+        _llk_pack_matmul_init_<p_pacr::PACK0, BUF_DESC_ID_DST>(rt_dim, ct_dim, 1); // Use destination buffer descriptor for packing output
+
+        _llk_pack_matmul_<p_pacr::PACK0>(0, tile_Res);
+        _llk_pack_dest_dvalid_section_done_<dest_sync, is_fp32_dest_acc_en>();
+
+        tile_Res += rt_dim * ct_dim;
+    }
 }
 
 #endif
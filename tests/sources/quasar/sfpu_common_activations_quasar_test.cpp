@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Runs the arch-neutral activations of tt_llk_common/sfpu on every tile of the input,
+// FPU copies the tiles to dest, SFPU transforms them in place and pack writes them out
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+
+// Globals
+uint32_t unp_cfg_context          = 0;
+uint32_t pack_sync_tile_dst_ptr   = 0;
+uint32_t math_sync_tile_dst_index = 0;
+
+// Buffer descriptor IDs for TDMA engines - these are indices into the hardware buffer descriptor table
+constexpr uint32_t BUF_DESC_ID_SRC_A = 0;  // Source A input buffer, unpackers use IDs 0-15
+constexpr uint32_t BUF_DESC_ID_DST   = 31; // Destination output buffer
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_common.h"
+#include "llk_unpack_unary_operand.h"
+#include "params.h"
+
+void run_kernel()
+{
+    set_ttsync_enables<TRACK_ALL>(ckernel::unpack::TRISC_ID);
+
+    tdma_descriptor_t tdma_desc_src_a;
+    tdma_desc_src_a.buf_desc.f.l1_addr_16B  = L1_ADDRESS(buffer_A[0]);
+    tdma_desc_src_a.buf_desc.f.format       = static_cast<uint8_t>(formats.unpack_src);
+    tdma_desc_src_a.buf_desc.f.lmt_addr_16B = 0;
+    tdma_desc_src_a.buf_desc.f.x_dim        = FACE_C_DIM; // Default face dimension is 16, tiny tiles not supported for quasar
+    tdma_desc_src_a.buf_desc.f.y_dim        = FACE_R_DIM; // Default face dimension is 16, tiny tiles not supported for quasar
+    tdma_desc_src_a.buf_desc.f.z_dim        = num_faces;  // Number of faces = 4, tiny tiles not supported for quasar
+    tdma_desc_src_a.buf_desc_id             = BUF_DESC_ID_SRC_A;
+    tdma_desc_src_a.reg_data_format         = (uint)formats.unpack_dst;
+
+    _llk_unpack_configure_unary_<p_unpacr::UNP_A>(tdma_desc_src_a);
+    _llk_unpack_unary_operand_init_<p_unpacr::UNP_A, BUF_DESC_ID_SRC_A, false /*transpose*/, is_fp32_dest_acc_en>(TILE_CNT);
+    _llk_unpack_unary_operand_<p_unpacr::UNP_A>(0);
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu_common.h"
+#include "params.h"
+
+using namespace ckernel;
+using namespace ckernel::sfpu;
+
+// One dvalid per unpacked tile, so the datacopy moves a whole tile per matrix
+constexpr uint32_t ROWS_PER_TILE = 64;
+
+// SFPU row groups per face, _llk_math_eltwise_unary_sfpu_params_ calls the kernel once per face
+constexpr int iterations = FACE_R_DIM / SFP_ROWS;
+
+// fp32 bit patterns of the scalar parameters, the python goldens use the same values
+constexpr uint32_t FP32_MINUS_ONE = 0xBF800000;
+constexpr uint32_t FP32_ONE       = 0x3F800000;
+constexpr uint32_t FP32_FIVE      = 0x40A00000;
+constexpr uint32_t FP32_TEN       = 0x41200000;
+
+namespace
+{
+void call_sfpu_operation(SfpuType operation, const uint tile_idx)
+{
+    switch (operation)
+    {
+        case SfpuType::abs:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_abs_, tile_idx, iterations);
+            break;
+        case SfpuType::neg:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_negative_, tile_idx, iterations);
+            break;
+        case SfpuType::square:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_square_, tile_idx, iterations);
+            break;
+        case SfpuType::hardtanh:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_hardtanh_, tile_idx, iterations, FP32_MINUS_ONE, FP32_ONE);
+            break;
+        case SfpuType::hardsigmoid:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_hardsigmoid_, tile_idx, iterations);
+            break;
+        case SfpuType::hardswish:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_hardswish_, tile_idx, iterations);
+            break;
+        case SfpuType::threshold:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_threshold_, tile_idx, iterations, FP32_FIVE, FP32_TEN);
+            break;
+        case SfpuType::sign:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_sign_, tile_idx, iterations);
+            break;
+        case SfpuType::fill:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_fill_, tile_idx, iterations, FP32_FIVE);
+            break;
+        case SfpuType::sigmoid:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_sigmoid_, tile_idx, iterations);
+            break;
+        case SfpuType::silu:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_silu_, tile_idx, iterations);
+            break;
+        case SfpuType::elu:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_elu_, tile_idx, iterations, FP32_ONE);
+            break;
+        case SfpuType::celu:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_celu_, tile_idx, iterations, FP32_ONE, FP32_ONE);
+            break;
+        case SfpuType::gelu:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_gelu_, tile_idx, iterations);
+            break;
+        case SfpuType::softsign:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_softsign_, tile_idx, iterations);
+            break;
+        case SfpuType::tanhshrink:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_tanhshrink_, tile_idx, iterations);
+            break;
+        case SfpuType::rsqrt:
+            _llk_math_eltwise_unary_sfpu_params_<APPROX_MODE>(common::_calculate_rsqrt_, tile_idx, iterations);
+            break;
+        default:
+            return;
+    }
+}
+} // namespace
+
+void run_kernel()
+{
+    // The math thread drives both dest producers, FPU copies the tiles in and SFPU rewrites them for pack
+    set_up_dest_dvalid_per_thread<dest_dvalid_client::FPU>({dest_dvalid_client::FPU, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+    set_up_dest_dvalid_per_thread<dest_dvalid_client::SFPU>({dest_dvalid_client::FPU, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+
+    _llk_math_srcAB_hw_configure_<
+        IMPLIED_MATH_FORMAT,
+        is_fp32_dest_acc_en,
+        false,
+        static_cast<DataFormat>(formats.math),
+        static_cast<DataFormat>(formats.math)>();
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en>(ROWS_PER_TILE, 1);
+
+    for (int i = 0; i < TILE_CNT; ++i)
+    {
+        _llk_math_eltwise_unary_datacopy_<ROWS_PER_TILE>(i);
+    }
+    _llk_math_set_dvalid_<p_cleardvalid::FPU>();
+
+    _llk_math_eltwise_unary_sfpu_init_();
+    for (int i = 0; i < TILE_CNT; ++i)
+    {
+        call_sfpu_operation(SFPU_UNARY_OPERATION, i);
+    }
+    _llk_math_set_dvalid_<p_cleardvalid::SFPU>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+#include "params.h"
+
+void run_kernel()
+{
+    set_up_dest_dvalid_per_thread<dest_dvalid_client::PACK>({dest_dvalid_client::FPU, dest_dvalid_client::SFPU, dest_dvalid_client::PACK});
+
+    tdma_descriptor_t tdma_desc_dst;
+    tdma_desc_dst.buf_desc.f.l1_addr_16B  = L1_ADDRESS(buffer_Res[0]);
+    tdma_desc_dst.buf_desc.f.lmt_addr_16B = 0;
+    tdma_desc_dst.buf_desc.f.format       = static_cast<uint8_t>(formats.pack_dst);
+    tdma_desc_dst.buf_desc.f.x_dim        = FACE_C_DIM;
+    tdma_desc_dst.buf_desc.f.y_dim        = FACE_R_DIM;
+    tdma_desc_dst.buf_desc.f.z_dim        = num_faces;
+    tdma_desc_dst.buf_desc_id             = BUF_DESC_ID_DST;
+    tdma_desc_dst.reg_data_format         = static_cast<uint8_t>(formats.pack_src);
+
+    _llk_pack_hw_configure_<p_pacr::PACK0>(tdma_desc_dst);
+    _llk_pack_init_<p_pacr::PACK0, BUF_DESC_ID_DST>(TILE_CNT);
+
+    _llk_pack_<p_pacr::PACK0>(0, 0);
+    _llk_pack_dest_dvalid_section_done_<dest_sync, is_fp32_dest_acc_en>();
+}
+
+#endif
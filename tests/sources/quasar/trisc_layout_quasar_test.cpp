@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Runs one data movement kernel of ckernel_trisc_layout.h on the unpack TRISC, straight from
+// buffer_A (and the uint32 indices in buffer_B) to buffer_Res in L1. Math and pack stay idle.
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+
+// Globals
+uint32_t unp_cfg_context          = 0;
+uint32_t pack_sync_tile_dst_ptr   = 0;
+uint32_t math_sync_tile_dst_index = 0;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "ckernel_trisc_layout.h"
+#include "params.h"
+
+using namespace ckernel;
+
+namespace
+{
+// Template so only the selected operation is instantiated, convert is the one with DstT != SrcT
+template <typename DstT, typename SrcT>
+void run_trisc_layout(DstT* dst, const SrcT* src, const uint32_t* indices)
+{
+    constexpr uint32_t count = TILE_CNT * trisc::TILE_R_DIM * trisc::TILE_C_DIM;
+
+    if constexpr (TRISC_LAYOUT == TriscLayoutOperation::convert)
+    {
+        _trisc_convert_(dst, src, count);
+    }
+    else if constexpr (TRISC_LAYOUT == TriscLayoutOperation::tilize)
+    {
+        _trisc_tilize_(dst, src, BLOCK_RT_DIM, BLOCK_CT_DIM);
+    }
+    else if constexpr (TRISC_LAYOUT == TriscLayoutOperation::untilize)
+    {
+        _trisc_untilize_(dst, src, BLOCK_RT_DIM, BLOCK_CT_DIM);
+    }
+    else if constexpr (TRISC_LAYOUT == TriscLayoutOperation::transpose_faces)
+    {
+        _trisc_transpose_faces_(dst, src, TILE_CNT * trisc::NUM_FACES);
+    }
+    else if constexpr (TRISC_LAYOUT == TriscLayoutOperation::gather)
+    {
+        _trisc_gather_(dst, src, indices, count);
+    }
+    else if constexpr (TRISC_LAYOUT == TriscLayoutOperation::scatter)
+    {
+        _trisc_scatter_(dst, src, indices, count);
+    }
+    else
+    {
+        _trisc_fill_(dst, src[0], count);
+    }
+}
+} // namespace
+
+void run_kernel()
+{
+    static_assert(BLOCK_RT_DIM * BLOCK_CT_DIM == TILE_CNT, "The block must cover every tile");
+
+    LayoutDst* dst          = reinterpret_cast<LayoutDst*>(buffer_Res[0]);
+    const LayoutSrc* src    = reinterpret_cast<const LayoutSrc*>(buffer_A[0]);
+    const uint32_t* indices = reinterpret_cast<const uint32_t*>(buffer_B[0]);
+    run_trisc_layout(dst, src, indices);
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+void run_kernel()
+{
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+void run_kernel()
+{
+}
+
+#endif
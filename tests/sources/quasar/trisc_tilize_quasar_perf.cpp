@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <type_traits>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+#include "perf.h"
+#include "profiler.h"
+
+// Globals
+uint32_t unp_cfg_context          = 0;
+uint32_t pack_sync_tile_dst_ptr   = 0;
+uint32_t math_sync_tile_dst_index = 0;
+
+// Tilizes one row of BLOCK_CT_DIM tiles LOOP_FACTOR times, first on the unpack TRISC with
+// ckernel_trisc_layout.h and then with the fused UNPACR_TILIZE, each in its own zone
+static_assert(BLOCK_RT_DIM == 1, "The fused tilize is addressed by tile index within one row of tiles");
+static_assert(BLOCK_CT_DIM == TILE_CNT, "BLOCK_CT_DIM must be equal to TILE_CNT");
+
+constexpr uint32_t BUF_DESC_ID_SRC_A = 0;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "ckernel_trisc_layout.h"
+#include "llk_unpack_common.h"
+#include "llk_unpack_tilize.h"
+
+// Raw container of one datum, the copy does not look at the values
+using Datum = std::conditional_t<static_cast<DataFormat>(formats.unpack_src) == DataFormat::Float32, uint32_t, uint16_t>;
+
+void run_kernel()
+{
+    {
+        ZONE_SCOPED("INIT")
+        tdma_descriptor_t tdma_desc_src_a;
+        tdma_desc_src_a.buf_desc.f.l1_addr_16B  = L1_ADDRESS(PERF_INPUT_A.base);
+        tdma_desc_src_a.buf_desc.f.format       = static_cast<uint8_t>(formats.unpack_src);
+        tdma_desc_src_a.buf_desc.f.lmt_addr_16B = 0;
+        tdma_desc_src_a.buf_desc.f.x_dim        = FACE_C_DIM;
+        tdma_desc_src_a.buf_desc.f.y_dim        = FACE_R_DIM;
+        tdma_desc_src_a.buf_desc.f.z_dim        = ckernel::trisc::NUM_FACES;
+        tdma_desc_src_a.buf_desc_id             = BUF_DESC_ID_SRC_A;
+        tdma_desc_src_a.reg_data_format         = static_cast<uint8_t>(formats.unpack_dst);
+
+        _llk_unpack_hw_configure_<p_unpacr::UNP_A>(tdma_desc_src_a);
+        _llk_unpack_tilize_init_<p_unpacr::UNP_A, BUF_DESC_ID_SRC_A, is_fp32_dest_acc_en, BLOCK_CT_DIM, BLOCK_CT_DIM * 2>();
+        PROFILER_SYNC();
+    }
+
+    {
+        ZONE_SCOPED("TRISC_TILIZE")
+        const Datum* src = reinterpret_cast<const Datum*>(PERF_INPUT_A.base);
+        Datum* dst       = reinterpret_cast<Datum*>(PERF_OUTPUT.base);
+        for (uint32_t loop = 0; loop < LOOP_FACTOR; loop++)
+        {
+            _trisc_tilize_(dst, src, BLOCK_RT_DIM, BLOCK_CT_DIM);
+        }
+    }
+
+    {
+        ZONE_SCOPED("UNPACK_TILIZE")
+        for (uint32_t loop = 0; loop < LOOP_FACTOR; loop++)
+        {
+            for (uint32_t j = 0; j < BLOCK_CT_DIM; j++)
+            {
+                _llk_unpack_tilize_<p_unpacr::UNP_A>(j);
+            }
+        }
+        PROFILER_SYNC();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+void run_kernel()
+{
+    {
+        ZONE_SCOPED("UNPACK_TILIZE")
+        // One dvalid per tile, 32 bit dest also needs srcB dvalid for the datacopy
+        _perf_math_loop_clear_valid<true, is_fp32_dest_acc_en>(LOOP_FACTOR * TILE_CNT);
+        PROFILER_SYNC();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+void run_kernel()
+{
+    // Both tilize paths end in L1 or srcA, nothing to pack
+}
+
+#endif
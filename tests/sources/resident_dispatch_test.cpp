@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+
+#include "build.h"
+#include "dispatch.h"
+
+// Globals
+uint32_t unp_cfg_context        = 0;
+uint32_t pack_sync_tile_dst_ptr = 0;
+
+// Incremented by every kernel, stays 1 only if the dispatcher restores the globals between commands
+uint32_t run_counter = 0;
+
+// result[trisc] = (kernel id + 1) * arg0 + run_counter
+template <uint32_t TRISC, uint32_t SCALE>
+void write_result()
+{
+    volatile uint32_t* const result = reinterpret_cast<volatile uint32_t*>(buffer_Res[0]);
+    ++run_counter;
+    result[TRISC] = SCALE * llk_dispatch::runtime_arg(0) + run_counter;
+}
+
+#ifdef LLK_TRISC_UNPACK
+
+void run_kernel()
+{
+    write_result<0, 1>();
+}
+
+LLK_KERNEL_TABLE(run_kernel, write_result<0, 2>)
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+void run_kernel()
+{
+    write_result<1, 1>();
+}
+
+LLK_KERNEL_TABLE(run_kernel, write_result<1, 2>)
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+void run_kernel()
+{
+    write_result<2, 1>();
+}
+
+LLK_KERNEL_TABLE(run_kernel, write_result<2, 2>)
+
+#endif
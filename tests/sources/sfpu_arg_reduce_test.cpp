@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+uint32_t unp_cfg_context          = 0;
+uint32_t pack_sync_tile_dst_ptr   = 0;
+uint32_t math_sync_tile_dst_index = 0;
+
+// The values of the reduction go to the first input tile, the indices to the tile after the inputs
+constexpr uint32_t values_tile  = 0;
+constexpr uint32_t indices_tile = ARG_REDUCE_TILES;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel()
+{
+    _llk_unpack_A_hw_configure_<is_fp32_dest_acc_en, StochRndType::None>(formats.unpack_src, formats.unpack_dst, FACE_R_DIM, 0, 4);
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_src, formats.unpack_dst);
+
+    for (uint32_t i = 0; i < ARG_REDUCE_TILES; i++)
+    {
+        _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+            L1_ADDRESS(buffer_A[i]), 0, formats.unpack_src, formats.unpack_dst);
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu.h"
+#include "llk_math_transpose_dest.h"
+
+using namespace ckernel;
+using namespace ckernel::sfpu;
+
+constexpr ArgReduceOp arg_reduce_op = ARG_REDUCE_OPERATION == SfpuType::argmax ? ArgReduceOp::Max : ArgReduceOp::Min;
+
+// A whole-tile reduction keeps Int32 row indices for its second step
+constexpr ArgIndexFormat column_index_format = REDUCE_DIM == ReduceDim::REDUCE_SCALAR ? ArgIndexFormat::Int32 : ARG_INDEX_FORMAT;
+
+void transpose_tiles(const uint32_t first_tile, const uint32_t tile_count)
+{
+    _llk_math_transpose_dest_init_<true, is_fp32_dest_acc_en>();
+    for (uint32_t i = first_tile; i < first_tile + tile_count; i++)
+    {
+#ifdef ARCH_BLACKHOLE
+        _llk_math_transpose_dest_<is_fp32_dest_acc_en, true, is_fp32_dest_acc_en>(i);
+#else
+        _llk_math_transpose_dest_<true, is_fp32_dest_acc_en>(i);
+#endif
+    }
+}
+
+void run_kernel()
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(0, 0, 4, formats.math);
+#else
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(0, 0, 4, formats.math);
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<false, false>(formats.math, formats.math);
+
+    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+    for (uint32_t i = 0; i < ARG_REDUCE_TILES; i++)
+    {
+        _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+            i, formats.math, formats.math);
+    }
+
+    // A row reduction is a column reduction of the transposed tiles
+    if constexpr (REDUCE_DIM == ReduceDim::REDUCE_ROW)
+    {
+        transpose_tiles(0, ARG_REDUCE_TILES);
+    }
+
+    // All tiles but the last as the first chunk, the last one merged with its result
+    _llk_math_eltwise_unary_sfpu_init_<ARG_REDUCE_OPERATION>();
+    _llk_math_eltwise_unary_sfpu_start_<DstSync::SyncHalf>(0);
+    _calculate_arg_reduce_col_<false, arg_reduce_op, ARG_TIE_BREAK, column_index_format>(0, ARG_REDUCE_TILES - 1, values_tile, indices_tile, 0, false);
+    _calculate_arg_reduce_col_<false, arg_reduce_op, ARG_TIE_BREAK, column_index_format>(
+        ARG_REDUCE_TILES - 1, 1, values_tile, indices_tile, (ARG_REDUCE_TILES - 1) * 32, true);
+    _llk_math_eltwise_unary_sfpu_done_();
+
+    // Over the whole tile, the result of every column is reduced again down column 0
+    if constexpr (REDUCE_DIM == ReduceDim::REDUCE_SCALAR)
+    {
+        transpose_tiles(values_tile, 1);
+        transpose_tiles(indices_tile, 1);
+
+        _llk_math_eltwise_unary_sfpu_init_<ARG_REDUCE_OPERATION>();
+        _llk_math_eltwise_unary_sfpu_start_<DstSync::SyncHalf>(0);
+        _calculate_arg_reduce_col_<false, arg_reduce_op, ARG_TIE_BREAK, ARG_INDEX_FORMAT, true>(values_tile, 1, values_tile, indices_tile, 0, false);
+        _llk_math_eltwise_unary_sfpu_done_();
+    }
+
+    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel()
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#endif
+
+    _llk_pack_init_<false, false, DstTileFaceLayout::RowMajor, false>(formats.pack_dst);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileFaceLayout::RowMajor>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, false, DstTileFaceLayout::RowMajor, false>();
+#endif
+
+    _llk_packer_wait_for_math_done_();
+    _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(indices_tile, L1_ADDRESS(buffer_Res[0]));
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+uint32_t unp_cfg_context          = 0;
+uint32_t pack_sync_tile_dst_ptr   = 0;
+uint32_t math_sync_tile_dst_index = 0;
+
+// A scalar operand comes from BROADCAST_SCALAR, so only a row or column broadcast unpacks the in1 tile
+constexpr bool with_in1_tile = SFPU_BINARY_BROADCAST != ckernel::BinaryBroadcast::Scalar;
+constexpr uint32_t in1_index = SFPU_BINARY_BROADCAST == ckernel::BinaryBroadcast::Column ? BROADCAST_COLUMN : BROADCAST_ROW;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel()
+{
+    _llk_unpack_A_hw_configure_<is_fp32_dest_acc_en, StochRndType::None>(formats.unpack_src, formats.unpack_dst, FACE_R_DIM, 0, 4);
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_src, formats.unpack_dst);
+
+    for (int i = 0; i < TILE_CNT; i++)
+    {
+        _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+            L1_ADDRESS(buffer_A[i]), 0, formats.unpack_src, formats.unpack_dst);
+        if constexpr (with_in1_tile)
+        {
+            _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+                L1_ADDRESS(buffer_B[i]), 0, formats.unpack_src, formats.unpack_dst);
+        }
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_defs.h"
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu.h"
+
+using namespace ckernel;
+using namespace ckernel::sfpu;
+
+namespace
+{
+// Replicates row BROADCAST_ROW or column BROADCAST_COLUMN of tile 1 into the broadcast operand
+template <InstrModLoadStore INSTRUCTION_MODE = InstrModLoadStore::DEFAULT>
+void replicate_in1()
+{
+    if constexpr (SFPU_BINARY_BROADCAST == BinaryBroadcast::Row)
+    {
+        _sfpu_binary_bcast_replicate_row_<INSTRUCTION_MODE>(1, BROADCAST_ROW);
+    }
+    else if constexpr (SFPU_BINARY_BROADCAST == BinaryBroadcast::Column)
+    {
+        _sfpu_binary_bcast_replicate_column_<INSTRUCTION_MODE>(1, BROADCAST_COLUMN);
+    }
+}
+
+// Tile 0 op the broadcast operand, which is BROADCAST_SCALAR or the replicated row or column of tile 1, into tile 0.
+// OPERATION is a BinaryOp, or the SfpuType of a comparison or bitwise op.
+template <auto OPERATION>
+void call_binary_bcast_operation()
+{
+    constexpr uint32_t in1 = with_in1_tile ? 1 : BROADCAST_SCALAR;
+
+    if constexpr (std::is_same_v<decltype(OPERATION), SfpuType>)
+    {
+        constexpr bool is_bitwise = OPERATION == SfpuType::bitwise_and || OPERATION == SfpuType::bitwise_or || OPERATION == SfpuType::bitwise_xor;
+
+        if constexpr (is_bitwise)
+        {
+            constexpr BinaryBitwiseOp bitwise_op = OPERATION == SfpuType::bitwise_and  ? BinaryBitwiseOp::AND
+                                                   : OPERATION == SfpuType::bitwise_or ? BinaryBitwiseOp::OR
+                                                                                       : BinaryBitwiseOp::XOR;
+            replicate_in1<InstrModLoadStore::INT32>();
+            _calculate_sfpu_binary_bitwise_bcast_<false, bitwise_op, SFPU_BINARY_BROADCAST>(0, in1, 0, in1_index);
+        }
+        else
+        {
+            replicate_in1();
+            _calculate_comp_bcast_<false, OPERATION, SFPU_BINARY_BROADCAST>(0, in1, 0, in1_index);
+        }
+    }
+    else if constexpr (OPERATION == BinaryOp::RSHFT || OPERATION == BinaryOp::LSHFT || OPERATION == BinaryOp::LOGICAL_RSHFT)
+    {
+        replicate_in1<InstrModLoadStore::INT32>();
+        _calculate_binary_shift_bcast_<false, OPERATION, SFPU_BINARY_BROADCAST, INT32, false>(0, in1, 0, in1_index);
+    }
+    else
+    {
+        replicate_in1();
+        _sfpu_binary_init_<false, OPERATION>();
+        _calculate_sfpu_binary_bcast_<false, OPERATION, SFPU_BINARY_BROADCAST>(0, in1, 0, in1_index);
+    }
+}
+} // namespace
+
+void run_kernel()
+{
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<false, false>(formats.math, formats.math);
+
+    for (int i = 0; i < TILE_CNT; i++)
+    {
+#ifdef ARCH_BLACKHOLE
+        _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(0, 0, 4, formats.math);
+#else
+        _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(0, 0, 4, formats.math);
+#endif
+        _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+        _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+            0, formats.math, formats.math);
+        if constexpr (with_in1_tile)
+        {
+            _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+                1, formats.math, formats.math);
+        }
+
+        _llk_math_eltwise_unary_sfpu_init_<SfpuType::add1>();
+        _llk_math_eltwise_unary_sfpu_start_<DstSync::SyncHalf>(0);
+        call_binary_bcast_operation<SFPU_BINARY_BCAST_OPERATION>();
+        _llk_math_eltwise_unary_sfpu_done_();
+
+        _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel()
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#endif
+
+    _llk_pack_init_<false, false, DstTileFaceLayout::RowMajor, false>(formats.pack_dst);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileFaceLayout::RowMajor>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, false, DstTileFaceLayout::RowMajor, false>();
+#endif
+
+    for (int i = 0; i < TILE_CNT; i++)
+    {
+        _llk_packer_wait_for_math_done_();
+        _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(0, L1_ADDRESS(buffer_Res[i]));
+        _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+}
+
+#endif
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Runs the arch-neutral activations of tt_llk_common/sfpu on every tile of the input
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+
+// Globals
+uint32_t unp_cfg_context          = 0;
+uint32_t pack_sync_tile_dst_ptr   = 0;
+uint32_t math_sync_tile_dst_index = 0;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+#include "params.h"
+
+void run_kernel()
+{
+    _llk_unpack_A_hw_configure_<is_fp32_dest_acc_en, StochRndType::None>(formats.unpack_src, formats.unpack_dst, FACE_R_DIM, 0, 4);
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_src, formats.unpack_dst);
+
+    for (int i = 0; i < TILE_CNT; ++i)
+    {
+        _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+            L1_ADDRESS(buffer_A[i]), 0, formats.unpack_src, formats.unpack_dst);
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu.h"
+#include "params.h"
+
+using namespace ckernel;
+using namespace ckernel::sfpu;
+
+const int iterations = 32;
+
+// fp32 bit patterns of the scalar parameters, the python goldens use the same values
+constexpr uint32_t FP32_MINUS_ONE = 0xBF800000;
+constexpr uint32_t FP32_ONE       = 0x3F800000;
+constexpr uint32_t FP32_FIVE      = 0x40A00000;
+constexpr uint32_t FP32_TEN       = 0x41200000;
+
+namespace
+{
+void call_sfpu_operation(SfpuType operation)
+{
+    switch (operation)
+    {
+        case SfpuType::abs:
+            common::_calculate_abs_(iterations);
+            break;
+        case SfpuType::neg:
+            common::_calculate_negative_(iterations);
+            break;
+        case SfpuType::square:
+            common::_calculate_square_(iterations);
+            break;
+        case SfpuType::hardtanh:
+            common::_calculate_hardtanh_(iterations, FP32_MINUS_ONE, FP32_ONE);
+            break;
+        case SfpuType::hardsigmoid:
+            common::_calculate_hardsigmoid_(iterations);
+            break;
+        case SfpuType::hardswish:
+            common::_calculate_hardswish_(iterations);
+            break;
+        case SfpuType::threshold:
+            common::_calculate_threshold_(iterations, FP32_FIVE, FP32_TEN);
+            break;
+        case SfpuType::sign:
+            common::_calculate_sign_(iterations);
+            break;
+        case SfpuType::fill:
+            common::_calculate_fill_(iterations, FP32_FIVE);
+            break;
+        default:
+            return;
+    }
+}
+} // namespace
+
+void run_kernel()
+{
+// copy srca to dest
+#ifdef ARCH_BLACKHOLE
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(0, 0, 4, formats.math);
+#else
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(0, 0, 4, formats.math);
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<false, false>(formats.math, formats.math);
+
+    for (int i = 0; i < TILE_CNT; ++i)
+    {
+        _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+        _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+            i, formats.math, formats.math);
+
+        _llk_math_eltwise_unary_sfpu_init_<SFPU_UNARY_OPERATION>();
+        _llk_math_eltwise_unary_sfpu_start_<DstSync::SyncHalf>(i);
+        call_sfpu_operation(SFPU_UNARY_OPERATION);
+        _llk_math_eltwise_unary_sfpu_done_();
+    }
+
+    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+#include "params.h"
+
+void run_kernel()
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#endif
+
+    _llk_pack_init_<false, false, DstTileFaceLayout::RowMajor, false>(formats.pack_dst);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileFaceLayout::RowMajor>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, false, DstTileFaceLayout::RowMajor, false>();
+#endif
+
+    _llk_packer_wait_for_math_done_();
+    for (int i = 0; i < TILE_CNT; ++i)
+    {
+        _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(i, L1_ADDRESS(buffer_Res[i]));
+    }
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
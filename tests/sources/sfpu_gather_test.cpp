@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+uint32_t unp_cfg_context          = 0;
+uint32_t pack_sync_tile_dst_ptr   = 0;
+uint32_t math_sync_tile_dst_index = 0;
+
+// Dest holds the GATHER_SRC_TILES source tiles followed by the GATHER_DST_TILES output tiles.
+// buffer_B holds the indices: 32 per output tile for gathers, 32 per source tile for scatters.
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel()
+{
+    _llk_unpack_A_hw_configure_<is_fp32_dest_acc_en, StochRndType::None>(formats.unpack_src, formats.unpack_dst, FACE_R_DIM, 0, 4);
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_src, formats.unpack_dst);
+
+    for (uint32_t i = 0; i < GATHER_SRC_TILES; i++)
+    {
+        _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+            L1_ADDRESS(buffer_A[i]), 0, formats.unpack_src, formats.unpack_dst);
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu.h"
+#include "llk_math_transpose_dest.h"
+
+using namespace ckernel;
+using namespace ckernel::sfpu;
+
+void transpose_tiles(const uint32_t first_tile, const uint32_t tile_count)
+{
+    _llk_math_transpose_dest_init_<true, is_fp32_dest_acc_en>();
+    for (uint32_t i = first_tile; i < first_tile + tile_count; i++)
+    {
+#ifdef ARCH_BLACKHOLE
+        _llk_math_transpose_dest_<is_fp32_dest_acc_en, true, is_fp32_dest_acc_en>(i);
+#else
+        _llk_math_transpose_dest_<true, is_fp32_dest_acc_en>(i);
+#endif
+    }
+}
+
+void run_kernel()
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(0, 0, 4, formats.math);
+#else
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(0, 0, 4, formats.math);
+#endif
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<false, false>(formats.math, formats.math);
+
+    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+    for (uint32_t i = 0; i < GATHER_SRC_TILES; i++)
+    {
+        _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+            i, formats.math, formats.math);
+    }
+
+    // index_select along columns gathers the rows of the transposed tiles
+    if constexpr (GATHER_OPERATION == SfpuType::gather_columns)
+    {
+        transpose_tiles(0, GATHER_SRC_TILES);
+    }
+
+    _llk_math_eltwise_unary_sfpu_init_<GATHER_OPERATION>();
+    _llk_math_eltwise_unary_sfpu_start_<DstSync::SyncHalf>(0);
+
+    for (uint32_t i = 0; i < GATHER_DST_TILES; i++)
+    {
+        _sfpu_clear_dest_tile_<is_fp32_dest_acc_en>(GATHER_SRC_TILES + i);
+    }
+
+    if constexpr (GATHER_OPERATION == SfpuType::gather_rows || GATHER_OPERATION == SfpuType::gather_columns)
+    {
+        // One source tile per call, as a table too large for Dest would be gathered chunk by chunk
+        for (uint32_t dst = 0; dst < GATHER_DST_TILES; dst++)
+        {
+            const uint32_t idx_addr = buffer_B[0] + dst * 32 * sizeof(GatherIndex);
+            for (uint32_t src = 0; src < GATHER_SRC_TILES; src++)
+            {
+                _calculate_gather_rows_<GatherIndex>(idx_addr, src, 1, GATHER_SRC_TILES + dst, src * 32);
+            }
+        }
+    }
+    else
+    {
+        constexpr GatherMode mode = GATHER_OPERATION == SfpuType::scatter_add_rows ? GatherMode::ACCUMULATE : GatherMode::COPY;
+        for (uint32_t src = 0; src < GATHER_SRC_TILES; src++)
+        {
+            const uint32_t idx_addr = buffer_B[0] + src * 32 * sizeof(GatherIndex);
+            _calculate_scatter_rows_<GatherIndex, mode>(idx_addr, src, GATHER_SRC_TILES, GATHER_DST_TILES);
+        }
+    }
+
+    _llk_math_eltwise_unary_sfpu_done_();
+
+    if constexpr (GATHER_OPERATION == SfpuType::gather_columns)
+    {
+        transpose_tiles(GATHER_SRC_TILES, GATHER_DST_TILES);
+    }
+
+    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel()
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#endif
+
+    _llk_pack_init_<false, false, DstTileFaceLayout::RowMajor, false>(formats.pack_dst);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileFaceLayout::RowMajor>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, false, DstTileFaceLayout::RowMajor, false>();
+#endif
+
+    _llk_packer_wait_for_math_done_();
+    for (uint32_t i = 0; i < GATHER_DST_TILES; i++)
+    {
+        _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(GATHER_SRC_TILES + i, L1_ADDRESS(buffer_Res[i]));
+    }
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
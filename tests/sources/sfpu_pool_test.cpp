@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+uint32_t unp_cfg_context          = 0;
+uint32_t pack_sync_tile_dst_ptr   = 0;
+uint32_t math_sync_tile_dst_index = 0;
+
+// Every output position is one Dest section: its POOL_WINDOW_TILES window tiles from buffer_A, for max pooling
+// followed by as many integer indices tiles from buffer_B in POOL_INDEX_FORMAT.
+constexpr bool with_indices = POOL_TYPE == ckernel::PoolType::MAX;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel()
+{
+    _llk_unpack_A_hw_configure_<is_fp32_dest_acc_en, StochRndType::None>(formats.unpack_src, formats.unpack_dst, FACE_R_DIM, 0, 4);
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_src, formats.unpack_dst);
+
+    for (uint32_t position = 0; position < POOL_OUTPUTS; position++)
+    {
+        for (uint32_t i = 0; i < POOL_WINDOW_TILES; i++)
+        {
+            _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+                L1_ADDRESS(buffer_A[position * POOL_WINDOW_TILES + i]), 0, formats.unpack_src, formats.unpack_dst);
+        }
+        if constexpr (with_indices)
+        {
+            _llk_unpack_reconfig_data_format_srca_impl_<is_fp32_dest_acc_en, false>(POOL_INDEX_FORMAT, POOL_INDEX_FORMAT, POOL_INDEX_TILE_SIZE);
+            for (uint32_t i = 0; i < POOL_WINDOW_TILES; i++)
+            {
+                _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+                    L1_ADDRESS(buffer_B[position * POOL_WINDOW_TILES + i]), 0, POOL_INDEX_FORMAT, POOL_INDEX_FORMAT);
+            }
+            _llk_unpack_reconfig_data_format_srca_impl_<is_fp32_dest_acc_en, false>(formats.unpack_src, formats.unpack_dst, TILE_SIZE_UNPACK_A);
+        }
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu.h"
+
+using namespace ckernel;
+using namespace ckernel::sfpu;
+
+// Int32 indices need the integer math mode of 32-bit Dest, UInt16 ones go through as they are
+constexpr bool int32_indices = POOL_INDEX_FORMAT == static_cast<std::underlying_type_t<DataFormat>>(DataFormat::Int32);
+
+void run_kernel()
+{
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<false, false>(formats.math, formats.math);
+
+    for (uint32_t position = 0; position < POOL_OUTPUTS; position++)
+    {
+#ifdef ARCH_BLACKHOLE
+        _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(0, 0, 4, formats.math);
+#else
+        _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(0, 0, 4, formats.math);
+#endif
+        _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+        for (uint32_t i = 0; i < POOL_WINDOW_TILES; i++)
+        {
+            _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+                i, formats.math, formats.math);
+        }
+        if constexpr (with_indices)
+        {
+            _llk_math_reconfig_data_format_srca_<is_fp32_dest_acc_en, int32_indices>(POOL_INDEX_FORMAT);
+            for (uint32_t i = 0; i < POOL_WINDOW_TILES; i++)
+            {
+                _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+                    POOL_WINDOW_TILES + i, POOL_INDEX_FORMAT, POOL_INDEX_FORMAT);
+            }
+            _llk_math_reconfig_data_format_srca_<is_fp32_dest_acc_en, int32_indices>(formats.math);
+        }
+
+        _llk_math_eltwise_unary_sfpu_init_<SfpuType::reduce>();
+        _llk_math_eltwise_unary_sfpu_start_<DstSync::SyncHalf>(0);
+        if constexpr (with_indices)
+        {
+            _init_max_pool_window_with_indices_();
+            _calculate_max_pool_window_with_indices_<is_fp32_dest_acc_en>(0, POOL_WINDOW_TILES, POOL_WINDOW_SIZE);
+        }
+        else
+        {
+            _init_avg_pool_window_();
+            _calculate_avg_pool_window_(0, POOL_WINDOW_SIZE, POOL_SCALES[position]);
+        }
+        _llk_math_eltwise_unary_sfpu_done_();
+
+        _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel()
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#endif
+
+    _llk_pack_init_<false, false, DstTileFaceLayout::RowMajor, false>(formats.pack_dst);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileFaceLayout::RowMajor>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, false, DstTileFaceLayout::RowMajor, false>();
+#endif
+
+    // The result of every position is row 0 of its first window tile and, for max pooling, of its first indices tile.
+    // The values tiles fill buffer_Res in position order, the indices tiles follow them.
+    for (uint32_t position = 0; position < POOL_OUTPUTS; position++)
+    {
+        _llk_packer_wait_for_math_done_();
+        _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(0, L1_ADDRESS(buffer_Res[position]));
+        if constexpr (with_indices)
+        {
+            _llk_pack_reconfig_data_format_<is_fp32_dest_acc_en>(POOL_INDEX_FORMAT, POOL_INDEX_FORMAT, POOL_INDEX_TILE_SIZE);
+            _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(POOL_WINDOW_TILES, L1_ADDRESS(buffer_Res[POOL_OUTPUTS + position]));
+            _llk_pack_reconfig_data_format_<is_fp32_dest_acc_en>(formats.pack_src, formats.pack_dst, TILE_SIZE_PACK);
+        }
+        _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    }
+}
+
+#endif
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+#include "profiler.h"
+
+// Globals
+uint32_t unp_cfg_context          = 0;
+uint32_t pack_sync_tile_dst_ptr   = 0;
+uint32_t math_sync_tile_dst_index = 0;
+
+// The TILE_CNT tiles of buffer_A are one 32 * TILE_CNT rows tall column, reduced into row 0 of Dest tile 0. A column
+// taller than a Dest section streams through it: the tiles after the first section are unpacked behind Dest tile 0,
+// which keeps the running values.
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel()
+{
+    _llk_unpack_A_hw_configure_<is_fp32_dest_acc_en, StochRndType::None>(formats.unpack_src, formats.unpack_dst, FACE_R_DIM, 0, 4);
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_src, formats.unpack_dst);
+
+    for (uint32_t i = 0; i < TILE_CNT; i++)
+    {
+        _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+            L1_ADDRESS(buffer_A[i]), 0, formats.unpack_src, formats.unpack_dst);
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+#include "llk_math_eltwise_unary_sfpu.h"
+
+using namespace ckernel;
+using namespace ckernel::sfpu;
+
+// Tiles of a half Dest section: 4 of 32-bit Dest, 8 of 16-bit Dest
+constexpr uint32_t section_tiles = is_fp32_dest_acc_en ? 4 : 8;
+static_assert(POOL_TYPE == PoolType::SUM || TILE_CNT <= section_tiles, "A streamed column is summed only");
+
+void run_kernel()
+{
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<false, false>(formats.math, formats.math);
+
+    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+    for (uint32_t done = 0; done < TILE_CNT;)
+    {
+        const bool accumulate    = done > 0;
+        const uint32_t first     = accumulate ? 1 : 0;
+        const uint32_t remaining = TILE_CNT - done;
+        const uint32_t count     = remaining < section_tiles - first ? remaining : section_tiles - first;
+
+#ifdef ARCH_BLACKHOLE
+        _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, false>(0, 0, 4, formats.math);
+#else
+        _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false>(0, 0, 4, formats.math);
+#endif
+        for (uint32_t i = 0; i < count; i++)
+        {
+            _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+                first + i, formats.math, formats.math);
+        }
+
+        _llk_math_eltwise_unary_sfpu_init_<SfpuType::reduce>();
+        _init_reduce_<DataFormat::Float32>();
+        _llk_math_eltwise_unary_sfpu_start_<DstSync::SyncHalf>(0);
+        {
+            ZONE_SCOPED("REDUCE_SUMMATION")
+            if (accumulate)
+            {
+                _calculate_reduce_tiles_<PoolType::SUM, REDUCE_DIM, static_cast<DataFormat>(formats.math), REDUCE_SUMMATION, true>(count);
+            }
+            else
+            {
+                _calculate_reduce_tiles_<POOL_TYPE, REDUCE_DIM, static_cast<DataFormat>(formats.math), REDUCE_SUMMATION>(count);
+            }
+            PROFILER_SYNC();
+        }
+        _llk_math_eltwise_unary_sfpu_done_();
+        done += count;
+    }
+
+    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel()
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#endif
+
+    _llk_pack_init_<false, false, DstTileFaceLayout::RowMajor, false>(formats.pack_dst);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileFaceLayout::RowMajor>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, false, DstTileFaceLayout::RowMajor, false>();
+#endif
+
+    _llk_packer_wait_for_math_done_();
+    _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(0, L1_ADDRESS(buffer_Res[0]));
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdint>
+#include <cstdio>
+
+#include "ckernel.h"
+#include "llk_defs.h"
+#include "params.h"
+
+// Globals
+uint32_t unp_cfg_context          = 0;
+uint32_t pack_sync_tile_dst_ptr   = 0;
+uint32_t math_sync_tile_dst_index = 0;
+
+// Dest holds the TILE_CNT tiles of one head (x), then as many angle or position tiles, then the inverse
+// frequency tiles when the angles are computed from positions
+constexpr uint32_t ANGLE_TILES = ROPE_ANGLES == ckernel::sfpu::RopeAngles::FROM_POSITIONS ? 2 * TILE_CNT : TILE_CNT;
+
+#ifdef LLK_TRISC_UNPACK
+
+#include "llk_unpack_A.h"
+#include "llk_unpack_common.h"
+
+void run_kernel()
+{
+    _llk_unpack_A_hw_configure_<is_fp32_dest_acc_en, StochRndType::None>(formats.unpack_src, formats.unpack_dst, FACE_R_DIM, 0, 4);
+    _llk_unpack_A_init_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+        0, 0, FACE_R_DIM, 4, formats.unpack_src, formats.unpack_dst);
+
+    for (int i = 0; i < TILE_CNT; i++)
+    {
+        _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+            L1_ADDRESS(buffer_A[i]), 0, formats.unpack_src, formats.unpack_dst);
+    }
+    for (int i = 0; i < TILE_CNT; i++)
+    {
+        _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+            L1_ADDRESS(buffer_B[i]), 0, formats.unpack_src, formats.unpack_dst);
+    }
+    if constexpr (ROPE_ANGLES == ckernel::sfpu::RopeAngles::FROM_POSITIONS)
+    {
+        for (int i = 0; i < TILE_CNT; i++)
+        {
+            _llk_unpack_A_<BroadcastType::NONE, false, EltwiseBinaryReuseDestType::NONE, unpack_to_dest>(
+                L1_ADDRESS(buffer_C[i]), 0, formats.unpack_src, formats.unpack_dst);
+        }
+    }
+}
+
+#endif
+
+#ifdef LLK_TRISC_MATH
+
+#include "ckernel_defs.h"
+#include "ckernel_sfpu.h"
+#include "llk_math_common.h"
+#include "llk_math_eltwise_binary_sfpu.h"
+#include "llk_math_eltwise_unary_datacopy.h"
+
+using namespace ckernel::sfpu;
+
+void run_kernel()
+{
+    const bool is_int_fpu_en = false;
+
+    _llk_math_pack_sync_init_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+    _llk_math_hw_configure_<false, false>(formats.math, formats.math);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, false, is_int_fpu_en>(0, 0, 4, formats.math);
+#else
+    _llk_math_eltwise_unary_datacopy_init_<DataCopyType::A2D, is_fp32_dest_acc_en, BroadcastType::NONE, is_int_fpu_en>(0, 0, 4, formats.math);
+#endif
+
+    _llk_math_wait_for_dest_available_<DstSync::SyncHalf>();
+    for (uint32_t i = 0; i < TILE_CNT + ANGLE_TILES; i++)
+    {
+        _llk_math_eltwise_unary_datacopy_<DataCopyType::A2D, DstSync::SyncHalf, is_fp32_dest_acc_en, BroadcastType::NONE, unpack_to_dest>(
+            i, formats.math, formats.math);
+    }
+
+    _llk_math_eltwise_binary_sfpu_init_<SfpuType::rope>();
+    _init_rope_();
+
+    if constexpr (ROPE_LAYOUT == RopeLayout::HALF_SPLIT && TILE_CNT == 2)
+    {
+        // head_dim 64, column c of tile 0 pairs with column c of tile 1
+        _llk_math_eltwise_binary_sfpu_start_<DstSync::SyncHalf>(0);
+        _calculate_rope_<APPROX_MODE, ROPE_LAYOUT, ROPE_ANGLES>(0, 1, TILE_CNT, 2 * TILE_CNT);
+        _llk_math_eltwise_binary_sfpu_done_();
+    }
+    else
+    {
+        for (uint32_t i = 0; i < TILE_CNT; i++)
+        {
+            _llk_math_eltwise_binary_sfpu_start_<DstSync::SyncHalf>(0);
+            _calculate_rope_<APPROX_MODE, ROPE_LAYOUT, ROPE_ANGLES>(i, i, TILE_CNT + i, 2 * TILE_CNT + i);
+            _llk_math_eltwise_binary_sfpu_done_();
+        }
+    }
+
+    _llk_math_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
+
+#ifdef LLK_TRISC_PACK
+
+#include "llk_pack.h"
+#include "llk_pack_common.h"
+
+void run_kernel()
+{
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#else
+    _llk_pack_hw_configure_<is_fp32_dest_acc_en, false>(formats.pack_src, formats.pack_dst, 16 * 16 * 4);
+#endif
+
+    _llk_pack_init_<false, false, DstTileFaceLayout::RowMajor, false>(formats.pack_dst);
+
+#ifdef ARCH_BLACKHOLE
+    _llk_pack_dest_init_<DstSync::SyncHalf, is_fp32_dest_acc_en, DstTileFaceLayout::RowMajor>();
+#else
+    _llk_pack_dest_init_<DstSync::SyncHalf, false, DstTileFaceLayout::RowMajor, false>();
+#endif
+
+    _llk_packer_wait_for_math_done_();
+    for (int i = 0; i < TILE_CNT; i++)
+    {
+        _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, false>(i, L1_ADDRESS(buffer_Res[i]));
+    }
+    _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
+}
+
+#endif
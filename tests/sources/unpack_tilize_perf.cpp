@@ -35,7 +35,6 @@ static constexpr uint32_t MAX_TILES_DEST = is_fp32_dest_acc_en ? 4 : 8;
 
 void run_kernel()
 {
-    constexpr uint32_t src = 0x1A000;
     {
         ZONE_SCOPED("INIT")
         _llk_unpack_tilize_hw_configure_<is_fp32_dest_acc_en, StochRndType::None>(formats.unpack_src, formats.unpack_dst, FACE_R_DIM, 0, 4);
@@ -56,8 +55,7 @@ void run_kernel()
             {
                 for (uint32_t j = 0; j < BLOCK_CT_DIM; j++)
                 {
-                    _llk_unpack_tilize_(
-                        L1_ADDRESS(src + (i % 8) * 0x1000), j, formats.unpack_src, BLOCK_CT_DIM, FACE_R_DIM, 4, false); // TODO SS<-LP use PERF_ADDRESS here
+                    _llk_unpack_tilize_(PERF_ADDRESS(PERF_INPUT_A, i * BLOCK_CT_DIM), j, formats.unpack_src, BLOCK_CT_DIM, FACE_R_DIM, 4, false);
                 }
             }
         }
@@ -159,8 +157,7 @@ void run_kernel()
 
 void run_kernel()
 {
-    constexpr uint32_t dst = 0x1E000;
-    const bool UNTILIZE    = false;
+    const bool UNTILIZE = false;
 
     {
         ZONE_SCOPED("INIT")
@@ -190,7 +187,7 @@ void run_kernel()
             {
                 for (uint32_t i = 0; i < TILE_CNT; ++i)
                 {
-                    _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, UNTILIZE>(i, L1_ADDRESS(dst + (i % 8) * 0x1000)); // TODO SS<-LP use PERF_ADDRESS here
+                    _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, UNTILIZE>(i, PERF_ADDRESS(PERF_OUTPUT, i));
                 }
             }
             PROFILER_SYNC();
@@ -206,7 +203,7 @@ void run_kernel()
                 _llk_packer_wait_for_math_done_();
                 for (uint32_t i = 0; i < num_tiles; ++i)
                 {
-                    _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, UNTILIZE>(i, L1_ADDRESS(dst + (i % 8) * 0x1000)); // TODO SS<-LP use PERF_ADDRESS here
+                    _llk_pack_<DstSync::SyncHalf, is_fp32_dest_acc_en, UNTILIZE>(i, PERF_ADDRESS(PERF_OUTPUT, TILE_CNT - remaining_tiles + i));
                 }
                 _llk_pack_dest_section_done_<DstSync::SyncHalf, is_fp32_dest_acc_en>();
                 remaining_tiles -= num_tiles;
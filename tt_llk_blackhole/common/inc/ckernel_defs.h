@@ -251,4 +251,12 @@ enum class BinaryOp : uint8_t
     LOGICAL_RSHFT = 9
 };
 
+// Second operand of the broadcast SFPU binary ops, in place of a full Dest tile
+enum class BinaryBroadcast : uint8_t
+{
+    Scalar, // a value, repeated over the tile
+    Row,    // one row of a Dest tile, repeated down the 32 rows
+    Column, // one column of a Dest tile, repeated across the 32 columns
+};
+
 } // namespace ckernel
@@ -6,6 +6,7 @@
 
 #include <limits>
 
+#include "../../../tt_llk_common/sfpu/ckernel_sfpu_common_activations.h"
 #include "ckernel.h"
 #include "ckernel_defs.h"
 #include "ckernel_globals.h"
@@ -13,23 +14,28 @@
 #include "sfpu/ckernel_sfpu_abs.h"
 #include "sfpu/ckernel_sfpu_activations.h"
 #include "sfpu/ckernel_sfpu_add_int.h"
+#include "sfpu/ckernel_sfpu_arg_reduce.h"
 #include "sfpu/ckernel_sfpu_binary.h"
+#include "sfpu/ckernel_sfpu_binary_bcast.h"
 #include "sfpu/ckernel_sfpu_binary_bitwise.h"
 #include "sfpu/ckernel_sfpu_cast_fp32_to_fp16a.h"
 #include "sfpu/ckernel_sfpu_clamp.h"
 #include "sfpu/ckernel_sfpu_comp.h"
 #include "sfpu/ckernel_sfpu_converter.h"
 #include "sfpu/ckernel_sfpu_cumsum.h"
+#include "sfpu/ckernel_sfpu_div_int.h"
 #include "sfpu/ckernel_sfpu_dropout.h"
 #include "sfpu/ckernel_sfpu_elu.h"
 #include "sfpu/ckernel_sfpu_ema.h"
 #include "sfpu/ckernel_sfpu_exp.h"
 #include "sfpu/ckernel_sfpu_exp2.h"
 #include "sfpu/ckernel_sfpu_fill.h"
+#include "sfpu/ckernel_sfpu_gather.h"
 #include "sfpu/ckernel_sfpu_gelu.h"
 #include "sfpu/ckernel_sfpu_hardtanh.h"
 #include "sfpu/ckernel_sfpu_is_fp16_zero.h"
 #include "sfpu/ckernel_sfpu_isinf_isnan.h"
+#include "sfpu/ckernel_sfpu_linear_scan.h"
 #include "sfpu/ckernel_sfpu_load_config.h"
 #include "sfpu/ckernel_sfpu_log.h"
 #include "sfpu/ckernel_sfpu_max.h"
@@ -37,11 +43,14 @@
 #include "sfpu/ckernel_sfpu_max_pool_indices.h"
 #include "sfpu/ckernel_sfpu_mul_int.h"
 #include "sfpu/ckernel_sfpu_negative.h"
+#include "sfpu/ckernel_sfpu_piecewise.h"
+#include "sfpu/ckernel_sfpu_pool.h"
 #include "sfpu/ckernel_sfpu_quant.h"
 #include "sfpu/ckernel_sfpu_recip.h"
 #include "sfpu/ckernel_sfpu_reduce.h"
 #include "sfpu/ckernel_sfpu_relu.h"
 #include "sfpu/ckernel_sfpu_reshuffle_rows.h"
+#include "sfpu/ckernel_sfpu_rope.h"
 #include "sfpu/ckernel_sfpu_rounding_ops.h"
 #include "sfpu/ckernel_sfpu_rsqrt.h"
 #include "sfpu/ckernel_sfpu_shift.h"
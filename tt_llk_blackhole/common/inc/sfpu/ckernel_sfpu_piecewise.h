@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ckernel_sfpu_polyval.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+/**
+ * @brief Piecewise polynomial approximation of a scalar function
+ *
+ * Segment 0 covers x < breakpoints[0], segment i covers breakpoints[i - 1] <= x < breakpoints[i] and the
+ * last segment covers x >= breakpoints[SEGMENTS - 2]. coeffs[i] holds the ORDER + 1 coefficients of segment
+ * i in ascending powers of x. Tables are generated on the host by tests/python_tests/helpers/piecewise.py.
+ *
+ * @tparam SEGMENTS Number of segments, including the tails below the first and above the last breakpoint
+ * @tparam ORDER 1 for piecewise linear, 2 for piecewise quadratic
+ */
+template <int SEGMENTS, int ORDER>
+struct PiecewiseTable
+{
+    static_assert(SEGMENTS >= 1, "a piecewise table needs at least one segment");
+    static_assert(ORDER >= 0 && ORDER <= 3, "the coefficients of the selected segment have to fit in the LRegs");
+
+    float breakpoints[SEGMENTS > 1 ? SEGMENTS - 1 : 1];
+    float coeffs[SEGMENTS][ORDER + 1];
+};
+
+/**
+ * @brief Evaluates the piecewise polynomial in table at x
+ *
+ * The SFPU has no per-lane table lookup beyond the fixed six entry SFPLUT, so every lane walks all the
+ * breakpoints and a lane takes the coefficients of each segment whose breakpoint it reaches. The breakpoints
+ * ascend, so the last assignment is the segment of x. The cost is one compare and ORDER + 1 coefficient loads
+ * per breakpoint and ORDER SFPMADs, whatever the data. Coefficients that are exact in bf16 load with a single
+ * SFPLOADI, helpers.piecewise --coeff-format bf16 rounds them that way.
+ */
+template <int SEGMENTS, int ORDER>
+sfpi_inline sfpi::vFloat _sfpu_piecewise_(sfpi::vFloat x, const PiecewiseTable<SEGMENTS, ORDER> &table)
+{
+    sfpi::vFloat coeffs[ORDER + 1];
+#pragma GCC unroll 4
+    for (int k = 0; k <= ORDER; k++)
+    {
+        coeffs[k] = table.coeffs[0][k];
+    }
+
+#pragma GCC unroll 64
+    for (int i = 1; i < SEGMENTS; i++)
+    {
+        v_if (x >= table.breakpoints[i - 1])
+        {
+#pragma GCC unroll 4
+            for (int k = 0; k <= ORDER; k++)
+            {
+                coeffs[k] = table.coeffs[i][k];
+            }
+        }
+        v_endif;
+    }
+
+    return PolynomialEvaluator<ORDER + 1, sfpi::vFloat, sfpi::vFloat>::eval(coeffs, x);
+}
+
+/**
+ * @brief Applies the activation approximated by table to ITERATIONS rows of Dest
+ *
+ * New activations only need a table from helpers.piecewise, the SFPU sequence is the same for all of them.
+ * The table is usually constexpr so the breakpoints and coefficients fold into SFPLOADI immediates.
+ */
+template <bool APPROXIMATION_MODE, int ITERATIONS, int SEGMENTS, int ORDER>
+inline void _calculate_piecewise_(const PiecewiseTable<SEGMENTS, ORDER> &table)
+{
+#pragma GCC unroll 0
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::vFloat x   = sfpi::dst_reg[0];
+        sfpi::dst_reg[0] = _sfpu_piecewise_(x, table);
+        sfpi::dst_reg++;
+    }
+}
+
+} // namespace ckernel::sfpu
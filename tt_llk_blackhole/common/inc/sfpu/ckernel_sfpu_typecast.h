@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <limits>
 
 #include "ckernel_addrmod.h"
@@ -301,5 +302,408 @@ inline void _calculate_typecast_int32_to_uint16_()
     }
 }
 
+// Signed integers are handled in 2's complement, the form SFPCAST works with on Blackhole.
+// The magnitude is unsigned: -2^31 maps to 2^31, which negates back to -2^31.
+inline sfpi::vInt _typecast_int_magnitude_(sfpi::vInt in)
+{
+    v_if (in < 0)
+    {
+        in = (~in) + 1;
+    }
+    v_endif;
+    return in;
+}
+
+inline sfpi::vInt _typecast_negate_int_(sfpi::vInt mag)
+{
+    return (~mag) + 1;
+}
+
+// Generic typecast between every pair of the formats below with a selectable rounding mode.
+// Integer formats narrower than 32 bits (Int16, Int8, UInt8) are kept in Dest as saturated int32 values and
+// narrowed by the packer, the same way the quantization kernels hand their results over.
+enum class TypecastFormat : std::uint8_t
+{
+    Float32,
+    Float16,
+    Float16_b,
+    Tf32,
+    Int32,
+    UInt32,
+    Int16,
+    UInt16,
+    Int8,
+    UInt8,
+};
+
+enum class TypecastRounding : std::uint8_t
+{
+    NearestEven,
+    Stochastic,
+    Truncate,
+};
+
+constexpr bool _typecast_is_float_(TypecastFormat format)
+{
+    return format == TypecastFormat::Float32 || format == TypecastFormat::Float16 || format == TypecastFormat::Float16_b || format == TypecastFormat::Tf32;
+}
+
+constexpr bool _typecast_is_unsigned_(TypecastFormat format)
+{
+    return format == TypecastFormat::UInt32 || format == TypecastFormat::UInt16 || format == TypecastFormat::UInt8;
+}
+
+// Largest value of an integer format, signed formats reach one further on the negative side
+constexpr std::uint32_t _typecast_int_max_(TypecastFormat format)
+{
+    switch (format)
+    {
+        case TypecastFormat::Int32:
+            return 0x7FFFFFFF;
+        case TypecastFormat::UInt32:
+            return 0xFFFFFFFF;
+        case TypecastFormat::Int16:
+            return 0x7FFF;
+        case TypecastFormat::UInt16:
+            return 0xFFFF;
+        case TypecastFormat::Int8:
+            return 0x7F;
+        default:
+            return 0xFF;
+    }
+}
+
+// SFP_STOCH_RND / SFPCAST rounding mode, truncation is done by clearing bits before an exact conversion
+constexpr int _typecast_rnd_mode_(TypecastRounding rounding)
+{
+    return rounding == TypecastRounding::Stochastic ? 1 : 0;
+}
+
+// Rounds toward zero to an integral value
+inline sfpi::vFloat _typecast_trunc_(sfpi::vFloat in)
+{
+    sfpi::vFloat result = in;
+    sfpi::vInt exp      = exexp(in);
+    v_if (exp < 0)
+    {
+        result = 0.0f;
+    }
+    v_elseif (exp < 23)
+    {
+        // shift out the fraction bits, the integral part fits the mantissa so converting back is exact
+        sfpi::vInt man = sfpi::shft(sfpi::reinterpret<sfpi::vUInt>(exman8(in)), exp - 23);
+        result         = sfpi::setsgn(int32_to_float(man, 0), in);
+    }
+    v_endif;
+    return result;
+}
+
+// Rounds to an integral value. SFP_STOCH_RND only rounds into 16 bits, so |in| is split into a multiple of 256 and a
+// remainder below 256: the high part is even, so rounding the remainder (ties to even or stochastically) rounds the whole.
+template <TypecastRounding ROUNDING>
+inline sfpi::vFloat _typecast_round_integral_(sfpi::vFloat in)
+{
+    if constexpr (ROUNDING == TypecastRounding::Truncate)
+    {
+        return _typecast_trunc_(in);
+    }
+    else
+    {
+        sfpi::vFloat result = in;
+        v_if (exexp(in) < 23)
+        {
+            sfpi::vFloat mag  = sfpi::setsgn(in, 0);
+            sfpi::vFloat high = _typecast_trunc_(mag * 0x1p-8f) * 256.0f;
+            sfpi::vInt low    = sfpi::reinterpret<sfpi::vInt>(float_to_uint16(mag - high, _typecast_rnd_mode_(ROUNDING)));
+            result            = sfpi::setsgn(high + int32_to_float(low, 0), in);
+        }
+        v_endif;
+        return result;
+    }
+}
+
+// Converts a non-negative integral float below 2^32 to an unsigned integer
+inline sfpi::vInt _typecast_float_to_magnitude_(sfpi::vFloat mag)
+{
+    sfpi::vInt result = 0;
+    sfpi::vInt exp    = exexp(mag);
+    v_if (exp == 31)
+    {
+        // shift the mantissa without the hidden bit and set it back through the sign (shifting a 1 into MSB is broken)
+        sfpi::vInt man = sfpi::shft(sfpi::reinterpret<sfpi::vUInt>(exman9(mag)), exp - 23);
+        result         = sfpi::reinterpret<sfpi::vInt>(sfpi::setsgn(sfpi::reinterpret<sfpi::vFloat>(man), 1));
+    }
+    v_elseif (exp >= 0)
+    {
+        result = sfpi::shft(sfpi::reinterpret<sfpi::vUInt>(exman8(mag)), exp - 23);
+    }
+    v_endif;
+    return result;
+}
+
+// Keeps at most 24 significant bits of an unsigned integer so that int32_to_float is exact. Truncation clears the
+// dropped bits, the other modes fold them into the lowest kept bit (rounding to odd): the value then stays strictly
+// between the same two neighbours in any float with at most 22 mantissa bits, so rounding it there rounds only once.
+template <TypecastRounding ROUNDING>
+inline sfpi::vInt _typecast_narrow_to_float_precision_(sfpi::vInt mag)
+{
+    sfpi::vInt shift = lz(mag) - 8;
+    v_if (shift < 0)
+    {
+        sfpi::vUInt kept = sfpi::shft(sfpi::reinterpret<sfpi::vUInt>(mag), shift);
+        if constexpr (ROUNDING != TypecastRounding::Truncate)
+        {
+            v_if (sfpi::reinterpret<sfpi::vInt>(sfpi::shft(kept, -shift)) != mag)
+            {
+                kept = kept | 1;
+            }
+            v_endif;
+        }
+        mag = sfpi::reinterpret<sfpi::vInt>(sfpi::shft(kept, -shift));
+    }
+    v_endif;
+    return mag;
+}
+
+template <TypecastFormat OUT, TypecastRounding ROUNDING>
+inline sfpi::vFloat _typecast_round_float_(sfpi::vFloat in)
+{
+    constexpr int rnd = _typecast_rnd_mode_(ROUNDING);
+    if constexpr (OUT == TypecastFormat::Float16_b)
+    {
+        if constexpr (ROUNDING == TypecastRounding::Truncate)
+        {
+            return sfpi::reinterpret<sfpi::vFloat>(sfpi::reinterpret<sfpi::vUInt>(in) & 0xFFFF0000);
+        }
+        else
+        {
+            return sfpi::reinterpret<sfpi::vFloat>(float_to_fp16b(in, rnd));
+        }
+    }
+    else if constexpr (OUT == TypecastFormat::Float16)
+    {
+        if constexpr (ROUNDING == TypecastRounding::Truncate)
+        {
+            // drop the 13 mantissa bits fp16 does not have, the conversion then only handles the exponent range
+            in = sfpi::reinterpret<sfpi::vFloat>(sfpi::reinterpret<sfpi::vUInt>(in) & 0xFFFFE000);
+        }
+        return sfpi::reinterpret<sfpi::vFloat>(float_to_fp16a(in, rnd));
+    }
+    else if constexpr (OUT == TypecastFormat::Tf32)
+    {
+        // tf32 keeps 10 mantissa bits, rounding is done on the fp32 encoding so a carry rolls into the exponent
+        sfpi::vUInt bits = sfpi::reinterpret<sfpi::vUInt>(in);
+        if constexpr (ROUNDING == TypecastRounding::NearestEven)
+        {
+            bits = bits + 0xFFF + (sfpi::shft(bits, -13) & 1);
+        }
+        else if constexpr (ROUNDING == TypecastRounding::Stochastic)
+        {
+            // round the dropped fraction to 0 or 1 with probability equal to its value
+            sfpi::vFloat fraction = int32_to_float(sfpi::reinterpret<sfpi::vInt>(bits & 0x1FFF), 0) * 0x1p-13f;
+            bits                  = bits + sfpi::shft(float_to_uint8(fraction, 1), 13);
+        }
+        return sfpi::reinterpret<sfpi::vFloat>(bits & 0xFFFFE000);
+    }
+    else
+    {
+        return in;
+    }
+}
+
+template <TypecastFormat OUT, TypecastRounding ROUNDING>
+inline sfpi::vInt _typecast_float_to_int_(sfpi::vFloat in)
+{
+    constexpr std::uint32_t max_value = _typecast_int_max_(OUT);
+
+    sfpi::vFloat mag = sfpi::setsgn(in, 0);
+    if constexpr (_typecast_is_unsigned_(OUT))
+    {
+        v_if (in < 0)
+        {
+            mag = 0.0f;
+        }
+        v_endif;
+    }
+    mag = _typecast_round_integral_<ROUNDING>(mag);
+
+    // signed formats reach one further on the negative side, for Int32 -2^31 negates to itself
+    sfpi::vFloat limit   = static_cast<float>(max_value) + 1.0f;
+    sfpi::vInt saturated = static_cast<std::int32_t>(max_value);
+    if constexpr (!_typecast_is_unsigned_(OUT))
+    {
+        v_if (in < 0)
+        {
+            limit     = static_cast<float>(max_value) + 2.0f;
+            saturated = static_cast<std::int32_t>(max_value + 1);
+        }
+        v_endif;
+    }
+
+    sfpi::vInt result;
+    v_if (mag >= limit)
+    {
+        result = saturated;
+    }
+    v_else
+    {
+        result = _typecast_float_to_magnitude_(mag);
+    }
+    v_endif;
+
+    if constexpr (!_typecast_is_unsigned_(OUT))
+    {
+        v_if (in < 0)
+        {
+            result = _typecast_negate_int_(result);
+        }
+        v_endif;
+    }
+    return result;
+}
+
+// Converts an integer to a float format with a single rounding. fp32 rounds in int32_to_float itself, narrower
+// formats round from a 24-bit value that int32_to_float converts exactly.
+template <TypecastFormat IN, TypecastFormat OUT, TypecastRounding ROUNDING>
+inline sfpi::vFloat _typecast_int_to_float_(sfpi::vInt in)
+{
+    constexpr int rnd         = _typecast_rnd_mode_(ROUNDING);
+    constexpr bool pre_narrow = OUT != TypecastFormat::Float32 || ROUNDING == TypecastRounding::Truncate;
+    sfpi::vFloat result;
+    if constexpr (IN == TypecastFormat::UInt32)
+    {
+        if constexpr (pre_narrow)
+        {
+            in = _typecast_narrow_to_float_precision_<ROUNDING>(in);
+        }
+        result = int32_to_float(in, rnd);
+        v_if (in < 0)
+        {
+            // MSB set: halve, keeping the dropped bit as a sticky bit below the rounding position, and double back
+            sfpi::vUInt bits = sfpi::reinterpret<sfpi::vUInt>(in);
+            sfpi::vUInt half = sfpi::shft(bits, -1) | (bits & 1);
+            result           = int32_to_float(sfpi::reinterpret<sfpi::vInt>(half), rnd) * 2.0f;
+        }
+        v_endif;
+    }
+    else
+    {
+        if constexpr (pre_narrow)
+        {
+            sfpi::vInt mag = _typecast_narrow_to_float_precision_<ROUNDING>(_typecast_int_magnitude_(in));
+            v_if (in < 0)
+            {
+                mag = _typecast_negate_int_(mag);
+            }
+            v_endif;
+            in = mag;
+        }
+        result = int32_to_float(in, rnd);
+    }
+    return _typecast_round_float_<OUT, ROUNDING>(result);
+}
+
+template <TypecastFormat IN, TypecastFormat OUT>
+inline sfpi::vInt _typecast_int_to_int_(sfpi::vInt in)
+{
+    constexpr std::uint32_t max_value = _typecast_int_max_(OUT);
+    if constexpr (IN == OUT || (IN != TypecastFormat::UInt32 && OUT == TypecastFormat::Int32))
+    {
+        // every value of the source fits
+        return in;
+    }
+    else if constexpr (IN == TypecastFormat::UInt32)
+    {
+        sfpi::vInt result = in;
+        if constexpr (OUT != TypecastFormat::UInt32)
+        {
+            // values with the MSB set read as negative and are above every other format's range
+            v_if (in < 0 || in > static_cast<std::int32_t>(max_value))
+            {
+                result = static_cast<std::int32_t>(max_value);
+            }
+            v_endif;
+        }
+        return result;
+    }
+    else
+    {
+        // the bounds are compared on the 2's complement value, the magnitude of -2^31 does not fit an int32
+        constexpr std::int32_t min_value = _typecast_is_unsigned_(OUT) ? 0 : -static_cast<std::int32_t>(max_value) - 1;
+        sfpi::vInt result                = in;
+        if constexpr (OUT == TypecastFormat::UInt32)
+        {
+            v_if (in < 0)
+            {
+                result = 0;
+            }
+            v_endif;
+        }
+        else
+        {
+            // the lower bound is tested first, so the upper one is never compared against -2^31
+            v_if (in < min_value)
+            {
+                result = min_value;
+            }
+            v_elseif (in > static_cast<std::int32_t>(max_value))
+            {
+                result = static_cast<std::int32_t>(max_value);
+            }
+            v_endif;
+        }
+        return result;
+    }
+}
+
+template <bool APPROXIMATION_MODE, int ITERATIONS, TypecastFormat IN, TypecastFormat OUT, TypecastRounding ROUNDING = TypecastRounding::NearestEven>
+inline void _calculate_typecast_()
+{
+#pragma GCC unroll 0
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        if constexpr (IN == TypecastFormat::UInt16)
+        {
+            // widen in place so the value can be read as a 32-bit integer
+            TTI_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::LO16, ADDR_MOD_7, 0);
+            TTI_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::INT32, ADDR_MOD_7, 0);
+        }
+
+        if constexpr (_typecast_is_float_(IN))
+        {
+            sfpi::vFloat in = sfpi::dst_reg[0];
+            if constexpr (_typecast_is_float_(OUT))
+            {
+                sfpi::dst_reg[0] = _typecast_round_float_<OUT, ROUNDING>(in);
+            }
+            else
+            {
+                sfpi::dst_reg[0] = _typecast_float_to_int_<OUT, ROUNDING>(in);
+            }
+        }
+        else
+        {
+            constexpr TypecastFormat SRC = IN == TypecastFormat::UInt16 ? TypecastFormat::UInt32 : IN;
+            sfpi::vInt in                = sfpi::dst_reg[0];
+            if constexpr (_typecast_is_float_(OUT))
+            {
+                sfpi::dst_reg[0] = _typecast_int_to_float_<SRC, OUT, ROUNDING>(in);
+            }
+            else
+            {
+                sfpi::dst_reg[0] = _typecast_int_to_int_<SRC, OUT>(in);
+            }
+        }
+
+        if constexpr (OUT == TypecastFormat::UInt16)
+        {
+            // value is already saturated to 16 bits, narrow it to the layout the packer reads for uint16
+            TTI_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::INT32, ADDR_MOD_7, 0);
+            TTI_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::LO16, ADDR_MOD_7, 0);
+        }
+        sfpi::dst_reg++;
+    }
+}
+
 } // namespace sfpu
 } // namespace ckernel
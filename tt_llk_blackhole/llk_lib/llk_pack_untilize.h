@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 
 #include "ckernel.h"
@@ -28,22 +29,21 @@ inline void _llk_pack_untilize_configure_addrmod_()
 }
 
 /*
-block_ct_dim represents the number of input tiles in a block.
-full_ct_dim represents the total number of input tiles.
+block_ct_dim represents the number of input tiles in a block, it is a runtime value so that
+every block width shares the same code. The templated _llk_pack_untilize_mop_config_ forwards here.
 */
-template <std::uint32_t block_ct_dim, std::uint32_t full_ct_dim = block_ct_dim, bool diagonal = false>
-inline void _llk_pack_untilize_mop_config_(
-    const std::uint32_t face_r_dim                = FACE_R_DIM,
-    const std::uint32_t num_faces                 = 4,
-    bool narrow_row                               = false,
-    [[maybe_unused]] std::uint32_t row_num_datums = TILE_C_DIM,
-    const std::uint32_t tile_dst_offset           = 0)
+inline void _llk_pack_untilize_stream_mop_config_(
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t face_r_dim      = FACE_R_DIM,
+    const std::uint32_t num_faces       = 4,
+    const bool narrow_row               = false,
+    const std::uint32_t tile_dst_offset = 0)
 {
     /*
     Outer loop iterates over the rows in the block, while the inner loop iterates
     over each tile in the block.
     */
-    constexpr uint MOP_INNER_LOOP = block_ct_dim;
+    const uint MOP_INNER_LOOP     = block_ct_dim;
     const uint MOP_OUTER_LOOP     = face_r_dim;
 
     // For narrow row, the faces are stored in the first column of the tile, therefore requiring only one packer interface.
@@ -129,6 +129,22 @@ inline void _llk_pack_untilize_mop_config_(
     tmp.program();
 }
 
+/*
+block_ct_dim represents the number of input tiles in a block.
+full_ct_dim represents the total number of input tiles.
+*/
+template <std::uint32_t block_ct_dim, std::uint32_t full_ct_dim = block_ct_dim, bool diagonal = false>
+inline void _llk_pack_untilize_mop_config_(
+    const std::uint32_t face_r_dim                = FACE_R_DIM,
+    const std::uint32_t num_faces                 = 4,
+    bool narrow_row                               = false,
+    [[maybe_unused]] std::uint32_t row_num_datums = TILE_C_DIM,
+    const std::uint32_t tile_dst_offset           = 0)
+{
+    static_assert(!diagonal, "Diagonal not supported");
+    _llk_pack_untilize_stream_mop_config_(block_ct_dim, face_r_dim, num_faces, narrow_row, tile_dst_offset);
+}
+
 static uint32_t tile_dst_offset_state = 0;
 
 template <
@@ -186,6 +202,79 @@ inline void _llk_pack_untilize_init_(
     }
 }
 
+/*
+Streaming untilize: block and row widths are runtime values, so any output width is served by one kernel.
+The output row of full_ct_dim tiles is produced block by block, each block is one Dest section of block_ct_dim tiles.
+block_ct_dim has to fit into the active Dest half (at most 8 tiles); full_ct_dim does not need to be a multiple of
+block_ct_dim, the last (narrower) block is handled by reprogramming the MOP inner loop.
+*/
+inline void _llk_pack_untilize_stream_init_(
+    const std::uint32_t pack_src_format,
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t full_ct_dim,
+    const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces  = 4)
+{
+    _llk_pack_untilize_configure_addrmod_<false>();
+
+    _llk_pack_untilize_stream_mop_config_(block_ct_dim, face_r_dim, num_faces);
+    tile_dst_offset_state = 0;
+
+    // Set CH0 Zstride = 2x16x16 faces, .z_src = {.incr = 1} jumps 2 faces
+    uint x_stride       = (uint)(pack_src_format & 0x3) == (uint)DataFormat::Float32 ? 4 : (uint)(pack_src_format & 0x3) == (uint)DataFormat::Float16 ? 2 : 1;
+    uint y_stride       = FACE_C_DIM * x_stride;
+    const uint z_stride = 2 * face_r_dim * y_stride;
+    cfg_reg_rmw_tensix<PCK0_ADDR_CTRL_ZW_REG_0_Zstride_RMW>(z_stride);
+
+    // Store 16B aligned row offset address
+    const std::uint32_t output_addr_offset = SCALE_DATUM_SIZE(pack_dst_format, full_ct_dim * ((num_faces > 1) ? (num_faces >> 1) : 1) * FACE_C_DIM);
+    TT_SETDMAREG(0, LOWER_HALFWORD(output_addr_offset / 16), 0, LO_16(p_gpr_pack::OUTPUT_ADDR_OFFSET));
+
+    // Program packer to pack out the correct number of datums per row
+    TT_SETADCXX(p_setadc::PAC, FACE_C_DIM - 1, 0x0);
+}
+
+/*
+Packs one block of block_ct_dim tiles from Dest into its column slice of the row-major output at address.
+The row stride of the output comes from OUTPUT_ADDR_OFFSET programmed at init, so the block width
+is the only dimension needed here.
+*/
+inline void _llk_pack_untilize_stream_block_(
+    const std::uint32_t address,
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t face_r_dim      = FACE_R_DIM,
+    const std::uint32_t num_faces       = 4,
+    const std::uint32_t tile_dst_offset = 0,
+    const bool narrow_row               = false)
+{
+    program_packer_destination(address);
+    const std::uint32_t num_faces_per_rdim_tile = (num_faces > 2) ? 2 : 1;
+
+    TT_SETADCZW(p_setadc::PAC, 0, 0, 0, 0, 0b0011); // reset ch0 zw counters
+    TT_SETADCXY(p_setadc::PAC, 0, 0, 0, 0, 0b0011); // reset ch0 xy counters
+
+    // Needs to be revisited for perf impact with https://github.com/tenstorrent/tt-llk/issues/632
+    // If starting_tile_dst_offset is non-zero, reconfigure the template with the correct offset
+    if (tile_dst_offset != tile_dst_offset_state)
+    {
+        _llk_pack_untilize_stream_mop_config_(block_ct_dim, face_r_dim, num_faces, narrow_row, tile_dst_offset);
+        tile_dst_offset_state = tile_dst_offset;
+    }
+
+    // Iterate over top, then over bottom faces in the block (if num_faces > 2)
+    for (std::uint32_t face = 0; face < num_faces_per_rdim_tile; face++)
+    {
+        ckernel::ckernel_template::run();
+
+        TTI_INCADCZW(p_setadc::PAC, 0, 0, 0, 1);         // z cnt increments by 2xface_r_dimxFACE_C_DIM
+        TTI_SETADCXY(p_setadc::PAC, 0, 0, 0, 0, 0b0010); // reset ch0_y counters
+    }
+
+    TT_SETADCZW(p_setadc::PAC, 0, 0, 0, 0, 0b0101);                             // reset z counters
+    TT_SETADC(p_setadc::PAC, p_setadc::CH_0, p_setadc::SET_W, tile_dst_offset); // reset w counter
+}
+
 template <
     std::uint32_t block_ct_dim,
     std::uint32_t full_ct_dim    = block_ct_dim,
@@ -207,33 +296,46 @@ inline void _llk_pack_untilize_(
     For input widths greater than 8 tiles, input is split into blocks of equal sizes,
     each block the size of block_ct_dim. This function is called for each block.
     */
-    // program_packer_untilized_destination<block_ct_dim, full_ct_dim, diagonal>(address, pack_dst_format);
-    program_packer_destination(address);
-    const std::uint32_t num_faces_per_rdim_tile = (num_faces > 2) ? 2 : 1;
+    _llk_pack_untilize_stream_block_(address, block_ct_dim, face_r_dim, num_faces, tile_dst_ct_offset + tile_dst_rt_offset, narrow_row);
+}
 
-    TT_SETADCZW(p_setadc::PAC, 0, 0, 0, 0, 0b0011); // reset ch0 zw counters
-    TT_SETADCXY(p_setadc::PAC, 0, 0, 0, 0, 0b0011); // reset ch0 xy counters
+/*
+Untilizes a full_ct_dim wide row of tiles into row-major L1 at address.
+Each block waits for its own Dest section, so with DstSync::SyncHalf math fills the other Dest half
+while the current one is packed. Column offsets of the blocks are computed here instead of on the host.
+*/
+template <DstSync Dst, bool is_fp32_dest_acc_en>
+inline void _llk_pack_untilize_stream_(
+    const std::uint32_t address,
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t full_ct_dim,
+    const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces  = 4)
+{
+    const std::uint32_t tile_row_datums = ((num_faces > 1) ? num_faces / 2 : 1) * FACE_C_DIM;
+    std::uint32_t block_address         = address;
 
-    const std::uint32_t tile_dst_offset = tile_dst_ct_offset + tile_dst_rt_offset;
-    // Needs to be revisited for perf impact with https://github.com/tenstorrent/tt-llk/issues/632
-    // If starting_tile_dst_offset is non-zero, reconfigure the template with the correct offset
-    if (tile_dst_offset != tile_dst_offset_state)
+    for (std::uint32_t block_start = 0; block_start < full_ct_dim; block_start += block_ct_dim)
     {
-        _llk_pack_untilize_mop_config_<block_ct_dim, full_ct_dim, diagonal>(face_r_dim, num_faces, narrow_row, row_num_datums, tile_dst_offset);
-        tile_dst_offset_state = tile_dst_offset;
-    }
+        const std::uint32_t tiles_in_block = std::min(block_ct_dim, full_ct_dim - block_start);
+        if (tiles_in_block != block_ct_dim)
+        {
+            _llk_pack_untilize_stream_mop_config_(tiles_in_block, face_r_dim, num_faces, false, tile_dst_offset_state);
+        }
 
-    // Iterate over top, then over bottom faces in the block (if num_faces > 2)
-    for (std::uint32_t face = 0; face < num_faces_per_rdim_tile; face++)
-    {
-        ckernel::ckernel_template::run();
+        _llk_packer_wait_for_math_done_();
+        _llk_pack_untilize_stream_block_(block_address, tiles_in_block, face_r_dim, num_faces, tile_dst_offset_state);
+        _llk_pack_dest_section_done_<Dst, is_fp32_dest_acc_en>();
 
-        TTI_INCADCZW(p_setadc::PAC, 0, 0, 0, 1);         // z cnt increments by 2xface_r_dimxFACE_C_DIM
-        TTI_SETADCXY(p_setadc::PAC, 0, 0, 0, 0, 0b0010); // reset ch0_y counters
+        block_address += SCALE_DATUM_SIZE(pack_dst_format, tiles_in_block * tile_row_datums) / 16;
     }
 
-    TT_SETADCZW(p_setadc::PAC, 0, 0, 0, 0, 0b0101);                             // reset z counters
-    TT_SETADC(p_setadc::PAC, p_setadc::CH_0, p_setadc::SET_W, tile_dst_offset); // reset w counter
+    if (full_ct_dim % block_ct_dim != 0)
+    {
+        // Restore the MOP for the next row
+        _llk_pack_untilize_stream_mop_config_(block_ct_dim, face_r_dim, num_faces, false, tile_dst_offset_state);
+    }
 }
 
 inline void _llk_pack_untilize_uninit_(const std::uint32_t pack_src_format)
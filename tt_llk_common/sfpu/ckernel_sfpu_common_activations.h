@@ -0,0 +1,242 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "ckernel_sfpu_isa.h"
+
+// Arch-neutral SFPU activations built only from MAD, MOV, ABS, LOADI and condition codes.
+// The per-arch ckernel_sfpu_isa.h supplies the encodings, so each kernel is written and tuned once.
+// Each _calculate_*_ processes `iterations` SFPU row groups starting at the current dest address,
+// scalar parameters are fp32 bit patterns. Constants live in LREG4-7, LREG0-3 are scratch.
+namespace ckernel::sfpu::common
+{
+
+// Calculates ABS for number of rows of output SFPU ops
+inline void _calculate_abs_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    isa::abs<p_sfpu::LREG0, p_sfpu::LREG1>();
+    isa::store<p_sfpu::LREG1>();
+}
+
+// Implements abs which returns |x|
+inline void _calculate_abs_(const int iterations)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_abs_sfp_rows_();
+        isa::next_rows();
+    }
+}
+
+// Calculates NEGATIVE for number of rows of output SFPU ops
+inline void _calculate_negative_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    isa::mad<p_sfpu::LREG0, p_sfpu::LCONST_neg1, p_sfpu::LCONST_0, p_sfpu::LREG1>(); // x * -1 + 0
+    isa::mad_fence();
+    isa::store<p_sfpu::LREG1>();
+}
+
+// Implements negative which returns -x
+inline void _calculate_negative_(const int iterations)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_negative_sfp_rows_();
+        isa::next_rows();
+    }
+}
+
+// Calculates SQUARE for number of rows of output SFPU ops
+inline void _calculate_square_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    isa::mad<p_sfpu::LREG0, p_sfpu::LREG0, p_sfpu::LCONST_0, p_sfpu::LREG1>(); // x * x + 0
+    isa::mad_fence();
+    isa::store<p_sfpu::LREG1>();
+}
+
+// Implements square which returns x * x
+inline void _calculate_square_(const int iterations)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_square_sfp_rows_();
+        isa::next_rows();
+    }
+}
+
+// Clamps LREG0 to [LREG4, LREG5], LREG6 = -min and LREG7 = -max
+inline void _clamp_lreg0_()
+{
+    isa::mad<p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG6, p_sfpu::LREG1>(); // x - min
+    isa::mad_fence();
+    isa::cc_if_negative<p_sfpu::LREG1>();
+    isa::mov<p_sfpu::LREG4, p_sfpu::LREG0>();
+    isa::cc_end();
+
+    isa::mad<p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG7, p_sfpu::LREG1>(); // x - max
+    isa::mad_fence();
+    isa::cc_if_not_negative<p_sfpu::LREG1>();
+    isa::mov<p_sfpu::LREG5, p_sfpu::LREG0>();
+    isa::cc_end();
+}
+
+inline void _load_clamp_bounds_(const uint32_t min, const uint32_t max)
+{
+    constexpr uint32_t SIGN = 0x80000000;
+    isa::load_imm<p_sfpu::LREG4>(min);
+    isa::load_imm<p_sfpu::LREG5>(max);
+    isa::load_imm<p_sfpu::LREG6>(min ^ SIGN);
+    isa::load_imm<p_sfpu::LREG7>(max ^ SIGN);
+}
+
+// Calculates HARDTANH for number of rows of output SFPU ops
+inline void _calculate_hardtanh_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    _clamp_lreg0_();
+    isa::store<p_sfpu::LREG0>();
+}
+
+// Implements hardtanh which clamps x to [min, max]
+inline void _calculate_hardtanh_(const int iterations, const uint32_t min, const uint32_t max)
+{
+    _load_clamp_bounds_(min, max);
+    isa::cc_enable();
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_hardtanh_sfp_rows_();
+        isa::next_rows();
+    }
+    isa::cc_disable();
+}
+
+// Calculates HARDSIGMOID for number of rows of output SFPU ops, LREG2 = 1/6 and LREG3 = 0.5
+inline void _calculate_hardsigmoid_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG1>();
+    isa::mad<p_sfpu::LREG1, p_sfpu::LREG2, p_sfpu::LREG3, p_sfpu::LREG0>(); // x / 6 + 0.5
+    isa::mad_fence();
+    _clamp_lreg0_();
+    isa::store<p_sfpu::LREG0>();
+}
+
+// Implements hardsigmoid which returns clamp(x / 6 + 0.5, 0, 1)
+inline void _calculate_hardsigmoid_(const int iterations)
+{
+    isa::load_imm<p_sfpu::LREG2>(0x3E2AAAAB); // 1/6
+    isa::load_imm16b<p_sfpu::LREG3, 0x3F00>(); // 0.5
+    _load_clamp_bounds_(0x00000000, 0x3F800000);
+    isa::cc_enable();
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_hardsigmoid_sfp_rows_();
+        isa::next_rows();
+    }
+    isa::cc_disable();
+}
+
+// Calculates HARDSWISH for number of rows of output SFPU ops, LREG2 = 1/6 and LREG3 = 0.5
+inline void _calculate_hardswish_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG1>();
+    isa::mad<p_sfpu::LREG1, p_sfpu::LREG2, p_sfpu::LREG3, p_sfpu::LREG0>(); // x / 6 + 0.5
+    isa::mad_fence();
+    _clamp_lreg0_();
+    isa::load<p_sfpu::LREG1>(); // reload x, clamping used LREG1 as scratch
+    isa::mad<p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LCONST_0, p_sfpu::LREG0>();
+    isa::mad_fence();
+    isa::store<p_sfpu::LREG0>();
+}
+
+// Implements hardswish which returns x * hardsigmoid(x)
+inline void _calculate_hardswish_(const int iterations)
+{
+    isa::load_imm<p_sfpu::LREG2>(0x3E2AAAAB); // 1/6
+    isa::load_imm16b<p_sfpu::LREG3, 0x3F00>(); // 0.5
+    _load_clamp_bounds_(0x00000000, 0x3F800000);
+    isa::cc_enable();
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_hardswish_sfp_rows_();
+        isa::next_rows();
+    }
+    isa::cc_disable();
+}
+
+// Calculates THRESHOLD for number of rows of output SFPU ops, LREG4 = value and LREG6 = threshold
+inline void _calculate_threshold_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    isa::mad<p_sfpu::LREG0, p_sfpu::LCONST_neg1, p_sfpu::LREG6, p_sfpu::LREG1>(); // threshold - x
+    isa::mad_fence();
+    isa::cc_if_not_negative<p_sfpu::LREG1>(); // x <= threshold
+    isa::mov<p_sfpu::LREG4, p_sfpu::LREG0>();
+    isa::cc_end();
+    isa::store<p_sfpu::LREG0>();
+}
+
+// Implements threshold which returns x when x > threshold, otherwise value
+inline void _calculate_threshold_(const int iterations, const uint32_t threshold, const uint32_t value)
+{
+    isa::load_imm<p_sfpu::LREG4>(value);
+    isa::load_imm<p_sfpu::LREG6>(threshold);
+    isa::cc_enable();
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_threshold_sfp_rows_();
+        isa::next_rows();
+    }
+    isa::cc_disable();
+}
+
+// Calculates SIGN for number of rows of output SFPU ops
+inline void _calculate_sign_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    isa::mov<p_sfpu::LCONST_1, p_sfpu::LREG1>();
+    isa::cc_if_negative<p_sfpu::LREG0>();
+    isa::mov<p_sfpu::LCONST_neg1, p_sfpu::LREG1>();
+    isa::cc_end();
+    isa::cc_if_zero<p_sfpu::LREG0>();
+    isa::mov<p_sfpu::LCONST_0, p_sfpu::LREG1>();
+    isa::cc_end();
+    isa::store<p_sfpu::LREG1>();
+}
+
+// Implements sign which returns 1 for x > 0, -1 for x < 0 and 0 for x == 0
+inline void _calculate_sign_(const int iterations)
+{
+    isa::cc_enable();
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_sign_sfp_rows_();
+        isa::next_rows();
+    }
+    isa::cc_disable();
+}
+
+// Implements fill which writes value to every datum
+inline void _calculate_fill_(const int iterations, const uint32_t value)
+{
+    isa::load_imm<p_sfpu::LREG4>(value);
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        isa::store<p_sfpu::LREG4>();
+        isa::next_rows();
+    }
+}
+
+} // namespace ckernel::sfpu::common
@@ -0,0 +1,222 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "ckernel_sfpu_isa.h"
+
+// Arch-neutral SFPU activations composed from the single instruction exp, recip, tanh and sqrt of
+// isa::HAS_NONLINEAR architectures. Accuracy is that of the hardware approximations.
+// Architectures without them keep their sfpi implementations and do not include this header.
+namespace ckernel::sfpu::common
+{
+
+static_assert(isa::HAS_NONLINEAR, "ckernel_sfpu_common_nonlinear.h needs single instruction transcendentals");
+
+// Leaves sigmoid(LREG0) in LREG3, uses LREG1 and LREG2
+inline void _sigmoid_lreg0_()
+{
+    isa::mad<p_sfpu::LREG0, p_sfpu::LCONST_neg1, p_sfpu::LCONST_0, p_sfpu::LREG1>(); // -x
+    isa::mad_fence();
+    isa::exp<p_sfpu::LREG1, p_sfpu::LREG2>();
+    isa::mad<p_sfpu::LREG2, p_sfpu::LCONST_1, p_sfpu::LCONST_1, p_sfpu::LREG2>(); // 1 + exp(-x)
+    isa::mad_fence();
+    isa::recip<p_sfpu::LREG2, p_sfpu::LREG3>();
+}
+
+// Calculates SIGMOID for number of rows of output SFPU ops
+inline void _calculate_sigmoid_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    _sigmoid_lreg0_();
+    isa::store<p_sfpu::LREG3>();
+}
+
+// Implements sigmoid which returns 1 / (1 + exp(-x))
+inline void _calculate_sigmoid_(const int iterations)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_sigmoid_sfp_rows_();
+        isa::next_rows();
+    }
+}
+
+// Calculates SILU for number of rows of output SFPU ops
+inline void _calculate_silu_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    _sigmoid_lreg0_();
+    isa::mad<p_sfpu::LREG3, p_sfpu::LREG0, p_sfpu::LCONST_0, p_sfpu::LREG3>(); // x * sigmoid(x)
+    isa::mad_fence();
+    isa::store<p_sfpu::LREG3>();
+}
+
+// Implements silu which returns x * sigmoid(x)
+inline void _calculate_silu_(const int iterations)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_silu_sfp_rows_();
+        isa::next_rows();
+    }
+}
+
+// Calculates ELU for number of rows of output SFPU ops, LREG4 = alpha, LREG5 = -alpha and LREG6 = 1 / alpha
+template <bool SCALE_INPUT>
+inline void _calculate_elu_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    if constexpr (SCALE_INPUT)
+    {
+        isa::mad<p_sfpu::LREG0, p_sfpu::LREG6, p_sfpu::LCONST_0, p_sfpu::LREG2>(); // x / alpha
+        isa::mad_fence();
+        isa::exp<p_sfpu::LREG2, p_sfpu::LREG1>();
+    }
+    else
+    {
+        isa::exp<p_sfpu::LREG0, p_sfpu::LREG1>();
+    }
+    isa::mad<p_sfpu::LREG1, p_sfpu::LREG4, p_sfpu::LREG5, p_sfpu::LREG1>(); // alpha * exp(.) - alpha
+    isa::mad_fence();
+
+    isa::cc_if_negative<p_sfpu::LREG0>();
+    isa::mov<p_sfpu::LREG1, p_sfpu::LREG0>();
+    isa::cc_end();
+
+    isa::store<p_sfpu::LREG0>();
+}
+
+// Implements elu which returns x when x >= 0, otherwise alpha * (exp(x) - 1)
+inline void _calculate_elu_(const int iterations, const uint32_t alpha)
+{
+    isa::load_imm<p_sfpu::LREG4>(alpha);
+    isa::load_imm<p_sfpu::LREG5>(alpha ^ 0x80000000);
+    isa::cc_enable();
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_elu_sfp_rows_<false>();
+        isa::next_rows();
+    }
+    isa::cc_disable();
+}
+
+// Implements celu which returns x when x >= 0, otherwise alpha * (exp(x / alpha) - 1)
+inline void _calculate_celu_(const int iterations, const uint32_t alpha, const uint32_t alpha_recip)
+{
+    isa::load_imm<p_sfpu::LREG4>(alpha);
+    isa::load_imm<p_sfpu::LREG5>(alpha ^ 0x80000000);
+    isa::load_imm<p_sfpu::LREG6>(alpha_recip);
+    isa::cc_enable();
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_elu_sfp_rows_<true>();
+        isa::next_rows();
+    }
+    isa::cc_disable();
+}
+
+// Calculates GELU for number of rows of output SFPU ops, LREG4 = 0.044715, LREG5 = sqrt(2 / pi) and LREG6 = 0.5
+inline void _calculate_gelu_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    isa::mad<p_sfpu::LREG0, p_sfpu::LREG0, p_sfpu::LCONST_0, p_sfpu::LREG1>(); // x^2
+    isa::mad_fence();
+    isa::mad<p_sfpu::LREG1, p_sfpu::LREG4, p_sfpu::LCONST_1, p_sfpu::LREG1>(); // 1 + 0.044715 * x^2
+    isa::mad_fence();
+    isa::mad<p_sfpu::LREG1, p_sfpu::LREG0, p_sfpu::LCONST_0, p_sfpu::LREG1>(); // x + 0.044715 * x^3
+    isa::mad_fence();
+    isa::mad<p_sfpu::LREG1, p_sfpu::LREG5, p_sfpu::LCONST_0, p_sfpu::LREG1>();
+    isa::mad_fence();
+    isa::tanh<p_sfpu::LREG1, p_sfpu::LREG2>();
+    isa::mad<p_sfpu::LREG2, p_sfpu::LREG6, p_sfpu::LREG6, p_sfpu::LREG2>(); // 0.5 * (1 + tanh(.))
+    isa::mad_fence();
+    isa::mad<p_sfpu::LREG2, p_sfpu::LREG0, p_sfpu::LCONST_0, p_sfpu::LREG2>();
+    isa::mad_fence();
+    isa::store<p_sfpu::LREG2>();
+}
+
+// Implements gelu with the tanh approximation 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+inline void _calculate_gelu_(const int iterations)
+{
+    isa::load_imm<p_sfpu::LREG4>(0x3D372713); // 0.044715
+    isa::load_imm<p_sfpu::LREG5>(0x3F4C422A); // 0.7978846
+    isa::load_imm16b<p_sfpu::LREG6, 0x3F00>(); // 0.5
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_gelu_sfp_rows_();
+        isa::next_rows();
+    }
+}
+
+// Calculates SOFTSIGN for number of rows of output SFPU ops
+inline void _calculate_softsign_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    isa::abs<p_sfpu::LREG0, p_sfpu::LREG1>();
+    isa::mad<p_sfpu::LREG1, p_sfpu::LCONST_1, p_sfpu::LCONST_1, p_sfpu::LREG1>(); // 1 + |x|
+    isa::mad_fence();
+    isa::recip<p_sfpu::LREG1, p_sfpu::LREG2>();
+    isa::mad<p_sfpu::LREG2, p_sfpu::LREG0, p_sfpu::LCONST_0, p_sfpu::LREG2>();
+    isa::mad_fence();
+    isa::store<p_sfpu::LREG2>();
+}
+
+// Implements softsign which returns x / (1 + |x|)
+inline void _calculate_softsign_(const int iterations)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_softsign_sfp_rows_();
+        isa::next_rows();
+    }
+}
+
+// Calculates TANHSHRINK for number of rows of output SFPU ops
+inline void _calculate_tanhshrink_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    isa::tanh<p_sfpu::LREG0, p_sfpu::LREG1>();
+    isa::mad<p_sfpu::LREG1, p_sfpu::LCONST_neg1, p_sfpu::LREG0, p_sfpu::LREG1>(); // x - tanh(x)
+    isa::mad_fence();
+    isa::store<p_sfpu::LREG1>();
+}
+
+// Implements tanhshrink which returns x - tanh(x)
+inline void _calculate_tanhshrink_(const int iterations)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_tanhshrink_sfp_rows_();
+        isa::next_rows();
+    }
+}
+
+// Calculates RSQRT for number of rows of output SFPU ops
+inline void _calculate_rsqrt_sfp_rows_()
+{
+    isa::load<p_sfpu::LREG0>();
+    isa::sqrt<p_sfpu::LREG0, p_sfpu::LREG1>();
+    isa::recip<p_sfpu::LREG1, p_sfpu::LREG2>();
+    isa::store<p_sfpu::LREG2>();
+}
+
+// Implements rsqrt which returns 1 / sqrt(x)
+inline void _calculate_rsqrt_(const int iterations)
+{
+#pragma GCC unroll 8
+    for (int d = 0; d < iterations; d++)
+    {
+        _calculate_rsqrt_sfp_rows_();
+        isa::next_rows();
+    }
+}
+
+} // namespace ckernel::sfpu::common
@@ -6,6 +6,8 @@
 
 #include <limits>
 
+#include "../../../tt_llk_common/sfpu/ckernel_sfpu_common_activations.h"
+#include "../../../tt_llk_common/sfpu/ckernel_sfpu_common_nonlinear.h"
 #include "ckernel.h"
 #include "ckernel_defs.h"
 #include "sfpi.h"
@@ -17,3 +19,25 @@
 #include "sfpu/ckernel_sfpu_tanh.h"
 #include "sfpu/ckernel_sfpu_typecast_fp16b_uint16.h"
 #include "sfpu/ckernel_sfpu_typecast_int32_fp32.h"
+
+// Activations without a Quasar specific kernel come from the arch-neutral layer in tt_llk_common/sfpu
+namespace ckernel::sfpu
+{
+using common::_calculate_abs_;
+using common::_calculate_negative_;
+using common::_calculate_square_;
+using common::_calculate_hardtanh_;
+using common::_calculate_hardsigmoid_;
+using common::_calculate_hardswish_;
+using common::_calculate_threshold_;
+using common::_calculate_sign_;
+using common::_calculate_fill_;
+using common::_calculate_sigmoid_;
+using common::_calculate_silu_;
+using common::_calculate_elu_;
+using common::_calculate_celu_;
+using common::_calculate_gelu_;
+using common::_calculate_softsign_;
+using common::_calculate_tanhshrink_;
+using common::_calculate_rsqrt_;
+} // namespace ckernel::sfpu
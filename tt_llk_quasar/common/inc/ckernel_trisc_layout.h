@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "ckernel_trisc_common.h"
+
+// Data movement on the TRISC itself, for layouts the unpacker and packer cannot produce or for
+// buffers too small to be worth a descriptor. Element types are raw containers: uint16_t for
+// Float16/Float16_b, uint32_t for Float32/Int32, int8_t/int16_t/int32_t for integer conversions.
+// The kernels are plain scalar loops and do not use the vector unit of ckernel_vector.h: Quasar
+// kernels build with -mcpu=tt-bh, which has no RISC-V vector extension.
+// Buffers passed as dst and src must not overlap.
+namespace ckernel
+{
+
+constexpr uint32_t TRISC_FACE_ELEMENTS = trisc::FACE_R_DIM * trisc::FACE_C_DIM;
+
+// Copies count contiguous elements
+template <typename T>
+inline void _trisc_copy_(T *dst, const T *src, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        dst[i] = src[i];
+    }
+}
+
+// Writes value to count contiguous elements
+template <typename T>
+inline void _trisc_fill_(T *dst, const T value, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        dst[i] = value;
+    }
+}
+
+// Copies a rows x cols block between buffers with the given row pitches in elements
+template <typename T>
+inline void _trisc_copy_block_(T *dst, const uint32_t dst_pitch, const T *src, const uint32_t src_pitch, const uint32_t rows, const uint32_t cols)
+{
+    for (uint32_t r = 0; r < rows; r++)
+    {
+        _trisc_copy_(dst + r * dst_pitch, src + r * src_pitch, cols);
+    }
+}
+
+// Row-major rt_dim x ct_dim block of tiles to consecutive tiles, each made of four row-major faces
+template <typename T>
+inline void _trisc_tilize_(T *dst, const T *src, const uint32_t rt_dim, const uint32_t ct_dim)
+{
+    const uint32_t row_pitch = ct_dim * trisc::TILE_C_DIM;
+    for (uint32_t tr = 0; tr < rt_dim; tr++)
+    {
+        for (uint32_t tc = 0; tc < ct_dim; tc++)
+        {
+            const T *tile = src + tr * trisc::TILE_R_DIM * row_pitch + tc * trisc::TILE_C_DIM;
+            for (uint32_t face = 0; face < trisc::NUM_FACES; face++)
+            {
+                const T *face_src = tile + (face >> 1) * trisc::FACE_R_DIM * row_pitch + (face & 1) * trisc::FACE_C_DIM;
+                _trisc_copy_block_(dst, trisc::FACE_C_DIM, face_src, row_pitch, trisc::FACE_R_DIM, trisc::FACE_C_DIM);
+                dst += TRISC_FACE_ELEMENTS;
+            }
+        }
+    }
+}
+
+// Inverse of _trisc_tilize_
+template <typename T>
+inline void _trisc_untilize_(T *dst, const T *src, const uint32_t rt_dim, const uint32_t ct_dim)
+{
+    const uint32_t row_pitch = ct_dim * trisc::TILE_C_DIM;
+    for (uint32_t tr = 0; tr < rt_dim; tr++)
+    {
+        for (uint32_t tc = 0; tc < ct_dim; tc++)
+        {
+            T *tile = dst + tr * trisc::TILE_R_DIM * row_pitch + tc * trisc::TILE_C_DIM;
+            for (uint32_t face = 0; face < trisc::NUM_FACES; face++)
+            {
+                T *face_dst = tile + (face >> 1) * trisc::FACE_R_DIM * row_pitch + (face & 1) * trisc::FACE_C_DIM;
+                _trisc_copy_block_(face_dst, row_pitch, src, trisc::FACE_C_DIM, trisc::FACE_R_DIM, trisc::FACE_C_DIM);
+                src += TRISC_FACE_ELEMENTS;
+            }
+        }
+    }
+}
+
+// Transposes num_faces consecutive 16x16 faces
+template <typename T>
+inline void _trisc_transpose_faces_(T *dst, const T *src, const uint32_t num_faces)
+{
+    for (uint32_t face = 0; face < num_faces; face++)
+    {
+        for (uint32_t r = 0; r < trisc::FACE_R_DIM; r++)
+        {
+            for (uint32_t c = 0; c < trisc::FACE_C_DIM; c++)
+            {
+                dst[c * trisc::FACE_C_DIM + r] = src[r * trisc::FACE_C_DIM + c];
+            }
+        }
+        src += TRISC_FACE_ELEMENTS;
+        dst += TRISC_FACE_ELEMENTS;
+    }
+}
+
+// dst[i] = src[indices[i]]
+template <typename T>
+inline void _trisc_gather_(T *dst, const T *src, const uint32_t *indices, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        dst[i] = src[indices[i]];
+    }
+}
+
+// dst[indices[i]] = src[i], the last of repeated indices wins
+template <typename T>
+inline void _trisc_scatter_(T *dst, const T *src, const uint32_t *indices, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        dst[indices[i]] = src[i];
+    }
+}
+
+// Converts between int8/int16/int32, widening sign extends and narrowing saturates to the destination range
+template <typename DstT, typename SrcT>
+inline void _trisc_convert_(DstT *dst, const SrcT *src, uint32_t count)
+{
+    static_assert(std::is_signed_v<DstT> && std::is_signed_v<SrcT> && std::is_integral_v<DstT> && std::is_integral_v<SrcT>, "Only int8, int16 and int32 are supported");
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        int32_t value = src[i];
+        if constexpr (sizeof(DstT) < sizeof(SrcT))
+        {
+            value = value < std::numeric_limits<DstT>::min() ? std::numeric_limits<DstT>::min() : value;
+            value = value > std::numeric_limits<DstT>::max() ? std::numeric_limits<DstT>::max() : value;
+        }
+        dst[i] = static_cast<DstT>(value);
+    }
+}
+
+} // namespace ckernel
@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "ckernel_trisc_common.h"
+#include "cmath_common.h"
+
+// Quasar encoding of the SFPU instructions used by the arch-neutral kernels in tt_llk_common/sfpu.
+// Every architecture provides this header with the same interface, only the encodings differ.
+namespace ckernel::sfpu::isa
+{
+
+// SFPNONLINEAR evaluates exp, recip, tanh and sqrt in a single instruction
+constexpr bool HAS_NONLINEAR = true;
+
+constexpr uint MEM_DEFAULT = p_sfpu::sfpmem::DEFAULT;
+
+// Load/store the SFP_ROWS rows at the current dest address, ADDR_MOD_7 is set to all zeroes
+template <uint LREG, uint MEM_MODE = MEM_DEFAULT>
+inline void load()
+{
+    TTI_SFPLOAD(LREG, MEM_MODE, ADDR_MOD_7, 0, 0);
+}
+
+template <uint LREG, uint MEM_MODE = MEM_DEFAULT>
+inline void store()
+{
+    TTI_SFPSTORE(LREG, MEM_MODE, ADDR_MOD_7, 0, 0);
+}
+
+// Advance dest by the rows processed per SFPU instruction
+inline void next_rows()
+{
+    ckernel::math::_incr_counters_<0x0, 0x0, ckernel::math::SFP_ROWS, 0x0>();
+}
+
+// DST = A * B + C
+template <uint A, uint B, uint C, uint DST>
+inline void mad()
+{
+    TTI_SFPMAD(A, B, C, DST, 0);
+}
+
+// MAD results are interlocked in hardware
+inline void mad_fence()
+{
+}
+
+template <uint SRC, uint DST>
+inline void mov()
+{
+    TTI_SFPMOV(SRC, DST, 0);
+}
+
+template <uint SRC, uint DST>
+inline void abs()
+{
+    TTI_SFPABS(SRC, DST, 1 /*float*/);
+}
+
+// Float16_b immediate known at compile time
+template <uint LREG, uint16_t BF16>
+inline void load_imm16b()
+{
+    TTI_SFPLOADI(LREG, 0 /*Float16_b*/, BF16);
+}
+
+// Full fp32 immediate, written lower half first
+template <uint LREG>
+inline void load_imm(const uint32_t fp32_bits)
+{
+    TT_SFPLOADI(LREG, 10 /*lower 16 bits*/, fp32_bits & 0xFFFF);
+    TT_SFPLOADI(LREG, 8 /*upper 16 bits*/, fp32_bits >> 16);
+}
+
+inline void cc_enable()
+{
+    TTI_SFPENCC(1, 2);
+}
+
+inline void cc_disable()
+{
+    TTI_SFPENCC(0, 2);
+}
+
+// Re-enable all lanes after a conditional block
+inline void cc_end()
+{
+    TTI_SFPENCC(0, 0);
+}
+
+inline void cc_else()
+{
+    TTI_SFPCOMPC;
+}
+
+template <uint LREG>
+inline void cc_if_negative()
+{
+    TTI_SFPSETCC(0, LREG, 0);
+}
+
+template <uint LREG>
+inline void cc_if_not_negative()
+{
+    TTI_SFPSETCC(0, LREG, 4);
+}
+
+template <uint LREG>
+inline void cc_if_zero()
+{
+    TTI_SFPSETCC(0, LREG, 6);
+}
+
+template <uint SRC, uint DST>
+inline void exp()
+{
+    TTI_SFPNONLINEAR(SRC, DST, p_sfpnonlinear::EXP_MODE);
+}
+
+template <uint SRC, uint DST>
+inline void recip()
+{
+    TTI_SFPNONLINEAR(SRC, DST, p_sfpnonlinear::RECIP_MODE);
+}
+
+template <uint SRC, uint DST>
+inline void tanh()
+{
+    TTI_SFPNONLINEAR(SRC, DST, p_sfpnonlinear::TANH_MODE);
+}
+
+template <uint SRC, uint DST>
+inline void sqrt()
+{
+    TTI_SFPNONLINEAR(SRC, DST, p_sfpnonlinear::SQRT_MODE);
+}
+
+} // namespace ckernel::sfpu::isa
@@ -55,6 +55,8 @@ struct p_gpr_unpack
     constexpr static uint SR_UNPACK_UNTILIZER_STATE_1 = 57;
     constexpr static uint SR_UNPACK_UNTILIZER_STATE_2 = 58;
     constexpr static uint SR_UNPACK_UNTILIZER_STATE_3 = 59;
+    constexpr static uint SR_UNPACK_TILIZER_STATE_2   = 60; // Save CH1 Y stride of both unpackers before fast tilize
+    constexpr static uint SR_UNPACK_TILIZER_STATE_3   = 61;
 };
 
 // Math GPR thread
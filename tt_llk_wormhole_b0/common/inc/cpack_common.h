@@ -647,6 +647,34 @@ inline void program_packer_destination(uint32_t addr, bool restore = true)
     }
 }
 
+// Runtime-width variant used by streaming untilize, full_ct_dim is the row width of the whole output in tiles
+inline void program_packer_untilized_destination(
+    const uint32_t addr, const uint32_t pack_dst_format, const uint32_t full_ct_dim, const uint32_t row_num_datums = TILE_C_DIM)
+{
+    // Each packer packs 8 rows of full_ct_dim*TILE_C_DIM datums
+    const uint32_t block_size  = SCALE_DATUM_SIZE(pack_dst_format, full_ct_dim * TILE_C_DIM * (TILE_R_DIM / 4));
+    constexpr uint32_t offset0 = 0;
+    const uint32_t offset1     = (1 * row_num_datums * block_size) / 16 / TILE_C_DIM;
+    const uint32_t offset2     = (2 * row_num_datums * block_size) / 16 / TILE_C_DIM;
+    const uint32_t offset3     = (3 * row_num_datums * block_size) / 16 / TILE_C_DIM;
+
+    TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset0), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 0));
+    TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset0), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 0));
+    TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset1), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 1));
+    TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset1), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 1));
+    TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset2), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 2));
+    TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset2), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 2));
+    TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset3), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 3));
+    TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset3), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 3));
+
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR);
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 1);
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 2);
+    TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 3);
+
+    TTI_PACR(ADDR_MOD_2, 0, 0xf, 0, 0, 1, 0); // pack flush
+}
+
 template <uint32_t block_ct_dim, uint32_t full_ct_dim, bool diagonal = false, uint32_t row_num_datums = TILE_C_DIM>
 inline void program_packer_untilized_destination(const uint32_t addr, const uint32_t pack_dst_format)
 {
@@ -676,28 +704,7 @@ inline void program_packer_untilized_destination(const uint32_t addr, const uint
     }
     else
     {
-        // Each packer packs 8 rows of full_ct_dim*TILE_C_DIM datums
-        const uint32_t block_size  = SCALE_DATUM_SIZE(pack_dst_format, full_ct_dim * TILE_C_DIM * (TILE_R_DIM / 4));
-        constexpr uint32_t offset0 = 0;
-        const uint32_t offset1     = (1 * row_num_datums * block_size) / 16 / TILE_C_DIM;
-        const uint32_t offset2     = (2 * row_num_datums * block_size) / 16 / TILE_C_DIM;
-        const uint32_t offset3     = (3 * row_num_datums * block_size) / 16 / TILE_C_DIM;
-
-        TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset0), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 0));
-        TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset0), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 0));
-        TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset1), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 1));
-        TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset1), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 1));
-        TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset2), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 2));
-        TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset2), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 2));
-        TT_SETDMAREG(0, LOWER_HALFWORD(addr + offset3), 0, LO_16(p_gpr_pack::OUTPUT_ADDR + 3));
-        TT_SETDMAREG(0, UPPER_HALFWORD(addr + offset3), 0, HI_16(p_gpr_pack::OUTPUT_ADDR + 3));
-
-        TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR);
-        TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 1);
-        TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 2);
-        TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 3);
-
-        TTI_PACR(ADDR_MOD_2, 0, 0xf, 0, 0, 1, 0); // pack flush
+        program_packer_untilized_destination(addr, pack_dst_format, full_ct_dim, row_num_datums);
     }
 }
 
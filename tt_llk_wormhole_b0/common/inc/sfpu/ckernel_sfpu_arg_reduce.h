@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_addrmod.h"
+#include "ckernel_instr_params.h"
+#include "sfpi.h"
+
+/*
+ * argmax/argmin down the columns of a sequence of Dest tiles, with the max/min value and the index of its row.
+ * Indices are generated from the position of each row, nothing has to be unpacked for them.
+ *
+ * The SFPU reduces between LREGs and, with SFPTRANSP, between the 4 rows of an LREG, but not between the 8
+ * columns of an LREG. The other dimensions are reductions down the columns of a transposed tile:
+ * - along rows: the tiles are transposed in Dest first, e.g. with _llk_math_transpose_dest_;
+ * - over the whole tile: the row 0 results of a column reduction are transposed into column 0, and reduced down
+ *   it again with FLAT_INDEX, which turns the row index of each column into the row-major index row * 32 + column.
+ *
+ * Each column group is reduced in two steps. The eight 4-row groups of every tile are compared elementwise, which
+ * leaves the best of rows r, r + 4, r + 8, ... in row r of an LREG. Those 4 rows are then transposed into 4 LREGs
+ * and compared. Candidates compare by value, and equal values by index, so the tie-break holds in both steps.
+ */
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+enum class ArgReduceOp : std::uint8_t
+{
+    Max,
+    Min,
+};
+
+enum class ArgTieBreak : std::uint8_t
+{
+    First, // the lowest index among equal values, as torch.argmax
+    Last,
+};
+
+enum class ArgIndexFormat : std::uint8_t
+{
+    Int32,
+    UInt16,
+};
+
+// SFPLOAD/SFPSTORE address distance between Dest tiles, the column groups: even and odd columns of face 0, then face 1,
+// and the 4-row groups of a column group: rows 0-15 at 0-12 in faces 0/1, rows 16-31 at 32-44 in faces 2/3
+constexpr uint ARG_REDUCE_DEST_TILE_SIZE    = 64;
+constexpr uint ARG_REDUCE_COLUMN_OFFSETS[4] = {0, 2, 16, 18};
+constexpr uint ARG_REDUCE_ROW_OFFSETS[8]    = {0, 4, 8, 12, 32, 36, 40, 44};
+
+// Rows 0-3 of the output tiles hold the results, rows 4-7 the best of each row of a 4-row group
+constexpr uint ARG_REDUCE_RESULT_ADDR    = 0;
+constexpr uint ARG_REDUCE_CANDIDATE_ADDR = 4;
+
+/**
+ * @brief Transposes the 4-row groups at addr of the values and indices tiles, row r of column group c to row c of
+ * column group r. The indices are loaded with index_load_mode and stored with index_store_mode.
+ */
+inline void _arg_reduce_transpose_group_(
+    const uint values_offset, const uint indices_offset, const uint addr, const uint index_load_mode, const uint index_store_mode)
+{
+    for (uint c = 0; c < 4; c++)
+    {
+        TT_SFPLOAD(p_sfpu::LREG0 + c, InstrModLoadStore::DEFAULT, ADDR_MOD_3, values_offset + addr + ARG_REDUCE_COLUMN_OFFSETS[c]);
+        TT_SFPLOAD(p_sfpu::LREG4 + c, index_load_mode, ADDR_MOD_3, indices_offset + addr + ARG_REDUCE_COLUMN_OFFSETS[c]);
+    }
+    TTI_SFPTRANSP(0, 0, 0, 0);
+    for (uint c = 0; c < 4; c++)
+    {
+        TT_SFPSTORE(p_sfpu::LREG0 + c, InstrModLoadStore::DEFAULT, ADDR_MOD_3, values_offset + addr + ARG_REDUCE_COLUMN_OFFSETS[c]);
+        TT_SFPSTORE(p_sfpu::LREG4 + c, index_store_mode, ADDR_MOD_3, indices_offset + addr + ARG_REDUCE_COLUMN_OFFSETS[c]);
+    }
+}
+
+/**
+ * @brief The value compared by the reduction: argmin is the argmax of the negated values
+ */
+template <ArgReduceOp OP>
+sfpi_inline sfpi::vFloat _arg_reduce_key_(const sfpi::vFloat value)
+{
+    if constexpr (OP == ArgReduceOp::Min)
+    {
+        return -value;
+    }
+    else
+    {
+        return value;
+    }
+}
+
+/**
+ * @brief Replaces the best key and its index by the candidate where the candidate wins
+ */
+template <ArgTieBreak TIE>
+sfpi_inline void _arg_reduce_update_(sfpi::vFloat &best, sfpi::vInt &best_index, const sfpi::vFloat key, const sfpi::vInt index)
+{
+    if constexpr (TIE == ArgTieBreak::First)
+    {
+        v_if (key > best || (key == best && index < best_index))
+        {
+            best       = key;
+            best_index = index;
+        }
+        v_endif;
+    }
+    else
+    {
+        v_if (key > best || (key == best && index > best_index))
+        {
+            best       = key;
+            best_index = index;
+        }
+        v_endif;
+    }
+}
+
+/**
+ * @brief argmax/argmin down the columns of num_tiles consecutive Dest tiles, which hold rows 0 to 32 * num_tiles - 1
+ *        of the sequence. The value is stored in row 0 of values_tile and its row index in row 0 of indices_tile.
+ *
+ * A longer sequence is reduced in chunks: every call after the first sets accumulate and merges its chunk with the
+ * result in row 0 of values_tile and indices_tile, with index_offset the rows before the chunk. Rows 1-7 of both
+ * output tiles are overwritten. values_tile may be first_tile, except when accumulating.
+ *
+ * Dest has to be in 32-bit mode; UInt16 indices are narrowed to the layout the packer reads for uint16.
+ *
+ * @tparam FLAT_INDEX Reduce the output of a column reduction transposed into column 0, as the second step over a
+ * whole tile: the index of row j is indices_tile[j] * 32 + j, the row-major index of the first step's result.
+ * The first step has Int32 indices, the second one runs on a single tile and without accumulate.
+ * @param index_offset The index of row 0 of first_tile in the sequence.
+ */
+template <bool APPROXIMATION_MODE, ArgReduceOp OP, ArgTieBreak TIE, ArgIndexFormat INDEX_FORMAT, bool FLAT_INDEX = false>
+inline void _calculate_arg_reduce_col_(
+    const uint first_tile, const uint num_tiles, const uint values_tile, const uint indices_tile, const uint index_offset, const bool accumulate)
+{
+    constexpr uint index_mode = INDEX_FORMAT == ArgIndexFormat::UInt16 ? InstrModLoadStore::LO16 : InstrModLoadStore::INT32;
+    const uint first_offset   = first_tile * ARG_REDUCE_DEST_TILE_SIZE;
+    const uint values_offset  = values_tile * ARG_REDUCE_DEST_TILE_SIZE;
+    const uint indices_offset = indices_tile * ARG_REDUCE_DEST_TILE_SIZE;
+    const uint row_groups     = num_tiles * 8;
+
+    // Best of rows r, r + 4, r + 8, ... into row r of the candidates, with the index of the first row of its group
+    for (uint c = 0; c < 4; c++)
+    {
+        const uint column = ARG_REDUCE_COLUMN_OFFSETS[c];
+
+        sfpi::vFloat best     = _arg_reduce_key_<OP>(sfpi::dst_reg[(first_offset + column) / 2]);
+        sfpi::vInt best_index = 0;
+        if constexpr (FLAT_INDEX)
+        {
+            sfpi::vUInt row = sfpi::dst_reg[(indices_offset + column) / 2];
+            best_index      = sfpi::reinterpret<sfpi::vInt>(row << 5);
+        }
+
+        for (uint g = 1; g < row_groups; g++)
+        {
+            const uint addr  = first_offset + (g / 8) * ARG_REDUCE_DEST_TILE_SIZE + ARG_REDUCE_ROW_OFFSETS[g % 8] + column;
+            sfpi::vInt index = static_cast<int>(4 * g);
+            if constexpr (FLAT_INDEX)
+            {
+                sfpi::vUInt row = sfpi::dst_reg[(indices_offset + ARG_REDUCE_ROW_OFFSETS[g % 8] + column) / 2];
+                index           = sfpi::reinterpret<sfpi::vInt>(row << 5) + static_cast<int>(4 * g);
+            }
+            _arg_reduce_update_<TIE>(best, best_index, _arg_reduce_key_<OP>(sfpi::dst_reg[addr / 2]), index);
+        }
+
+        sfpi::dst_reg[(values_offset + ARG_REDUCE_CANDIDATE_ADDR + column) / 2]  = best;
+        sfpi::dst_reg[(indices_offset + ARG_REDUCE_CANDIDATE_ADDR + column) / 2] = best_index;
+    }
+
+    // Candidate row r of every column group into column group r, and the carried result into column group 0
+    _arg_reduce_transpose_group_(values_offset, indices_offset, ARG_REDUCE_CANDIDATE_ADDR, InstrModLoadStore::INT32, InstrModLoadStore::INT32);
+    if (accumulate)
+    {
+        _arg_reduce_transpose_group_(values_offset, indices_offset, ARG_REDUCE_RESULT_ADDR, index_mode, InstrModLoadStore::INT32);
+    }
+
+    {
+        sfpi::vFloat best     = sfpi::dst_reg[(values_offset + ARG_REDUCE_CANDIDATE_ADDR) / 2];
+        sfpi::vInt best_index = sfpi::dst_reg[(indices_offset + ARG_REDUCE_CANDIDATE_ADDR) / 2];
+        best_index            = best_index + static_cast<int>(index_offset);
+
+        for (uint r = 1; r < 4; r++)
+        {
+            const uint addr  = ARG_REDUCE_CANDIDATE_ADDR + ARG_REDUCE_COLUMN_OFFSETS[r];
+            sfpi::vInt index = sfpi::dst_reg[(indices_offset + addr) / 2];
+            _arg_reduce_update_<TIE>(best, best_index, sfpi::dst_reg[(values_offset + addr) / 2], index + static_cast<int>(index_offset + r));
+        }
+
+        if (accumulate)
+        {
+            sfpi::vInt index = sfpi::dst_reg[(indices_offset + ARG_REDUCE_RESULT_ADDR) / 2];
+            _arg_reduce_update_<TIE>(best, best_index, _arg_reduce_key_<OP>(sfpi::dst_reg[(values_offset + ARG_REDUCE_RESULT_ADDR) / 2]), index);
+        }
+
+        sfpi::dst_reg[(values_offset + ARG_REDUCE_RESULT_ADDR) / 2]  = _arg_reduce_key_<OP>(best);
+        sfpi::dst_reg[(indices_offset + ARG_REDUCE_RESULT_ADDR) / 2] = best_index;
+    }
+
+    // Column group c of the result back into row 0 of column group c
+    _arg_reduce_transpose_group_(values_offset, indices_offset, ARG_REDUCE_RESULT_ADDR, InstrModLoadStore::INT32, index_mode);
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -92,65 +92,77 @@ sfpi_inline sfpi::vFloat _calculate_sfpu_binary_power_(sfpi::vFloat base, sfpi::
     return result;
 }
 
-template <bool APPROXIMATION_MODE, BinaryOp BINOP, int ITERATIONS = 8>
-inline void _calculate_sfpu_binary_(const uint dst_index_in0, const uint dst_index_in1, const uint dst_index_out)
+/**
+ * @brief in0 op in1 for the ops that only depend on the two values, i.e. all but XLOGY
+ */
+template <BinaryOp BINOP>
+sfpi_inline sfpi::vFloat _calculate_sfpu_binary_op_(const sfpi::vFloat in0, const sfpi::vFloat in1)
 {
-    static constexpr float nan = std::numeric_limits<float>::quiet_NaN();
-    // SFPU microcode
-    for (int d = 0; d < ITERATIONS; d++)
-    {
-        // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
-        constexpr uint dst_tile_size_sfpi = 32;
-        sfpi::vFloat in0                  = sfpi::dst_reg[dst_index_in0 * dst_tile_size_sfpi];
-        sfpi::vFloat in1                  = sfpi::dst_reg[dst_index_in1 * dst_tile_size_sfpi];
-        sfpi::vFloat result               = 0.0f;
+    sfpi::vFloat result = 0.0f;
 
-        if constexpr (BINOP == BinaryOp::ADD)
-        {
-            result = in0 + in1;
-        }
-        else if constexpr (BINOP == BinaryOp::SUB)
-        {
-            result = in0 - in1;
-        }
-        else if constexpr (BINOP == BinaryOp::MUL)
-        {
-            result = in0 * in1;
-        }
-        else if constexpr (BINOP == BinaryOp::DIV)
+    if constexpr (BINOP == BinaryOp::ADD)
+    {
+        result = in0 + in1;
+    }
+    else if constexpr (BINOP == BinaryOp::SUB)
+    {
+        result = in0 - in1;
+    }
+    else if constexpr (BINOP == BinaryOp::MUL)
+    {
+        result = in0 * in1;
+    }
+    else if constexpr (BINOP == BinaryOp::DIV)
+    {
+        v_if (in1 == 0)
         {
-            v_if (in1 == 0)
-            {
-                v_if (in0 == 0)
-                {
-                    result = std::numeric_limits<float>::quiet_NaN();
-                }
-                v_else
-                {
-                    result = std::numeric_limits<float>::infinity();
-                    result = sfpi::setsgn(result, in0);
-                }
-                v_endif;
-            }
-            v_elseif (in0 == in1)
+            v_if (in0 == 0)
             {
-                result = sfpi::vConst1;
+                result = std::numeric_limits<float>::quiet_NaN();
             }
             v_else
             {
-                result = in0 * sfpi::setsgn(_sfpu_reciprocal_<2>(in1), in1);
+                result = std::numeric_limits<float>::infinity();
+                result = sfpi::setsgn(result, in0);
             }
             v_endif;
         }
-        else if constexpr (BINOP == BinaryOp::RSUB)
+        v_elseif (in0 == in1)
         {
-            result = in1 - in0;
+            result = sfpi::vConst1;
         }
-        else if constexpr (BINOP == BinaryOp::POW)
+        v_else
         {
-            result = _calculate_sfpu_binary_power_(in0, in1);
+            result = in0 * sfpi::setsgn(_sfpu_reciprocal_<2>(in1), in1);
         }
-        else if constexpr (BINOP == BinaryOp::XLOGY)
+        v_endif;
+    }
+    else if constexpr (BINOP == BinaryOp::RSUB)
+    {
+        result = in1 - in0;
+    }
+    else if constexpr (BINOP == BinaryOp::POW)
+    {
+        result = _calculate_sfpu_binary_power_(in0, in1);
+    }
+
+    return result;
+}
+
+template <bool APPROXIMATION_MODE, BinaryOp BINOP, int ITERATIONS = 8>
+inline void _calculate_sfpu_binary_(const uint dst_index_in0, const uint dst_index_in1, const uint dst_index_out)
+{
+    static constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    // SFPU microcode
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        // size of each tile in Dest is 64/SFP_DESTREG_STRIDE = 32 rows when using sfpi to load/store
+        constexpr uint dst_tile_size_sfpi = 32;
+        sfpi::vFloat in0                  = sfpi::dst_reg[dst_index_in0 * dst_tile_size_sfpi];
+        sfpi::vFloat in1                  = sfpi::dst_reg[dst_index_in1 * dst_tile_size_sfpi];
+        sfpi::vFloat result               = 0.0f;
+
+        if constexpr (BINOP == BinaryOp::XLOGY)
         {
             v_if ((in1 < 0.0f) || (in1 == nan))
             {
@@ -164,6 +176,10 @@ inline void _calculate_sfpu_binary_(const uint dst_index_in0, const uint dst_ind
             }
             v_endif;
         }
+        else
+        {
+            result = _calculate_sfpu_binary_op_<BINOP>(in0, in1);
+        }
 
         sfpi::dst_reg[dst_index_out * dst_tile_size_sfpi] = result;
         sfpi::dst_reg++;
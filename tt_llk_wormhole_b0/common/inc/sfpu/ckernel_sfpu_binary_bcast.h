@@ -0,0 +1,426 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <limits>
+#include <type_traits>
+
+#include "ckernel_addrmod.h"
+#include "ckernel_instr_params.h"
+#include "ckernel_sfpu_binary.h"
+#include "ckernel_sfpu_binary_bitwise.h"
+#include "ckernel_sfpu_comp.h"
+#include "ckernel_sfpu_converter.h"
+#include "ckernel_sfpu_log.h"
+#include "ckernel_sfpu_shift.h"
+#include "sfpi.h"
+
+/*
+ * Binary ops of a Dest tile with a broadcast second operand: a scalar, one row of a Dest tile repeated down the
+ * 32 rows, or one column of a Dest tile repeated across the 32 columns. The operand is held in a register for the
+ * whole tile instead of being materialised as a full broadcast tile in Dest.
+ *
+ * One LREG holds 4 rows of a column group. A row is broadcast from a 4-row group that holds it in all 4 rows,
+ * which _sfpu_binary_bcast_replicate_row_ makes in place; it is loaded once per column group and applied to the
+ * 8 row groups of the tile. A column is broadcast from a column group that holds it in all 8 lanes of a row,
+ * which _sfpu_binary_bcast_replicate_column_ makes in place with the subvector shuffles of SFPSHFT2; it is loaded
+ * once per row group and applied to the 4 column groups of the tile.
+ *
+ * The kernels run over the whole tile at absolute addresses, after _llk_math_eltwise_unary_sfpu_start_(0).
+ */
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// SFPLOAD/SFPSTORE address distance between Dest tiles, the column groups of a row, and the 4-row groups of a
+// column group: rows 0-15 at 0-12 in faces 0/1, rows 16-31 at 32-44 in faces 2/3
+constexpr uint BINARY_BCAST_DEST_TILE_SIZE    = 64;
+constexpr uint BINARY_BCAST_COLUMN_OFFSETS[4] = {0, 2, 16, 18};
+constexpr uint BINARY_BCAST_ROW_OFFSETS[8]    = {0, 4, 8, 12, 32, 36, 40, 44};
+
+// A broadcast operand is loaded once per column group, or with a column once per row group
+template <BinaryBroadcast BROADCAST>
+constexpr uint BINARY_BCAST_OPERAND_GROUPS = BROADCAST == BinaryBroadcast::Column ? 8 : 4;
+
+/**
+ * @brief SFPLOAD address of the 4-row group holding row `row` of the Dest tile at tile_idx
+ */
+constexpr uint _binary_bcast_row_addr_(const uint tile_idx, const uint row)
+{
+    return tile_idx * BINARY_BCAST_DEST_TILE_SIZE + (row & ~0x3) + (row & 0x10);
+}
+
+/**
+ * @brief SFPLOAD address of the column group holding column `column` of the Dest tile at tile_idx, in its first
+ * 4-row group. Lane l of a column group holds column 2l of the face's even or odd columns.
+ */
+constexpr uint _binary_bcast_column_addr_(const uint tile_idx, const uint column)
+{
+    return tile_idx * BINARY_BCAST_DEST_TILE_SIZE + BINARY_BCAST_COLUMN_OFFSETS[((column >> 4) << 1) | (column & 0x1)];
+}
+
+/**
+ * @brief SFPLOAD address of the replicated row or column of the in1 tile
+ */
+template <BinaryBroadcast BROADCAST>
+constexpr uint _binary_bcast_in1_addr_(const uint in1, const uint in1_index)
+{
+    if constexpr (BROADCAST == BinaryBroadcast::Row)
+    {
+        return _binary_bcast_row_addr_(in1, in1_index);
+    }
+    else if constexpr (BROADCAST == BinaryBroadcast::Column)
+    {
+        return _binary_bcast_column_addr_(in1, in1_index);
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/**
+ * @brief Address offset of element i of operand group g, a row group of column group g or with a column a column
+ * group of row group g
+ */
+template <BinaryBroadcast BROADCAST>
+constexpr uint _binary_bcast_addr_(const uint g, const uint i)
+{
+    if constexpr (BROADCAST == BinaryBroadcast::Column)
+    {
+        return BINARY_BCAST_ROW_OFFSETS[g] + BINARY_BCAST_COLUMN_OFFSETS[i];
+    }
+    else
+    {
+        return BINARY_BCAST_ROW_OFFSETS[i] + BINARY_BCAST_COLUMN_OFFSETS[g];
+    }
+}
+
+/**
+ * @brief Address offset of operand group g in the replicated row or column
+ */
+template <BinaryBroadcast BROADCAST>
+constexpr uint _binary_bcast_operand_offset_(const uint g)
+{
+    return BROADCAST == BinaryBroadcast::Column ? BINARY_BCAST_ROW_OFFSETS[g] : BINARY_BCAST_COLUMN_OFFSETS[g];
+}
+
+/**
+ * @brief Copies row `row` of the Dest tile at tile_idx over the other 3 rows of its 4-row group, which makes it
+ * the operand of the BinaryBroadcast::Row kernels. One replicated row serves any number of them.
+ *
+ * @tparam INSTRUCTION_MODE The load/store mode of the tile's data, e.g. INT32 for integer rows.
+ */
+template <InstrModLoadStore INSTRUCTION_MODE = InstrModLoadStore::DEFAULT>
+inline void _sfpu_binary_bcast_replicate_row_(const uint tile_idx, const uint row)
+{
+    constexpr auto instruction_mode = static_cast<std::underlying_type_t<InstrModLoadStore>>(INSTRUCTION_MODE);
+    const uint addr                 = _binary_bcast_row_addr_(tile_idx, row);
+
+    for (uint c = 0; c < 4; c++)
+    {
+        TT_SFPLOAD(p_sfpu::LREG0 + c, instruction_mode, ADDR_MOD_3, addr + BINARY_BCAST_COLUMN_OFFSETS[c]);
+    }
+
+    // Transposed, LREG r holds row r of the group; the row is copied into the other three and transposed back
+    TTI_SFPTRANSP(0, 0, 0, 0);
+    for (uint r = 0; r < 4; r++)
+    {
+        if (r != row % 4)
+        {
+            TT_SFPMOV(0, p_sfpu::LREG0 + row % 4, p_sfpu::LREG0 + r, 0);
+        }
+    }
+    TTI_SFPTRANSP(0, 0, 0, 0);
+
+    for (uint c = 0; c < 4; c++)
+    {
+        TT_SFPSTORE(p_sfpu::LREG0 + c, instruction_mode, ADDR_MOD_3, addr + BINARY_BCAST_COLUMN_OFFSETS[c]);
+    }
+}
+
+/**
+ * @brief Copies column `column` of the Dest tile at tile_idx over the other 7 lanes of its column group, in all
+ * 32 rows, which makes it the operand of the BinaryBroadcast::Column kernels. One replicated column serves any
+ * number of them.
+ *
+ * The other lanes are cleared and the column is rotated through them one lane at a time with subvec_shflror1,
+ * ORing each step in, so the copy is bit exact in any load mode.
+ *
+ * @tparam INSTRUCTION_MODE The load/store mode of the tile's data, e.g. INT32 for integer columns.
+ */
+template <InstrModLoadStore INSTRUCTION_MODE = InstrModLoadStore::DEFAULT>
+inline void _sfpu_binary_bcast_replicate_column_(const uint tile_idx, const uint column)
+{
+    constexpr auto instruction_mode = static_cast<std::underlying_type_t<InstrModLoadStore>>(INSTRUCTION_MODE);
+    const uint addr                 = _binary_bcast_column_addr_(tile_idx, column);
+    // vConstTileId counts the lanes of each row in steps of 2, the column's lane is column 2l of its group
+    const sfpi::vInt lane = static_cast<int>(column & 0xE);
+
+    for (uint r = 0; r < 8; r++)
+    {
+        TT_SFPLOAD(p_sfpu::LREG0, instruction_mode, ADDR_MOD_3, addr + BINARY_BCAST_ROW_OFFSETS[r]);
+        sfpi::vUInt shifted = sfpi::l_reg[sfpi::LRegs::LReg0];
+
+        v_if ((sfpi::vConstTileId & 0xF) != lane)
+        {
+            shifted = 0;
+        }
+        v_endif;
+
+        sfpi::vUInt replicated = shifted;
+        for (uint l = 1; l < 8; l++)
+        {
+            shifted = sfpi::subvec_shflror1(shifted);
+            replicated |= shifted;
+        }
+
+        sfpi::l_reg[sfpi::LRegs::LReg0] = replicated;
+        TT_SFPSTORE(p_sfpu::LREG0, instruction_mode, ADDR_MOD_3, addr + BINARY_BCAST_ROW_OFFSETS[r]);
+    }
+}
+
+/**
+ * @brief The broadcast operand of operand group g, from a scalar's bits or a replicated row or column
+ */
+template <BinaryBroadcast BROADCAST>
+sfpi_inline sfpi::vFloat _binary_bcast_operand_(const uint in1, const uint in1_addr, const uint g)
+{
+    if constexpr (BROADCAST == BinaryBroadcast::Scalar)
+    {
+        return Converter::as_float(in1);
+    }
+    else
+    {
+        return sfpi::dst_reg[(in1_addr + _binary_bcast_operand_offset_<BROADCAST>(g)) / 2];
+    }
+}
+
+/**
+ * @brief log(operand) as the XLOGY of _calculate_sfpu_binary_ takes it: _calculate_log_body_ on the operand
+ * stored in the out tile at addr, NaN for a negative or NaN operand. The Dest counter is moved onto addr for
+ * _calculate_log_body_ and cleared after.
+ */
+sfpi_inline sfpi::vFloat _binary_bcast_log_operand_(const sfpi::vFloat operand, const uint dst_index_out, const uint addr)
+{
+    static constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+    sfpi::vFloat log_operand;
+
+    v_if ((operand < 0.0f) || (operand == nan))
+    {
+        log_operand = nan;
+    }
+    v_else
+    {
+        const uint out_addr         = dst_index_out * BINARY_BCAST_DEST_TILE_SIZE + addr;
+        sfpi::dst_reg[out_addr / 2] = operand;
+        for (uint i = 0; i < addr / 2; i++)
+        {
+            sfpi::dst_reg++;
+        }
+        _calculate_log_body_<false>(0, dst_index_out);
+        TTI_SETRWC(p_setrwc::CLR_NONE, 0, 0, 0, 0, p_setrwc::SET_D);
+        log_operand = sfpi::dst_reg[out_addr / 2];
+    }
+    v_endif;
+
+    return log_operand;
+}
+
+/**
+ * @brief Elementwise in0 op in1 with a broadcast in1, for the float ops of _calculate_sfpu_binary_
+ *
+ * XLOGY takes the log of the operand once per operand group rather than once per element.
+ * Initialised with _sfpu_binary_init_<APPROXIMATION_MODE, BINOP>.
+ *
+ * @param in1 The scalar in float32 format, or with BinaryBroadcast::Row/Column the Dest tile holding the row or
+ * column.
+ * @param in1_index The row or column of in1, replicated by _sfpu_binary_bcast_replicate_row_/column_.
+ */
+template <bool APPROXIMATION_MODE, BinaryOp BINOP, BinaryBroadcast BROADCAST>
+inline void _calculate_sfpu_binary_bcast_(const uint dst_index_in0, const uint in1, const uint dst_index_out, const uint in1_index = 0)
+{
+    static_assert(BINOP <= BinaryOp::XLOGY, "The shifts are in _calculate_binary_shift_bcast_.");
+
+    const uint in0_offset = dst_index_in0 * BINARY_BCAST_DEST_TILE_SIZE;
+    const uint out_offset = dst_index_out * BINARY_BCAST_DEST_TILE_SIZE;
+    const uint in1_addr   = _binary_bcast_in1_addr_<BROADCAST>(in1, in1_index);
+
+    for (uint g = 0; g < BINARY_BCAST_OPERAND_GROUPS<BROADCAST>; g++)
+    {
+        sfpi::vFloat operand = _binary_bcast_operand_<BROADCAST>(in1, in1_addr, g);
+
+        for (uint i = 0; i < 32 / BINARY_BCAST_OPERAND_GROUPS<BROADCAST>; i++)
+        {
+            const uint addr  = _binary_bcast_addr_<BROADCAST>(g, i);
+            sfpi::vFloat in0 = sfpi::dst_reg[(in0_offset + addr) / 2];
+            sfpi::vFloat result;
+
+            if constexpr (BINOP == BinaryOp::XLOGY)
+            {
+                // in0 is read first, the log goes through the out tile, which may be the in0 tile
+                if (i == 0)
+                {
+                    operand = _binary_bcast_log_operand_(operand, dst_index_out, addr);
+                }
+                result = in0 * operand;
+            }
+            else
+            {
+                result = _calculate_sfpu_binary_op_<BINOP>(in0, operand);
+            }
+
+            sfpi::dst_reg[(out_offset + addr) / 2] = result;
+        }
+    }
+}
+
+/**
+ * @brief Elementwise in0 cmp in1 with a broadcast in1, 1.0 where it holds and 0.0 elsewhere
+ *
+ * @tparam COMP_MODE One of the SfpuType::unary_{eq,ne,gt,lt,ge,le} comparisons.
+ * @param in1 The scalar in float32 format, or with BinaryBroadcast::Row/Column the Dest tile holding the row or
+ * column.
+ * @param in1_index The row or column of in1, replicated by _sfpu_binary_bcast_replicate_row_/column_.
+ */
+template <bool APPROXIMATION_MODE, SfpuType COMP_MODE, BinaryBroadcast BROADCAST>
+inline void _calculate_comp_bcast_(const uint dst_index_in0, const uint in1, const uint dst_index_out, const uint in1_index = 0)
+{
+    const uint in0_offset = dst_index_in0 * BINARY_BCAST_DEST_TILE_SIZE;
+    const uint out_offset = dst_index_out * BINARY_BCAST_DEST_TILE_SIZE;
+    const uint in1_addr   = _binary_bcast_in1_addr_<BROADCAST>(in1, in1_index);
+
+    for (uint g = 0; g < BINARY_BCAST_OPERAND_GROUPS<BROADCAST>; g++)
+    {
+        const sfpi::vFloat operand = _binary_bcast_operand_<BROADCAST>(in1, in1_addr, g);
+
+        for (uint i = 0; i < 32 / BINARY_BCAST_OPERAND_GROUPS<BROADCAST>; i++)
+        {
+            const uint addr = _binary_bcast_addr_<BROADCAST>(g, i);
+            sfpi::vFloat v  = sfpi::dst_reg[(in0_offset + addr) / 2];
+            sfpi::vFloat val;
+
+            apply_unary_comp_float<COMP_MODE>(val, v, operand);
+
+            sfpi::dst_reg[(out_offset + addr) / 2] = val;
+        }
+    }
+}
+
+/**
+ * @brief Loads the broadcast operand of the integer kernels into LREG7: the scalar once, or operand group g of the
+ * replicated row or column
+ */
+template <BinaryBroadcast BROADCAST>
+inline void _binary_bcast_load_int_operand_(const int instr_mod, const uint in1, const uint in1_addr, const uint g)
+{
+    if constexpr (BROADCAST == BinaryBroadcast::Scalar)
+    {
+        if (g == 0)
+        {
+            TT_SFPLOADI(p_sfpu::LREG7, sfpi::SFPLOADI_MOD0_UPPER, in1 >> 16);
+            TT_SFPLOADI(p_sfpu::LREG7, sfpi::SFPLOADI_MOD0_LOWER, in1 & 0xFFFF);
+        }
+    }
+    else
+    {
+        TT_SFPLOAD(p_sfpu::LREG7, instr_mod, ADDR_MOD_3, in1_addr + _binary_bcast_operand_offset_<BROADCAST>(g));
+    }
+}
+
+/**
+ * @brief Elementwise in0 op in1 with a broadcast in1, for the ops of _calculate_sfpu_binary_bitwise_
+ *
+ * @param in1 The scalar's bits, or with BinaryBroadcast::Row/Column the Dest tile holding the row or column.
+ * @param in1_index The row or column of in1, replicated by _sfpu_binary_bcast_replicate_row_/column_<INSTRUCTION_MODE>.
+ */
+template <bool APPROXIMATION_MODE, BinaryBitwiseOp BITWISE_OP, BinaryBroadcast BROADCAST, InstrModLoadStore INSTRUCTION_MODE = INT32>
+inline void _calculate_sfpu_binary_bitwise_bcast_(const uint dst_index_in0, const uint in1, const uint dst_index_out, const uint in1_index = 0)
+{
+    constexpr auto instruction_mode = static_cast<std::underlying_type_t<InstrModLoadStore>>(INSTRUCTION_MODE);
+
+    const uint in0_offset = dst_index_in0 * BINARY_BCAST_DEST_TILE_SIZE;
+    const uint out_offset = dst_index_out * BINARY_BCAST_DEST_TILE_SIZE;
+    const uint in1_addr   = _binary_bcast_in1_addr_<BROADCAST>(in1, in1_index);
+
+    for (uint g = 0; g < BINARY_BCAST_OPERAND_GROUPS<BROADCAST>; g++)
+    {
+        _binary_bcast_load_int_operand_<BROADCAST>(instruction_mode, in1, in1_addr, g);
+
+        for (uint i = 0; i < 32 / BINARY_BCAST_OPERAND_GROUPS<BROADCAST>; i++)
+        {
+            const uint addr = _binary_bcast_addr_<BROADCAST>(g, i);
+            TT_SFPLOAD(p_sfpu::LREG0, instruction_mode, ADDR_MOD_3, in0_offset + addr);
+
+            if constexpr (BITWISE_OP == BinaryBitwiseOp::AND)
+            {
+                TTI_SFPAND(0, p_sfpu::LREG7, p_sfpu::LREG0, 0);
+            }
+            else if constexpr (BITWISE_OP == BinaryBitwiseOp::OR)
+            {
+                TTI_SFPOR(0, p_sfpu::LREG7, p_sfpu::LREG0, 0);
+            }
+            else if constexpr (BITWISE_OP == BinaryBitwiseOp::XOR)
+            {
+                TTI_SFPXOR(0, p_sfpu::LREG7, p_sfpu::LREG0, 0);
+            }
+
+            TT_SFPSTORE(p_sfpu::LREG0, instruction_mode, ADDR_MOD_3, out_offset + addr);
+        }
+    }
+}
+
+/**
+ * @brief Elementwise in0 shifted by in1 with a broadcast in1, for the shifts of ckernel_sfpu_shift.h
+ *
+ * @tparam BINOP LSHFT, RSHFT or LOGICAL_RSHFT.
+ * @param in1 The shift amount, or with BinaryBroadcast::Row/Column the Dest tile holding the shift amounts.
+ * @param in1_index The row or column of in1, replicated by _sfpu_binary_bcast_replicate_row_/column_<INSTRUCTION_MODE>.
+ */
+template <bool APPROXIMATION_MODE, BinaryOp BINOP, BinaryBroadcast BROADCAST, InstrModLoadStore INSTRUCTION_MODE, bool SIGN_MAGNITUDE_FORMAT>
+inline void _calculate_binary_shift_bcast_(const uint dst_index_in0, const uint in1, const uint dst_index_out, const uint in1_index = 0)
+{
+    static_assert(BINOP == BinaryOp::LSHFT || BINOP == BinaryOp::RSHFT || BINOP == BinaryOp::LOGICAL_RSHFT, "BINOP must be a shift.");
+    static_assert(is_valid_instruction_mode(INSTRUCTION_MODE), "INSTRUCTION_MODE must be one of: INT32_2S_COMP, INT32, LO16.");
+
+    constexpr int sfpload_instr_mod = SIGN_MAGNITUDE_FORMAT ? INT32_2S_COMP : static_cast<std::underlying_type_t<InstrModLoadStore>>(INSTRUCTION_MODE);
+
+    const uint in0_offset = dst_index_in0 * BINARY_BCAST_DEST_TILE_SIZE;
+    const uint out_offset = dst_index_out * BINARY_BCAST_DEST_TILE_SIZE;
+    const uint in1_addr   = _binary_bcast_in1_addr_<BROADCAST>(in1, in1_index);
+
+    for (uint g = 0; g < BINARY_BCAST_OPERAND_GROUPS<BROADCAST>; g++)
+    {
+        _binary_bcast_load_int_operand_<BROADCAST>(sfpload_instr_mod, in1, in1_addr, g);
+
+        for (uint i = 0; i < 32 / BINARY_BCAST_OPERAND_GROUPS<BROADCAST>; i++)
+        {
+            const uint addr = _binary_bcast_addr_<BROADCAST>(g, i);
+            TT_SFPLOAD(p_sfpu::LREG0, sfpload_instr_mod, ADDR_MOD_3, in0_offset + addr);
+            // The right shifts negate the amount in LREG1
+            TTI_SFPMOV(0, p_sfpu::LREG7, p_sfpu::LREG1, 0);
+
+            if constexpr (BINOP == BinaryOp::LSHFT)
+            {
+                _binary_left_shift_lregs_();
+            }
+            else if constexpr (BINOP == BinaryOp::RSHFT)
+            {
+                _binary_right_shift_lregs_();
+            }
+            else
+            {
+                _logical_right_shift_lregs_();
+            }
+
+            TT_SFPSTORE(p_sfpu::LREG0, sfpload_instr_mod, ADDR_MOD_3, out_offset + addr);
+        }
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
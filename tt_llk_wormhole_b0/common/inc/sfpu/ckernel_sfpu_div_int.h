@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "sfpi.h"
+
+/*
+ * Exact int32/uint32 division and remainder. The SFPU has no integer multiplier, so a quotient estimated from a
+ * float reciprocal could not be corrected exactly: that takes q * b in 32 bits. The division is done by restoring
+ * division instead, one quotient bit per step with integer shifts, adds and compares only.
+ *
+ * Signed operands are divided as magnitudes and the signs applied afterwards. Int32 in Dest is sign-magnitude, so
+ * -2^31 does not occur and neither does the overflowing -2^31 / -1. Division by 0 follows RISC-V: the quotient has
+ * every bit set (-1 for int32) and the remainder is the dividend.
+ */
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+enum class IntDivRounding : std::uint8_t
+{
+    Trunc, // quotient rounded toward 0, remainder with the sign of the dividend: C's / and %, torch.fmod
+    Floor, // quotient rounded down, remainder with the sign of the divisor: Python's // and %, torch.remainder
+};
+
+enum class IntDivOutput : std::uint8_t
+{
+    Quotient,
+    Remainder,
+    Both, // divmod, the remainder goes to its own tile
+};
+
+// Signed integers are handled in sign-magnitude, the form they are loaded from Dest in on Wormhole
+template <bool SIGNED>
+sfpi_inline sfpi::vUInt _div_int_magnitude_(const sfpi::vInt in)
+{
+    if constexpr (SIGNED)
+    {
+        return sfpi::reinterpret<sfpi::vUInt>(sfpi::setsgn(sfpi::reinterpret<sfpi::vFloat>(in), 0));
+    }
+    else
+    {
+        return sfpi::reinterpret<sfpi::vUInt>(in);
+    }
+}
+
+sfpi_inline sfpi::vInt _div_int_negate_(const sfpi::vInt mag)
+{
+    return sfpi::reinterpret<sfpi::vInt>(sfpi::setsgn(sfpi::reinterpret<sfpi::vFloat>(mag), 1));
+}
+
+/**
+ * @brief The value of magnitude mag with the sign of sign, a 0 magnitude stays +0
+ */
+template <bool SIGNED>
+sfpi_inline sfpi::vInt _div_int_with_sign_(const sfpi::vUInt mag, const sfpi::vInt sign)
+{
+    sfpi::vInt result = sfpi::reinterpret<sfpi::vInt>(mag);
+    if constexpr (SIGNED)
+    {
+        v_if (sign < 0 && result != 0)
+        {
+            result = _div_int_negate_(result);
+        }
+        v_endif;
+    }
+    return result;
+}
+
+/**
+ * @brief Runs steps steps of restoring division of the bits in quotient by divisor
+ *
+ * Every step moves the top bit of quotient into remainder and, where remainder >= divisor, subtracts divisor
+ * and shifts a 1 in behind the dividend's bits, else a 0. After 32 steps from a 0 remainder, quotient holds the
+ * quotient and remainder the remainder. The compare reads remainder - divisor as signed, which is exact for
+ * divisor <= 2^31 since remainder < 2 * divisor.
+ */
+sfpi_inline void _div_int_steps_(sfpi::vUInt &quotient, sfpi::vUInt &remainder, const sfpi::vUInt divisor, const int steps)
+{
+#pragma GCC unroll 0
+    for (int i = 0; i < steps; i++)
+    {
+        remainder = remainder << 1;
+        v_if (sfpi::reinterpret<sfpi::vInt>(quotient) < 0)
+        {
+            remainder = remainder + 1;
+        }
+        v_endif;
+        quotient = quotient << 1;
+
+        sfpi::vInt difference = sfpi::reinterpret<sfpi::vInt>(remainder - divisor);
+        v_if (difference >= 0)
+        {
+            remainder = sfpi::reinterpret<sfpi::vUInt>(difference);
+            quotient  = quotient + 1;
+        }
+        v_endif;
+    }
+}
+
+/**
+ * @brief Applies the rounding and the signs to the quotient and remainder magnitudes and stores them
+ */
+template <bool SIGNED, IntDivRounding ROUNDING, IntDivOutput OUTPUT>
+sfpi_inline void _div_int_store_(
+    const sfpi::vInt dividend,
+    const sfpi::vInt divisor,
+    sfpi::vUInt quotient,
+    sfpi::vUInt remainder,
+    const sfpi::vUInt divisor_mag,
+    const uint dst_index_out,
+    const uint dst_index_remainder)
+{
+    // size of each tile in Dest is 32 rows for sfpi
+    constexpr uint dst_tile_size_sfpi = 32;
+
+    sfpi::vInt quotient_sign  = dividend ^ divisor;
+    sfpi::vInt remainder_sign = dividend;
+    if constexpr (SIGNED && ROUNDING == IntDivRounding::Floor)
+    {
+        // q = -(|a| / |b|) - 1 and r = b - (|a| % |b|) when the signs differ and the division is inexact
+        v_if (quotient_sign < 0 && sfpi::reinterpret<sfpi::vInt>(remainder) != 0)
+        {
+            quotient  = quotient + 1;
+            remainder = divisor_mag - remainder;
+        }
+        v_endif;
+        remainder_sign = divisor;
+    }
+
+    sfpi::vInt quotient_out  = _div_int_with_sign_<SIGNED>(quotient, quotient_sign);
+    sfpi::vInt remainder_out = _div_int_with_sign_<SIGNED>(remainder, remainder_sign);
+
+    v_if (sfpi::reinterpret<sfpi::vInt>(divisor_mag) == 0)
+    {
+        if constexpr (SIGNED)
+        {
+            quotient_out = _div_int_negate_(1);
+        }
+        else
+        {
+            quotient_out = -1;
+        }
+        remainder_out = dividend;
+    }
+    v_endif;
+
+    if constexpr (OUTPUT != IntDivOutput::Remainder)
+    {
+        sfpi::dst_reg[dst_index_out * dst_tile_size_sfpi] = quotient_out;
+    }
+    if constexpr (OUTPUT == IntDivOutput::Remainder)
+    {
+        sfpi::dst_reg[dst_index_out * dst_tile_size_sfpi] = remainder_out;
+    }
+    if constexpr (OUTPUT == IntDivOutput::Both)
+    {
+        sfpi::dst_reg[dst_index_remainder * dst_tile_size_sfpi] = remainder_out;
+    }
+}
+
+/**
+ * @brief Elementwise integer division of the tile at dst_index_in0 by the tile at dst_index_in1
+ *
+ * @tparam SIGNED Int32 operands (true) or UInt32 (false).
+ * @tparam ROUNDING Trunc or Floor; the same for UInt32.
+ * @tparam OUTPUT The quotient, the remainder, or both.
+ * @param dst_index_out Dest tile of the quotient, or of the remainder when only the remainder is computed.
+ * @param dst_index_remainder Dest tile of the remainder with IntDivOutput::Both.
+ */
+template <bool APPROXIMATION_MODE, int ITERATIONS, bool SIGNED, IntDivRounding ROUNDING, IntDivOutput OUTPUT = IntDivOutput::Quotient>
+inline void _div_int_(const uint dst_index_in0, const uint dst_index_in1, const uint dst_index_out, const uint dst_index_remainder = 0)
+{
+    // size of each tile in Dest is 32 rows for sfpi
+    constexpr uint dst_tile_size_sfpi = 32;
+
+#pragma GCC unroll 0
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::vInt dividend = sfpi::dst_reg[dst_index_in0 * dst_tile_size_sfpi];
+        sfpi::vInt divisor  = sfpi::dst_reg[dst_index_in1 * dst_tile_size_sfpi];
+
+        sfpi::vUInt divisor_mag = _div_int_magnitude_<SIGNED>(divisor);
+        sfpi::vUInt quotient    = _div_int_magnitude_<SIGNED>(dividend);
+        sfpi::vUInt remainder   = 0;
+        _div_int_steps_(quotient, remainder, divisor_mag, 32);
+
+        if constexpr (!SIGNED)
+        {
+            // Past 2^31 the steps' compare overflows, but the quotient is 0 or 1
+            v_if (divisor < 0)
+            {
+                sfpi::vUInt difference = sfpi::reinterpret<sfpi::vUInt>(dividend) - divisor_mag;
+                quotient               = 0;
+                remainder              = sfpi::reinterpret<sfpi::vUInt>(dividend);
+                v_if (dividend < 0 && sfpi::reinterpret<sfpi::vInt>(difference) >= 0)
+                {
+                    quotient  = 1;
+                    remainder = difference;
+                }
+                v_endif;
+            }
+            v_endif;
+        }
+
+        _div_int_store_<SIGNED, ROUNDING, OUTPUT>(dividend, divisor, quotient, remainder, divisor_mag, dst_index_out, dst_index_remainder);
+        sfpi::dst_reg++;
+    }
+}
+
+/**
+ * @brief Elementwise integer division of the tile at dst_index_in by the scalar divisor
+ *
+ * The divisor is known up front, which gives the fast paths: a power of two is a shift and a mask, and any other
+ * divisor of bit length m + 1 skips the first m steps, whose remainder is still below it. Large divisors are the
+ * fastest, and a UInt32 divisor past 2^31 is a single compare.
+ *
+ * @param divisor The divisor's bits, in 2's complement for Int32.
+ */
+template <bool APPROXIMATION_MODE, int ITERATIONS, bool SIGNED, IntDivRounding ROUNDING, IntDivOutput OUTPUT = IntDivOutput::Quotient>
+inline void _div_int_scalar_(const uint dst_index_in, const uint dst_index_out, const std::uint32_t divisor, const uint dst_index_remainder = 0)
+{
+    // size of each tile in Dest is 32 rows for sfpi
+    constexpr uint dst_tile_size_sfpi = 32;
+
+    const bool negative         = SIGNED && static_cast<std::int32_t>(divisor) < 0;
+    const std::uint32_t mag     = negative ? 0u - divisor : divisor;
+    const bool power_of_two     = mag != 0 && (mag & (mag - 1)) == 0;
+    const int skipped_steps     = mag == 0 ? 0 : 31 - __builtin_clz(mag);
+    const bool single_compare   = !SIGNED && mag > 0x80000000u;
+    const std::int32_t sign_int = negative ? -1 : 1;
+
+#pragma GCC unroll 0
+    for (int d = 0; d < ITERATIONS; d++)
+    {
+        sfpi::vInt dividend     = sfpi::dst_reg[dst_index_in * dst_tile_size_sfpi];
+        sfpi::vInt divisor_in   = sign_int;
+        sfpi::vUInt divisor_mag = mag;
+
+        sfpi::vUInt quotient = _div_int_magnitude_<SIGNED>(dividend);
+        sfpi::vUInt remainder;
+        if (mag == 0)
+        {
+            // Replaced by the division by 0 results on storing
+            remainder = 0;
+        }
+        else if (power_of_two)
+        {
+            remainder = quotient & sfpi::vUInt(mag - 1);
+            quotient  = sfpi::shft(quotient, sfpi::vInt(-skipped_steps));
+        }
+        else if (single_compare)
+        {
+            sfpi::vUInt difference = quotient - divisor_mag;
+            remainder              = quotient;
+            quotient               = 0;
+            v_if (dividend < 0 && sfpi::reinterpret<sfpi::vInt>(difference) >= 0)
+            {
+                quotient  = 1;
+                remainder = difference;
+            }
+            v_endif;
+        }
+        else
+        {
+            // The top skipped_steps bits are the remainder after those steps, with 0 quotient bits behind them
+            remainder = sfpi::shft(quotient, sfpi::vInt(skipped_steps - 32));
+            quotient  = sfpi::shft(quotient, sfpi::vInt(skipped_steps));
+            _div_int_steps_(quotient, remainder, divisor_mag, 32 - skipped_steps);
+        }
+
+        _div_int_store_<SIGNED, ROUNDING, OUTPUT>(dividend, divisor_in, quotient, remainder, divisor_mag, dst_index_out, dst_index_remainder);
+        sfpi::dst_reg++;
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
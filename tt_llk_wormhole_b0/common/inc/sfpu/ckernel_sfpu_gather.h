@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "ckernel.h"
+#include "ckernel_addrmod.h"
+#include "ckernel_instr_params.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// Whether a moved row replaces the destination row or is added to it
+enum class GatherMode : std::uint8_t
+{
+    COPY,
+    ACCUMULATE,
+};
+
+// Rows of a 32x32 tile and the SFPLOAD/SFPSTORE address distance between consecutive Dest tiles
+constexpr uint GATHER_TILE_ROWS      = 32;
+constexpr uint GATHER_DEST_TILE_SIZE = 64;
+
+/**
+ * @brief SFPLOAD address of the 4-row group holding row of a 32x32 tile, relative to the tile
+ *
+ * (row & ~0x3) rounds down to the group, (row & 0x10) skips faces 0/1 for rows 16-31:
+ * rows 0-15 are at 0-12 in faces 0/1, rows 16-31 are at 32-44 in faces 2/3. The odd columns are at +2 and the
+ * right face at +16.
+ */
+constexpr uint _gather_row_group_addr_(const uint row)
+{
+    return (row & ~0x3) + (row & 0x10);
+}
+
+static constexpr uint gather_input_lreg[4]  = {p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LREG2, p_sfpu::LREG3};
+static constexpr uint gather_output_lreg[4] = {p_sfpu::LREG4, p_sfpu::LREG5, p_sfpu::LREG6, p_sfpu::LREG7};
+
+inline void _gather_load_group_(const uint first_lreg, const uint addr)
+{
+    TT_SFPLOAD(first_lreg, 0, ADDR_MOD_3, addr);          // Face 0/2, even columns
+    TT_SFPLOAD(first_lreg + 1, 0, ADDR_MOD_3, addr + 2);  // Face 0/2, odd columns
+    TT_SFPLOAD(first_lreg + 2, 0, ADDR_MOD_3, addr + 16); // Face 1/3, even columns
+    TT_SFPLOAD(first_lreg + 3, 0, ADDR_MOD_3, addr + 18); // Face 1/3, odd columns
+}
+
+inline void _gather_store_output_group_(const uint addr)
+{
+    TT_SFPSTORE(p_sfpu::LREG4, 0, ADDR_MOD_3, addr);      // Face 0/2, even columns
+    TT_SFPSTORE(p_sfpu::LREG5, 0, ADDR_MOD_3, addr + 2);  // Face 0/2, odd columns
+    TT_SFPSTORE(p_sfpu::LREG6, 0, ADDR_MOD_3, addr + 16); // Face 1/3, even columns
+    TT_SFPSTORE(p_sfpu::LREG7, 0, ADDR_MOD_3, addr + 18); // Face 1/3, odd columns
+}
+
+/**
+ * @brief Moves one 32-wide row between two Dest tiles: dst[dst_row] = src[src_row], or += with ACCUMULATE
+ *
+ * SFPLOAD and SFPSTORE move 4 consecutive rows at once, so the 4-row groups holding both rows are loaded into
+ * LREG0-3 and LREG4-7. SFPTRANSP turns each group inside out so that LREG k and LREG 4 + k hold row k of
+ * their group, the row is moved or added between them, and a second SFPTRANSP restores the storage layout.
+ *
+ * @param src_addr, dst_addr SFPLOAD address of the source and destination tiles, tile index * GATHER_DEST_TILE_SIZE
+ */
+template <GatherMode MODE>
+inline void _sfpu_move_row_(const uint src_addr, const uint src_row, const uint dst_addr, const uint dst_row)
+{
+    const uint input_row_addr  = src_addr + _gather_row_group_addr_(src_row);
+    const uint output_row_addr = dst_addr + _gather_row_group_addr_(dst_row);
+    const uint input_row_lreg  = gather_input_lreg[src_row % 4];
+    const uint output_row_lreg = gather_output_lreg[dst_row % 4];
+
+    _gather_load_group_(p_sfpu::LREG0, input_row_addr);
+    _gather_load_group_(p_sfpu::LREG4, output_row_addr);
+    TTI_SFPTRANSP(0, 0, 0, 0);
+
+    if constexpr (MODE == GatherMode::ACCUMULATE)
+    {
+        // dst = 1.0 * src + dst
+        TT_SFPADD(input_row_lreg, p_sfpu::LCONST_1, output_row_lreg, output_row_lreg, 0);
+        TTI_SFPNOP;
+    }
+    else
+    {
+        TT_SFPMOV(0, input_row_lreg, output_row_lreg, 0);
+    }
+
+    TTI_SFPTRANSP(0, 0, 0, 0);
+    _gather_store_output_group_(output_row_addr);
+}
+
+/**
+ * @brief Zeroes Dest tile dst_index with ZEROACC, four or eight instructions instead of 32 SFPSTOREs
+ *
+ * ZEROACC clears 16 Dest rows: a face of 16-bit data or half a face of 32-bit data. It runs on the math
+ * unit, so SFPU work is stalled until the clear has landed.
+ */
+template <bool is_fp32_dest_acc_en>
+inline void _sfpu_clear_dest_tile_(const uint dst_index)
+{
+    constexpr uint rows_of_16_per_tile = is_fp32_dest_acc_en ? 8 : 4;
+    const uint base_address            = (get_dest_buffer_base() >> 4) + dst_index * rows_of_16_per_tile;
+
+    for (uint i = 0; i < rows_of_16_per_tile; i++)
+    {
+        TT_ZEROACC(p_zeroacc::CLR_16, ADDR_MOD_7, base_address + i);
+    }
+    TTI_STALLWAIT(p_stall::STALL_SFPU, p_stall::MATH);
+}
+
+/**
+ * @brief Row gather: dst[i] = src[indices[i] - index_base] for the 32 rows of the tile at dst_tile
+ *
+ * This is embedding lookup and index_select along rows. The source is num_src_tiles tiles stacked vertically
+ * from src_tile, i.e. rows index_base to index_base + 32 * num_src_tiles - 1 of the table. Rows whose index
+ * falls outside that range are left untouched, so a table larger than Dest is gathered by calling this once per
+ * chunk of source tiles with the matching index_base, and a 0 row for invalid indices comes from clearing the
+ * output first with _sfpu_clear_dest_tile_. An embedding table wider than 32 columns is gathered one column tile
+ * at a time with the same indices. index_select along columns is a row gather between _llk_math_transpose_dest_
+ * of the source and of the output tiles.
+ *
+ * Rows of the same output group share one load and one store of the group, only the source group is loaded per
+ * row.
+ *
+ * @tparam IndexType std::uint16_t or std::uint32_t
+ * @param idx_addr L1 address of the 32 indices of this output tile
+ */
+template <typename IndexType>
+inline void _calculate_gather_rows_(const uint idx_addr, const uint src_tile, const uint num_src_tiles, const uint dst_tile, const uint index_base = 0)
+{
+    static_assert(std::is_same_v<IndexType, std::uint16_t> || std::is_same_v<IndexType, std::uint32_t>, "indices are 16 or 32 bit");
+
+    volatile tt_l1_ptr IndexType *idx_ptr = reinterpret_cast<volatile tt_l1_ptr IndexType *>(idx_addr);
+    const uint src_rows                   = num_src_tiles * GATHER_TILE_ROWS;
+    const uint dst_addr                   = dst_tile * GATHER_DEST_TILE_SIZE;
+
+    for (uint group = 0; group < GATHER_TILE_ROWS; group += 4)
+    {
+        const uint output_row_addr = dst_addr + _gather_row_group_addr_(group);
+        bool loaded                = false;
+
+        for (uint row = group; row < group + 4; row++)
+        {
+            // Indices below index_base wrap around and are skipped with the ones above the chunk
+            const uint src_row = static_cast<uint>(idx_ptr[row]) - index_base;
+            if (src_row >= src_rows)
+            {
+                continue;
+            }
+            const uint src_addr = (src_tile + src_row / GATHER_TILE_ROWS) * GATHER_DEST_TILE_SIZE;
+
+            if (loaded)
+            {
+                // LREG4-7 hold the output group transposed, bring it back before the next source group comes in
+                TTI_SFPTRANSP(0, 0, 0, 0);
+            }
+            else
+            {
+                _gather_load_group_(p_sfpu::LREG4, output_row_addr);
+                loaded = true;
+            }
+            _gather_load_group_(p_sfpu::LREG0, src_addr + _gather_row_group_addr_(src_row % GATHER_TILE_ROWS));
+            TTI_SFPTRANSP(0, 0, 0, 0);
+            TT_SFPMOV(0, gather_input_lreg[src_row % 4], gather_output_lreg[row % 4], 0);
+        }
+
+        if (loaded)
+        {
+            TTI_SFPTRANSP(0, 0, 0, 0);
+            _gather_store_output_group_(output_row_addr);
+        }
+    }
+}
+
+/**
+ * @brief Row scatter: dst[indices[i] - index_base] = src[i], or += with GatherMode::ACCUMULATE, for the 32 rows
+ * of the tile at src_tile
+ *
+ * The destination is num_dst_tiles tiles stacked vertically from dst_tile, indices outside of it are skipped the
+ * same way as in _calculate_gather_rows_. With COPY the last of several rows sent to the same index wins, with
+ * ACCUMULATE they are all added, which is embedding backward.
+ *
+ * @tparam IndexType std::uint16_t or std::uint32_t
+ * @param idx_addr L1 address of the 32 indices of this source tile
+ */
+template <typename IndexType, GatherMode MODE>
+inline void _calculate_scatter_rows_(const uint idx_addr, const uint src_tile, const uint dst_tile, const uint num_dst_tiles, const uint index_base = 0)
+{
+    static_assert(std::is_same_v<IndexType, std::uint16_t> || std::is_same_v<IndexType, std::uint32_t>, "indices are 16 or 32 bit");
+
+    volatile tt_l1_ptr IndexType *idx_ptr = reinterpret_cast<volatile tt_l1_ptr IndexType *>(idx_addr);
+    const uint dst_rows                   = num_dst_tiles * GATHER_TILE_ROWS;
+
+    for (uint row = 0; row < GATHER_TILE_ROWS; row++)
+    {
+        const uint dst_row = static_cast<uint>(idx_ptr[row]) - index_base;
+        if (dst_row >= dst_rows)
+        {
+            continue;
+        }
+        _sfpu_move_row_<MODE>(
+            src_tile * GATHER_DEST_TILE_SIZE, row, (dst_tile + dst_row / GATHER_TILE_ROWS) * GATHER_DEST_TILE_SIZE, dst_row % GATHER_TILE_ROWS);
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
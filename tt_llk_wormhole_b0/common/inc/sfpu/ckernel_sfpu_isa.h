@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "ckernel.h"
+#include "sfpi.h"
+
+// Wormhole encoding of the SFPU instructions used by the arch-neutral kernels in tt_llk_common/sfpu.
+// Every architecture provides this header with the same interface, only the encodings differ.
+namespace ckernel::sfpu::isa
+{
+
+// No single instruction transcendentals, kernels needing them use the sfpi implementations in common/inc/sfpu
+constexpr bool HAS_NONLINEAR = false;
+
+constexpr uint MEM_DEFAULT = InstrModLoadStore::DEFAULT;
+
+// Load/store the rows at the current dest address, ADDR_MOD_3 maps to ADDR_MOD_7 (all zeroes) through the addr mod base
+template <uint LREG, uint MEM_MODE = MEM_DEFAULT>
+inline void load()
+{
+    TTI_SFPLOAD(LREG, MEM_MODE, ADDR_MOD_3, 0);
+}
+
+template <uint LREG, uint MEM_MODE = MEM_DEFAULT>
+inline void store()
+{
+    TTI_SFPSTORE(LREG, MEM_MODE, ADDR_MOD_3, 0);
+}
+
+// Advance dest by the rows processed per SFPU instruction
+inline void next_rows()
+{
+    sfpi::dst_reg++;
+}
+
+// DST = A * B + C
+template <uint A, uint B, uint C, uint DST>
+inline void mad()
+{
+    TTI_SFPMAD(A, B, C, DST, 0);
+}
+
+// MAD results are not interlocked, a consumer issued right after the MAD reads the stale value
+inline void mad_fence()
+{
+    TTI_SFPNOP;
+}
+
+template <uint SRC, uint DST>
+inline void mov()
+{
+    TTI_SFPMOV(0, SRC, DST, 0);
+}
+
+template <uint SRC, uint DST>
+inline void abs()
+{
+    TTI_SFPABS(0, SRC, DST, 1 /*float*/);
+}
+
+// Float16_b immediate known at compile time
+template <uint LREG, uint16_t BF16>
+inline void load_imm16b()
+{
+    TTI_SFPLOADI(LREG, 0 /*Float16_b*/, BF16);
+}
+
+// Full fp32 immediate, written lower half first
+template <uint LREG>
+inline void load_imm(const uint32_t fp32_bits)
+{
+    TT_SFPLOADI(LREG, 10 /*lower 16 bits*/, fp32_bits & 0xFFFF);
+    TT_SFPLOADI(LREG, 8 /*upper 16 bits*/, fp32_bits >> 16);
+}
+
+inline void cc_enable()
+{
+    TTI_SFPENCC(1, 0, 0, 2);
+}
+
+// Clear the enable (imm[0] selected by mod1 = 2) and reset the result, all lanes write again as sfpi code expects
+inline void cc_disable()
+{
+    TTI_SFPENCC(0, 0, 0, 2);
+}
+
+// Re-enable all lanes after a conditional block
+inline void cc_end()
+{
+    TTI_SFPENCC(0, 0, 0, 0);
+}
+
+inline void cc_else()
+{
+    TTI_SFPCOMPC(0, 0, 0, 0);
+}
+
+template <uint LREG>
+inline void cc_if_negative()
+{
+    TTI_SFPSETCC(0, LREG, 0, 0);
+}
+
+template <uint LREG>
+inline void cc_if_not_negative()
+{
+    TTI_SFPSETCC(0, LREG, 0, 4);
+}
+
+template <uint LREG>
+inline void cc_if_zero()
+{
+    TTI_SFPSETCC(0, LREG, 0, 6);
+}
+
+} // namespace ckernel::sfpu::isa
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel.h"
+#include "ckernel_addrmod.h"
+#include "ckernel_instr_params.h"
+#include "sfpi.h"
+
+/*
+ * First-order linear recurrence along the rows of a tile, h[t] = a[t] * h[t - 1] + b[t], with a and b per element:
+ * the selective scan of state-space models, of which _calculate_ema_tile_ is the case of constant a and b.
+ * Rows are time steps and the 32 columns are independent channels.
+ *
+ * Four rows of a column group are loaded into one LREG, so the registers hold a 4x4 grid of (row, column group);
+ * SFPTRANSP turns it into one row of all 32 columns per LREG, where consecutive time steps are consecutive LREGs.
+ * All eight LREGs carry a and b of a 4-row block, so the state cannot sit in its own register the way the EMA
+ * keeps it in LREG4. It is kept in LREG0-3 in the loaded layout instead, as a 4-row block whose first row is the
+ * state and whose other rows are 0. Multiplied by a block of a it leaves a[0] * state in the first row and 0 in the
+ * others, so adding it to the block of b folds the state into the first time step elementwise, before the transpose.
+ */
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// SFPLOAD/SFPSTORE address distance between Dest tiles, and the column groups: even and odd columns of face 0, then face 1
+constexpr uint LINEAR_SCAN_DEST_TILE_SIZE    = 64;
+constexpr uint LINEAR_SCAN_COLUMN_OFFSETS[4] = {0, 2, 16, 18};
+
+/**
+ * @brief Moves row 0 of the transposed LREG0-3, which holds the new state, into the state layout
+ *
+ * LREG1-3 are zeroed and the transpose spreads LREG0 back over column groups, into row 0 of each of LREG0-3.
+ */
+sfpi_inline void _linear_scan_state_from_row_()
+{
+    TTI_SFPLOADI(p_sfpu::LREG1, sfpi::SFPLOADI_MOD0_FLOATB, 0);
+    TTI_SFPLOADI(p_sfpu::LREG2, sfpi::SFPLOADI_MOD0_FLOATB, 0);
+    TTI_SFPLOADI(p_sfpu::LREG3, sfpi::SFPLOADI_MOD0_FLOATB, 0);
+    TTI_SFPTRANSP(0, 0, 0, 0);
+}
+
+/**
+ * @brief Sets the state of every channel to value, 0 starts a new sequence and 1 makes the scan without b
+ * compute the running product of a.
+ *
+ * @param value The state in float32 format.
+ */
+inline void _set_linear_scan_state_(const uint value)
+{
+    TT_SFPLOADI(p_sfpu::LREG0, sfpi::SFPLOADI_MOD0_UPPER, value >> 16);
+    TT_SFPLOADI(p_sfpu::LREG0, sfpi::SFPLOADI_MOD0_LOWER, value & 0xFFFF);
+    _linear_scan_state_from_row_();
+}
+
+/**
+ * @brief Sets the state of every channel from row `row` of the Dest tile at tile_idx, e.g. row 31 of the output of
+ * a previous chunk or an initial state h[-1].
+ */
+inline void _load_linear_scan_state_(const uint tile_idx, const uint row)
+{
+    const uint addr = tile_idx * LINEAR_SCAN_DEST_TILE_SIZE + (row & ~0x3) + (row & 0x10);
+    for (uint c = 0; c < 4; c++)
+    {
+        TT_SFPLOAD(p_sfpu::LREG0 + c, InstrModLoadStore::DEFAULT, ADDR_MOD_3, addr + LINEAR_SCAN_COLUMN_OFFSETS[c]);
+    }
+    TTI_SFPTRANSP(0, 0, 0, 0);
+    TT_SFPMOV(0, p_sfpu::LREG0 + row % 4, p_sfpu::LREG0, 0);
+    _linear_scan_state_from_row_();
+}
+
+/**
+ * @brief Runs the recurrence over the 32 rows of a tile, h[t] = a[t] * h[t - 1] + b[t]
+ *
+ * The state enters from LREG0-3, set by _set_linear_scan_state_ or _load_linear_scan_state_ or left by the previous
+ * call, and leaves there holding row 31 of h. A sequence of any length is scanned one time tile per call, across Dest
+ * sections too, as long as nothing else runs on the SFPU in between. h_tile may be a_tile or b_tile.
+ *
+ * Without b, HAS_B = false, the scan is h[t] = a[t] * h[t - 1], which gives the running product of a from a state of
+ * 1 and the carry a chunk receives from a state of s. This makes a chunked parallel scan of a long sequence:
+ * 1. every chunk, independently: its scan from 0, and its running product of a from 1;
+ * 2. the states between chunks: a scan over the chunks, with row 31 of the products as a and row 31 of the scans as b;
+ * 3. every chunk, independently: its scan plus the scan without b from the state entering it, an eltwise add.
+ *
+ * @tparam HAS_B Whether b is read from b_tile or is 0.
+ */
+template <bool HAS_B = true>
+inline void _calculate_linear_scan_tile_(const uint a_tile, const uint b_tile, const uint h_tile)
+{
+    const uint a_offset = a_tile * LINEAR_SCAN_DEST_TILE_SIZE;
+    const uint b_offset = b_tile * LINEAR_SCAN_DEST_TILE_SIZE;
+    const uint h_offset = h_tile * LINEAR_SCAN_DEST_TILE_SIZE;
+
+    // Rows 0-15 are at 0-12 in faces 0/1, rows 16-31 at 32-44 in faces 2/3
+    for (uint row = 0; row < 32; row += 4)
+    {
+        const uint block = (row & ~0x3) + (row & 0x10);
+
+        // b[0] += a[0] * state, a and b of column group c into LREG c and LREG 4 + c
+#pragma GCC unroll 4
+        for (uint c = 0; c < 4; c++)
+        {
+            const uint column = block + LINEAR_SCAN_COLUMN_OFFSETS[c];
+
+            TT_SFPLOAD(p_sfpu::LREG4 + c, InstrModLoadStore::DEFAULT, ADDR_MOD_3, a_offset + column);
+            TT_SFPMAD(p_sfpu::LREG0 + c, p_sfpu::LREG4 + c, p_sfpu::LCONST_0, p_sfpu::LREG0 + c, 0);
+            TTI_SFPNOP;
+            if constexpr (HAS_B)
+            {
+                TT_SFPLOAD(p_sfpu::LREG4 + c, InstrModLoadStore::DEFAULT, ADDR_MOD_3, b_offset + column);
+                TT_SFPADD(p_sfpu::LREG0 + c, p_sfpu::LCONST_1, p_sfpu::LREG4 + c, p_sfpu::LREG4 + c, 0);
+                TTI_SFPNOP;
+            }
+            else
+            {
+                TT_SFPMOV(0, p_sfpu::LREG0 + c, p_sfpu::LREG4 + c, 0);
+            }
+            TT_SFPLOAD(p_sfpu::LREG0 + c, InstrModLoadStore::DEFAULT, ADDR_MOD_3, a_offset + column);
+        }
+
+        // One time step per LREG: a[0..3] in LREG0-3, h[0] and b[1..3] in LREG4-7
+        TTI_SFPTRANSP(0, 0, 0, 0);
+
+        TTI_SFPMAD(p_sfpu::LREG1, p_sfpu::LREG4, p_sfpu::LREG5, p_sfpu::LREG5, 0); // h[1] = a[1] * h[0] + b[1]
+        TTI_SFPNOP;
+        TTI_SFPMAD(p_sfpu::LREG2, p_sfpu::LREG5, p_sfpu::LREG6, p_sfpu::LREG6, 0); // h[2] = a[2] * h[1] + b[2]
+        TTI_SFPNOP;
+        TTI_SFPMAD(p_sfpu::LREG3, p_sfpu::LREG6, p_sfpu::LREG7, p_sfpu::LREG7, 0); // h[3] = a[3] * h[2] + b[3]
+        TTI_SFPNOP;
+
+        // h[3] becomes the state in LREG0-3, h[0..3] go back to the Dest layout in LREG4-7
+        TTI_SFPMOV(0, p_sfpu::LREG7, p_sfpu::LREG0, 0);
+        _linear_scan_state_from_row_();
+
+#pragma GCC unroll 4
+        for (uint c = 0; c < 4; c++)
+        {
+            TT_SFPSTORE(p_sfpu::LREG4 + c, InstrModLoadStore::DEFAULT, ADDR_MOD_3, h_offset + block + LINEAR_SCAN_COLUMN_OFFSETS[c]);
+        }
+    }
+}
+
+} // namespace sfpu
+} // namespace ckernel
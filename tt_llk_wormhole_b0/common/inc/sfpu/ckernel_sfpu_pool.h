@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "ckernel_addrmod.h"
+#include "ckernel_instr_params.h"
+#include "ckernel_sfpu_load_config.h"
+#include "sfpi.h"
+
+namespace ckernel
+{
+namespace sfpu
+{
+
+// Window elements held by one Dest tile, one per row, and the SFPLOAD/SFPSTORE address distance between tiles
+constexpr uint POOL_TILE_ROWS      = 32;
+constexpr uint POOL_DEST_TILE_SIZE = 64;
+
+// Column groups of the top faces: even and odd columns of face 0, then of face 1
+constexpr uint POOL_COLUMN_OFFSETS[4] = {0, 2, 16, 18};
+
+// bf16 bit patterns of the values rows past the end of a window are read as
+constexpr uint POOL_MAX_PAD = 0xFF80; // -inf
+constexpr uint POOL_AVG_PAD = 0x0000; // 0
+
+/**
+ * @brief SFPLOAD address of the 4-row group holding window element `row`, relative to the first window tile
+ *
+ * Element row is in tile row / 32; rows 0-15 of a tile are at 0-12 in faces 0/1, rows 16-31 at 32-44 in faces 2/3.
+ */
+constexpr uint _pool_row_group_addr_(const uint row)
+{
+    return (row / POOL_TILE_ROWS) * POOL_DEST_TILE_SIZE + ((row % POOL_TILE_ROWS) & ~0x3) + (row & 0x10);
+}
+
+/**
+ * @brief Column-wise MaxPool of one window spread over consecutive Dest tiles, with the index of the max.
+ *        Generalizes _calculate_max_pool_with_indices_ to any window, e.g. 5x5 and 7x7 kernels.
+ *
+ * The reader lays out the window of one output position as rows: element e of the kernel window, after stride,
+ * dilation and padding have been applied, is row e % 32 of tile e / 32, and the 32 columns are channels. Padded
+ * positions hold -inf. The indices tiles hold the input position of each element, e.g. h * W + w, which is the
+ * index max_pool2d returns for the backward pass. Rows past window_size in the last 4-row group are read too and
+ * have to be -inf as well; whole 4-row groups past it are skipped.
+ *
+ * Each column group reduces 16 rows per pass with the replay buffer programmed by
+ * _init_max_pool_window_with_indices_ and keeps the running max in row 0 of the first values and indices tiles,
+ * which is where the result ends up. When several elements hold the max, the index of any of them is returned.
+ *
+ * @tparam is_fp32_dest_acc_en Whether Dest is in 32bit mode (true) or 16bit mode (false).
+ * @param values_tile_idx The index of the first Dest tile of the window.
+ * @param indices_tile_idx The index of the first Dest tile of the window's indices.
+ * @param window_size Number of elements in the window, kernel_h * kernel_w.
+ */
+template <bool is_fp32_dest_acc_en>
+inline void _calculate_max_pool_window_with_indices_(const uint values_tile_idx, const uint indices_tile_idx, const uint window_size)
+{
+    constexpr uint8_t instr_mod_index = is_fp32_dest_acc_en ? InstrModLoadStore::INT32 : InstrModLoadStore::LO16;
+    const uint values_tile_offset     = values_tile_idx * POOL_DEST_TILE_SIZE;
+    const uint indices_tile_offset    = indices_tile_idx * POOL_DEST_TILE_SIZE;
+
+    for (int i = 0; i < 4; i++)
+    {
+        const uint column_offset = POOL_COLUMN_OFFSETS[i];
+
+        for (uint block = 0; block < window_size; block += 16)
+        {
+            // Four 4-row groups into LREG0-3, their indices into LREG4-7
+            for (uint group = 0; group < 4; group++)
+            {
+                const uint row = block + 4 * group;
+                if (row < window_size)
+                {
+                    const uint addr = _pool_row_group_addr_(row) + column_offset;
+                    TT_SFPLOAD(p_sfpu::LREG0 + group, InstrModLoadStore::DEFAULT, ADDR_MOD_3, values_tile_offset + addr);
+                    TT_SFPLOAD(p_sfpu::LREG4 + group, instr_mod_index, ADDR_MOD_3, indices_tile_offset + addr);
+                }
+                else
+                {
+                    TT_SFPLOADI(p_sfpu::LREG0 + group, sfpi::SFPLOADI_MOD0_FLOATB, POOL_MAX_PAD);
+                }
+            }
+
+            // Max of the 16 rows into row 0 of LREG0, its index into row 0 of LREG4
+            lltt::replay(0, 8);
+
+            if (block > 0)
+            {
+                // Running max of the previous blocks
+                TT_SFPLOAD(p_sfpu::LREG1, InstrModLoadStore::DEFAULT, ADDR_MOD_3, values_tile_offset + column_offset);
+                TT_SFPLOAD(p_sfpu::LREG5, instr_mod_index, ADDR_MOD_3, indices_tile_offset + column_offset);
+                TTI_SFPSWAP(0, p_sfpu::LREG0, p_sfpu::LREG1, p_sfpswap::ALL_ROWS_MAX);
+            }
+
+            TT_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, values_tile_offset + column_offset);
+            TT_SFPSTORE(p_sfpu::LREG4, instr_mod_index, ADDR_MOD_3, indices_tile_offset + column_offset);
+        }
+    }
+}
+
+inline void _init_max_pool_window_with_indices_()
+{
+    // Destination Index Tracking Mode: LREGs 4-7 mirror the movement of the values in LREGs 0-3
+    _sfpu_load_config32_(0xF, 0x0, 0x4);
+
+    lltt::record(0, 8);
+
+    // LREG k holds rows 4k..4k+3, transposed LREG k holds row k of every group
+    TTI_SFPTRANSP(0, 0, 0, 0);
+
+    // Max of each group's 4 rows into LREG0
+    TTI_SFPSWAP(0, p_sfpu::LREG0, p_sfpu::LREG1, p_sfpswap::ALL_ROWS_MAX);
+    TTI_SFPSWAP(0, p_sfpu::LREG2, p_sfpu::LREG3, p_sfpswap::ALL_ROWS_MAX);
+    TTI_SFPSWAP(0, p_sfpu::LREG0, p_sfpu::LREG2, p_sfpswap::ALL_ROWS_MAX);
+
+    // Transposed back, row 0 of LREG k holds the max of group k
+    TTI_SFPTRANSP(0, 0, 0, 0);
+
+    // Max of the 4 groups into row 0 of LREG0
+    TTI_SFPSWAP(0, p_sfpu::LREG0, p_sfpu::LREG1, p_sfpswap::ALL_ROWS_MAX);
+    TTI_SFPSWAP(0, p_sfpu::LREG2, p_sfpu::LREG3, p_sfpswap::ALL_ROWS_MAX);
+    TTI_SFPSWAP(0, p_sfpu::LREG0, p_sfpu::LREG2, p_sfpswap::ALL_ROWS_MAX);
+}
+
+/**
+ * @brief Column-wise average pooling of one window spread over consecutive Dest tiles, laid out as for
+ *        _calculate_max_pool_window_with_indices_ with padded positions and the rows past the window holding 0.
+ *
+ * The sum is taken in fp32 32 rows at a time, the same way as _calculate_reduce_, and scaled by 1 / divisor. The
+ * divisor is the reader's choice per output position: kernel_h * kernel_w with count_include_pad, else the number of
+ * window elements inside the input. The result is in row 0 of the first tile.
+ *
+ * @param values_tile_idx The index of the first Dest tile of the window.
+ * @param window_size Number of elements in the window, kernel_h * kernel_w.
+ * @param scale 1 / divisor in fp32 format.
+ */
+inline void _calculate_avg_pool_window_(const uint values_tile_idx, const uint window_size, const uint scale)
+{
+    const uint values_tile_offset = values_tile_idx * POOL_DEST_TILE_SIZE;
+
+    for (int i = 0; i < 4; i++)
+    {
+        const uint column_offset = POOL_COLUMN_OFFSETS[i];
+
+        for (uint block = 0; block < window_size; block += POOL_TILE_ROWS)
+        {
+            // The tile's eight 4-row groups into LREG0-7, rows 0-15 in LREG0-3 and rows 16-31 in LREG4-7
+            for (uint group = 0; group < 8; group++)
+            {
+                const uint row = block + 4 * group;
+                if (row < window_size)
+                {
+                    TT_SFPLOAD(p_sfpu::LREG0 + group, InstrModLoadStore::DEFAULT, ADDR_MOD_3, values_tile_offset + _pool_row_group_addr_(row) + column_offset);
+                }
+                else
+                {
+                    TT_SFPLOADI(p_sfpu::LREG0 + group, sfpi::SFPLOADI_MOD0_FLOATB, POOL_AVG_PAD);
+                }
+            }
+
+            TTI_SFPTRANSP(0, 0, 0, 0);
+            lltt::replay(0, 12); // Sum of each group's 4 rows
+            TTI_SFPTRANSP(0, 0, 0, 0);
+            lltt::replay(0, 12); // Sum of the groups into row 0 of LREG0 and LREG4
+
+            TTI_SFPADD(p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG4, p_sfpu::LREG0, 0);
+            TTI_SFPNOP;
+
+            if (block > 0)
+            {
+                // Running sum of the previous tiles
+                TT_SFPLOAD(p_sfpu::LREG1, InstrModLoadStore::DEFAULT, ADDR_MOD_3, values_tile_offset + column_offset);
+                TTI_SFPADD(p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG1, p_sfpu::LREG0, 0);
+                TTI_SFPNOP;
+            }
+
+            if (block + POOL_TILE_ROWS >= window_size)
+            {
+                TT_SFPLOADI(p_sfpu::LREG1, 10, scale & 0xFFFF);
+                TT_SFPLOADI(p_sfpu::LREG1, 8, scale >> 16);
+                TTI_SFPMUL(p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LCONST_0, p_sfpu::LREG0, 0);
+                TTI_NOP;
+            }
+
+            TT_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, values_tile_offset + column_offset);
+        }
+    }
+}
+
+inline void _init_avg_pool_window_()
+{
+    // Plain SFPU configuration, in case index tracking was left on by max pooling
+    _init_sfpu_config_reg();
+
+    lltt::record(0, 12);
+
+    // LREG0 += LREG1 + LREG2 + LREG3 and LREG4 += LREG5 + LREG6 + LREG7
+    TTI_SFPADD(p_sfpu::LREG2, p_sfpu::LCONST_1, p_sfpu::LREG3, p_sfpu::LREG2, 0);
+    TTI_SFPNOP;
+    TTI_SFPADD(p_sfpu::LREG1, p_sfpu::LCONST_1, p_sfpu::LREG2, p_sfpu::LREG1, 0);
+    TTI_SFPNOP;
+    TTI_SFPADD(p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG1, p_sfpu::LREG0, 0);
+    TTI_SFPNOP;
+    TTI_SFPADD(p_sfpu::LREG6, p_sfpu::LCONST_1, p_sfpu::LREG7, p_sfpu::LREG6, 0);
+    TTI_SFPNOP;
+    TTI_SFPADD(p_sfpu::LREG5, p_sfpu::LCONST_1, p_sfpu::LREG6, p_sfpu::LREG5, 0);
+    TTI_SFPNOP;
+    TTI_SFPADD(p_sfpu::LREG4, p_sfpu::LCONST_1, p_sfpu::LREG5, p_sfpu::LREG4, 0);
+    TTI_SFPNOP;
+}
+
+} // namespace sfpu
+} // namespace ckernel
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "ckernel_addrmod.h"
 #include "ckernel_instr_params.h"
 #include "sfpi.h"
@@ -260,6 +262,186 @@ inline void _calculate_reduce_()
     }
 }
 
+// SFPLOAD/SFPSTORE address distance between Dest tiles, and the row 0 address of each column group:
+// even and odd columns of face 0, then of face 1
+constexpr uint REDUCE_DEST_TILE_SIZE          = 64;
+constexpr uint REDUCE_COLUMN_GROUP_ADDRS[4]   = {0, 2, 16, 18};
+constexpr uint REDUCE_LOWER_FACE_OFFSET       = 32;
+constexpr uint REDUCE_COMPENSATION_ROW_OFFSET = 4;
+constexpr uint REDUCE_RUNNING_SUM_ROW_OFFSET  = 8;
+
+/**
+ * @brief Column sums of one column group of the Dest tile at tile_offset into row 0 of LREG0, in fp32,
+ *        with the float replay buffer of _init_reduce_
+ */
+inline void _reduce_column_group_partial_(const uint tile_offset, const uint column_group_addr)
+{
+    const uint upper = tile_offset + column_group_addr;
+    const uint lower = upper + REDUCE_LOWER_FACE_OFFSET;
+    for (uint group = 0; group < 4; group++)
+    {
+        TT_SFPLOAD(p_sfpu::LREG0 + group, InstrModLoadStore::DEFAULT, ADDR_MOD_3, upper + 4 * group);
+        TT_SFPLOAD(p_sfpu::LREG4 + group, InstrModLoadStore::DEFAULT, ADDR_MOD_3, lower + 4 * group);
+    }
+
+    TTI_SFPTRANSP(0, 0, 0, 0);
+    lltt::replay(0, 12);
+    TTI_SFPTRANSP(0, 0, 0, 0);
+    lltt::replay(0, 12);
+
+    TTI_SFPADD(p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG4, p_sfpu::LREG0, 0);
+    TTI_SFPNOP;
+}
+
+/**
+ * @brief Column-wise sum or average of num_tiles consecutive Dest tiles, placing output values into the first row of
+ *        the first tile, as for one 32 * num_tiles rows tall column.
+ *
+ * Each tile is reduced in fp32 as by _calculate_reduce_; the summation mode sets how the tiles' partial sums are
+ * added up. The running values live in the first tile, so with a 16-bit Dest every step of a naive sum is rounded to
+ * Float16_b and its error grows with num_tiles:
+ * - Pairwise stores every partial to row 0 of its own tile and adds them in a binary tree, log2(num_tiles) roundings
+ *   deep. It costs a store per tile and a load per add more than Naive.
+ * - Kahan keeps the running sum s in rows 8-11 of the first tile and the compensation term c in rows 4-7. Each
+ *   partial p is added as y = p - c, t = s + y, c = (t - s) - y, where t is read back from Dest so that c holds the
+ *   rounding error of the Dest format, not of the fp32 LREGs. Row 0 gets s - c, within a rounding of the exact sum of
+ *   the partials whatever num_tiles is. Rows 4-11 of the first tile are overwritten.
+ *
+ * A column taller than a Dest section is streamed through it: a first call over a whole section, then calls with
+ * accumulate over the tiles unpacked after the first tile, which keeps the running values in between. Naive and Kahan
+ * go on as over one column; Pairwise adds the tree of every call to the running sum, one rounding more per call.
+ *
+ * The FPU reduce of llk_math_reduce.h keeps its naive order, a tree or compensation for it is out of scope: the FPU
+ * only adds SrcA and SrcB into Dest, so every level of a tree over partials held in Dest would move them back into
+ * the source registers first.
+ *
+ * Uses the replay buffer programmed by _init_reduce_<DataFormat::Float32>(), which does not depend on the Dest format.
+ *
+ * @tparam pool_type SUM or AVG, which divides by 32 * num_tiles. A streamed column is summed only.
+ * @tparam reduce_dim Only REDUCE_COL is supported.
+ * @tparam format The Dest format, Float32 or Float16_b.
+ * @tparam summation The order of adding up the tiles, see ReduceSummation.
+ * @tparam accumulate Add the num_tiles tiles after the first tile to the running values of an earlier call.
+ * @param num_tiles The number of tiles, relative to the tile set by _llk_math_eltwise_unary_sfpu_start_.
+ */
+template <PoolType pool_type, ReduceDim reduce_dim, DataFormat format, ReduceSummation summation = ReduceSummation::Naive, bool accumulate = false>
+inline void _calculate_reduce_tiles_(const uint num_tiles)
+{
+    static_assert(reduce_dim == REDUCE_COL, "Only column reduction (REDUCE_COL) is currently supported");
+    static_assert(pool_type == SUM || pool_type == AVG, "Only SUM and AVG pool types are currently supported");
+    static_assert(format == DataFormat::Float32 || format == DataFormat::Float16_b, "Supported formats: Float32, Float16_b");
+    static_assert(!accumulate || pool_type == SUM, "Only SUM is supported with accumulate");
+
+    const uint scale = __builtin_bit_cast(std::uint32_t, 1.0f / static_cast<float>(32 * num_tiles));
+
+    // With accumulate the first tile only holds the running values, the tiles to add follow it
+    const uint first_tile = accumulate ? 1 : 0;
+    const uint end_tile   = first_tile + num_tiles;
+
+    for (uint i = 0; i < 4; i++)
+    {
+        const uint sum_addr          = REDUCE_COLUMN_GROUP_ADDRS[i];
+        const uint compensation_addr = sum_addr + REDUCE_COMPENSATION_ROW_OFFSET;
+        const uint running_sum_addr  = sum_addr + REDUCE_RUNNING_SUM_ROW_OFFSET;
+
+        if constexpr (summation == ReduceSummation::Pairwise)
+        {
+            for (uint tile = first_tile; tile < end_tile; tile++)
+            {
+                _reduce_column_group_partial_(tile * REDUCE_DEST_TILE_SIZE, sum_addr);
+                TT_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, tile * REDUCE_DEST_TILE_SIZE + sum_addr);
+            }
+
+            // Level k adds the partial of tile + 2^k into tile, for every tile that is a multiple of 2^(k + 1)
+            for (uint stride = 1; stride < num_tiles; stride *= 2)
+            {
+                for (uint tile = first_tile; tile + stride < end_tile; tile += 2 * stride)
+                {
+                    TT_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, tile * REDUCE_DEST_TILE_SIZE + sum_addr);
+                    TT_SFPLOAD(p_sfpu::LREG1, InstrModLoadStore::DEFAULT, ADDR_MOD_3, (tile + stride) * REDUCE_DEST_TILE_SIZE + sum_addr);
+                    TTI_SFPADD(p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG1, p_sfpu::LREG0, 0);
+                    TTI_SFPNOP;
+                    TT_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, tile * REDUCE_DEST_TILE_SIZE + sum_addr);
+                }
+            }
+
+            if constexpr (accumulate)
+            {
+                TT_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, sum_addr);
+                TT_SFPLOAD(p_sfpu::LREG1, InstrModLoadStore::DEFAULT, ADDR_MOD_3, first_tile * REDUCE_DEST_TILE_SIZE + sum_addr);
+                TTI_SFPADD(p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG1, p_sfpu::LREG0, 0);
+                TTI_SFPNOP;
+            }
+        }
+        else
+        {
+            if constexpr (!accumulate)
+            {
+                _reduce_column_group_partial_(0, sum_addr);
+                if constexpr (summation == ReduceSummation::Kahan)
+                {
+                    TT_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, running_sum_addr);
+                    TTI_SFPLOADI(p_sfpu::LREG1, sfpi::SFPLOADI_MOD0_FLOATB, 0);
+                    TT_SFPSTORE(p_sfpu::LREG1, InstrModLoadStore::DEFAULT, ADDR_MOD_3, compensation_addr);
+                }
+                else
+                {
+                    TT_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, sum_addr);
+                }
+            }
+
+            for (uint tile = 1; tile < end_tile; tile++)
+            {
+                _reduce_column_group_partial_(tile * REDUCE_DEST_TILE_SIZE, sum_addr);
+
+                if constexpr (summation == ReduceSummation::Naive)
+                {
+                    TT_SFPLOAD(p_sfpu::LREG1, InstrModLoadStore::DEFAULT, ADDR_MOD_3, sum_addr);
+                    TTI_SFPADD(p_sfpu::LREG0, p_sfpu::LCONST_1, p_sfpu::LREG1, p_sfpu::LREG0, 0);
+                    TTI_SFPNOP;
+                    TT_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, sum_addr);
+                }
+                else
+                {
+                    TT_SFPLOAD(p_sfpu::LREG1, InstrModLoadStore::DEFAULT, ADDR_MOD_3, running_sum_addr);
+                    TT_SFPLOAD(p_sfpu::LREG2, InstrModLoadStore::DEFAULT, ADDR_MOD_3, compensation_addr);
+
+                    TTI_SFPMAD(p_sfpu::LREG2, p_sfpu::LCONST_neg1, p_sfpu::LREG0, p_sfpu::LREG0, 0); // y = p - c
+                    TTI_SFPNOP;
+                    TTI_SFPADD(p_sfpu::LREG1, p_sfpu::LCONST_1, p_sfpu::LREG0, p_sfpu::LREG3, 0); // t = s + y
+                    TTI_SFPNOP;
+                    TT_SFPSTORE(p_sfpu::LREG3, InstrModLoadStore::DEFAULT, ADDR_MOD_3, running_sum_addr);
+                    TT_SFPLOAD(p_sfpu::LREG3, InstrModLoadStore::DEFAULT, ADDR_MOD_3, running_sum_addr); // t as rounded by Dest
+
+                    TTI_SFPMAD(p_sfpu::LREG1, p_sfpu::LCONST_neg1, p_sfpu::LREG3, p_sfpu::LREG2, 0); // t - s
+                    TTI_SFPNOP;
+                    TTI_SFPMAD(p_sfpu::LREG0, p_sfpu::LCONST_neg1, p_sfpu::LREG2, p_sfpu::LREG2, 0); // c = (t - s) - y
+                    TTI_SFPNOP;
+                    TT_SFPSTORE(p_sfpu::LREG2, InstrModLoadStore::DEFAULT, ADDR_MOD_3, compensation_addr);
+                }
+            }
+
+            if constexpr (summation == ReduceSummation::Kahan)
+            {
+                TT_SFPLOAD(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, running_sum_addr);
+                TT_SFPLOAD(p_sfpu::LREG2, InstrModLoadStore::DEFAULT, ADDR_MOD_3, compensation_addr);
+                TTI_SFPMAD(p_sfpu::LREG2, p_sfpu::LCONST_neg1, p_sfpu::LREG0, p_sfpu::LREG0, 0); // s - c
+                TTI_SFPNOP;
+            }
+        }
+
+        // Every mode leaves the column sums in LREG0
+        if constexpr (pool_type == AVG)
+        {
+            TT_SFPLOADI(p_sfpu::LREG1, sfpi::SFPLOADI_MOD0_UPPER, scale >> 16);
+            TT_SFPLOADI(p_sfpu::LREG1, sfpi::SFPLOADI_MOD0_LOWER, scale & 0xFFFF);
+            TTI_SFPMUL(p_sfpu::LREG0, p_sfpu::LREG1, p_sfpu::LCONST_0, p_sfpu::LREG0, 0);
+            TTI_NOP;
+        }
+        TT_SFPSTORE(p_sfpu::LREG0, InstrModLoadStore::DEFAULT, ADDR_MOD_3, sum_addr);
+    }
+}
+
 /**
  * @brief Unified initialization wrapper for SFPU reduce kernel.
  *        Automatically chooses between integer and floating-point initialization based on the data format.
@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: © 2025 Tenstorrent AI ULC
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+
+#include "ckernel_sfpu_polyval.h"
+#include "sfpi.h"
+
+namespace ckernel::sfpu
+{
+
+// Which elements of a head are rotated together
+enum class RopeLayout : std::uint8_t
+{
+    INTERLEAVED, // (x[2i], x[2i + 1]), GPT-J and Meta LLaMA
+    HALF_SPLIT,  // (x[i], x[i + head_dim / 2]), rotate_half of GPT-NeoX and HF LLaMA
+};
+
+// Where the rotation angle of each pair comes from
+enum class RopeAngles : std::uint8_t
+{
+    PRECOMPUTED,    // a tile of angles
+    FROM_POSITIONS, // position * inv_freq, from a tile of positions and a tile of inverse frequencies
+};
+
+// Minimax sin(r) / r and cos(r) in r^2 on [-pi/4, pi/4], fitted with helpers.minimax --error absolute:
+// the BF16 tables give correctly rounded bf16 (--max-ulp 0.51), the FP32 tables are within 1.6 fp32 ulp
+constexpr float ROPE_SIN_COEFFS_BF16[3] = {0.9999925494194031f, -0.16658174991607666f, 0.00809148047119379f};
+constexpr float ROPE_COS_COEFFS_BF16[3] = {0.9999900460243225f, -0.4997081458568573f, 0.04039853438735008f};
+constexpr float ROPE_SIN_COEFFS_FP32[4] = {1.0f, -0.16666637361049652f, 0.008331584744155407f, -0.0001946211705217138f};
+constexpr float ROPE_COS_COEFFS_FP32[4] = {1.0f, -0.4999985694885254f, 0.041655026376247406f, -0.0013585909036919475f};
+
+// Cody-Waite split of pi / 2, the high part has 8 significant bits so k * ROPE_PIO2_HI is exact for |k| < 2^16
+constexpr float ROPE_PIO2_HI  = 1.5703125f;
+constexpr float ROPE_PIO2_MID = 4.837512969970703125e-4f;
+constexpr float ROPE_PIO2_LO  = 7.54978995e-8f;
+
+// Adding 1.5 * 2^23 rounds to the nearest integer, which then sits in the low mantissa bits
+constexpr float ROPE_ROUND_MAGIC = 12582912.0f;
+
+/**
+ * @brief sin(theta) and cos(theta) from a single range reduction
+ *
+ * theta = k * pi / 2 + r with k = round(theta * 2 / pi) and |r| <= pi / 4, r is computed with a three
+ * constant Cody-Waite reduction where every step is one MAD. Both polynomials run on r and the two low
+ * bits of k swap and negate them into the right quadrant. Accurate for |theta| < 2^16 * pi / 2 (about
+ * 1.03e5), where k * ROPE_PIO2_HI is exact. As inv_freq <= 1 this covers position * inv_freq for positions
+ * up to 1e5, larger angles lose the low bits of r.
+ *
+ * Needs _init_rope_.
+ */
+template <bool APPROXIMATION_MODE>
+sfpi_inline void _sfpu_sincos_(sfpi::vFloat theta, sfpi::vFloat &sine, sfpi::vFloat &cosine)
+{
+    sfpi::vFloat shifted = theta * sfpi::vConstFloatPrgm0 + sfpi::vConstFloatPrgm1;
+    sfpi::vInt quadrant  = sfpi::reinterpret<sfpi::vInt>(shifted) & 0x3;
+    sfpi::vFloat k       = shifted - sfpi::vConstFloatPrgm1;
+
+    sfpi::vFloat r  = k * -ROPE_PIO2_HI + theta;
+    r               = k * -ROPE_PIO2_MID + r;
+    r               = k * -ROPE_PIO2_LO + r;
+    sfpi::vFloat r2 = r * r;
+
+    if constexpr (APPROXIMATION_MODE)
+    {
+        sine   = r * PolynomialEvaluator<3, sfpi::vFloat, float>::eval(ROPE_SIN_COEFFS_BF16, r2);
+        cosine = PolynomialEvaluator<3, sfpi::vFloat, float>::eval(ROPE_COS_COEFFS_BF16, r2);
+    }
+    else
+    {
+        sine   = r * PolynomialEvaluator<4, sfpi::vFloat, float>::eval(ROPE_SIN_COEFFS_FP32, r2);
+        cosine = PolynomialEvaluator<4, sfpi::vFloat, float>::eval(ROPE_COS_COEFFS_FP32, r2);
+    }
+
+    // (sin, cos)(r + pi / 2) = (cos r, -sin r), (sin, cos)(r + pi) = (-sin r, -cos r)
+    v_if ((quadrant & 0x1) != 0)
+    {
+        sfpi::vFloat tmp = sine;
+        sine             = cosine;
+        cosine           = -tmp;
+    }
+    v_endif;
+    v_if (quadrant >= 2)
+    {
+        sine   = -sine;
+        cosine = -cosine;
+    }
+    v_endif;
+}
+
+template <RopeAngles ANGLES>
+sfpi_inline sfpi::vFloat _rope_angle_(const uint angle, const uint inv_freq)
+{
+    if constexpr (ANGLES == RopeAngles::FROM_POSITIONS)
+    {
+        return sfpi::dst_reg[angle] * sfpi::dst_reg[inv_freq];
+    }
+    else
+    {
+        return sfpi::dst_reg[angle];
+    }
+}
+
+// Rotates the pair (dst_reg[lo], dst_reg[hi]) in place
+sfpi_inline void _rope_rotate_(const uint lo, const uint hi, sfpi::vFloat sine, sfpi::vFloat cosine)
+{
+    sfpi::vFloat x_lo = sfpi::dst_reg[lo];
+    sfpi::vFloat x_hi = sfpi::dst_reg[hi];
+    sfpi::dst_reg[lo] = x_lo * cosine - x_hi * sine;
+    sfpi::dst_reg[hi] = x_lo * sine + x_hi * cosine;
+}
+
+/**
+ * @brief Applies rotary positional embedding to the Q or K tile at dst_index_x in place
+ *
+ * Every pair (x_lo, x_hi) becomes (x_lo * cos - x_hi * sin, x_lo * sin + x_hi * cos), which replaces the
+ * separate sin, cos, multiply, rotate_half and add passes over Dest with one.
+ *
+ * INTERLEAVED: SFPLOAD of a row group gives the even columns at dst_reg offset 0 and the odd columns at
+ * offset 1, so each pair (x[2i], x[2i + 1]) shares a lane. dst_index_x_hi is ignored.
+ * HALF_SPLIT: column c is rotated with column c + head_dim / 2. For head_dim 32 both halves are in
+ * dst_index_x, faces 0 and 2 pair with faces 1 and 3, and dst_index_x_hi must equal dst_index_x. For
+ * wider heads dst_index_x_hi is the tile holding the columns head_dim / 2 to the right of dst_index_x.
+ *
+ * Angles are read at the position of x_lo: the even columns for INTERLEAVED, the first half for HALF_SPLIT.
+ * dst_index_inv_freq is only read with RopeAngles::FROM_POSITIONS, dst_index_angle then holds positions.
+ * Dest must point at tile 0, e.g. through _llk_math_eltwise_binary_sfpu_start_(0).
+ */
+template <bool APPROXIMATION_MODE, RopeLayout LAYOUT, RopeAngles ANGLES = RopeAngles::PRECOMPUTED>
+inline void _calculate_rope_(const uint dst_index_x, const uint dst_index_x_hi, const uint dst_index_angle, const uint dst_index_inv_freq = 0)
+{
+    constexpr uint dst_tile_size_sfpi = 32;
+    constexpr uint face_size_sfpi     = 8;
+    const uint x                      = dst_index_x * dst_tile_size_sfpi;
+    const uint angle                  = dst_index_angle * dst_tile_size_sfpi;
+    const uint inv_freq               = dst_index_inv_freq * dst_tile_size_sfpi;
+
+    if constexpr (LAYOUT == RopeLayout::INTERLEAVED)
+    {
+        for (int d = 0; d < 16; d++)
+        {
+            sfpi::vFloat sine, cosine;
+            _sfpu_sincos_<APPROXIMATION_MODE>(_rope_angle_<ANGLES>(angle, inv_freq), sine, cosine);
+            _rope_rotate_(x, x + 1, sine, cosine);
+            sfpi::dst_reg++;
+            sfpi::dst_reg++;
+        }
+    }
+    else if (dst_index_x_hi != dst_index_x)
+    {
+        const uint x_hi = dst_index_x_hi * dst_tile_size_sfpi;
+        for (int d = 0; d < 32; d++)
+        {
+            sfpi::vFloat sine, cosine;
+            _sfpu_sincos_<APPROXIMATION_MODE>(_rope_angle_<ANGLES>(angle, inv_freq), sine, cosine);
+            _rope_rotate_(x, x_hi, sine, cosine);
+            sfpi::dst_reg++;
+        }
+    }
+    else
+    {
+        for (int face = 0; face < 2; face++)
+        {
+            for (int d = 0; d < 8; d++)
+            {
+                sfpi::vFloat sine, cosine;
+                _sfpu_sincos_<APPROXIMATION_MODE>(_rope_angle_<ANGLES>(angle, inv_freq), sine, cosine);
+                _rope_rotate_(x, x + face_size_sfpi, sine, cosine);
+                sfpi::dst_reg++;
+            }
+            // The right face was rotated together with the left one, move on to faces 2 and 3
+            TTI_INCRWC(0, 8, 0, 0);
+            TTI_INCRWC(0, 8, 0, 0);
+        }
+    }
+}
+
+inline void _init_rope_()
+{
+    sfpi::vConstFloatPrgm0 = 0.636619772f; // 2 / pi
+    sfpi::vConstFloatPrgm1 = ROPE_ROUND_MAGIC;
+}
+
+} // namespace ckernel::sfpu
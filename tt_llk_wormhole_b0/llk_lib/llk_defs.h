@@ -37,6 +37,14 @@ enum PoolType
     MAX,
 };
 
+// Order in which a reduction over several tiles adds up the sums of the individual tiles
+enum class ReduceSummation
+{
+    Naive,    // running sum in tile order, one rounding to the Dest format per tile
+    Pairwise, // binary tree over the tiles, log2 of the number of tiles roundings deep
+    Kahan,    // running sum with a compensation term for the rounding of each step
+};
+
 enum DataCopyType
 {
     A2D,
@@ -259,11 +259,11 @@ inline void _llk_math_fast_tilize_addrmod_config_(const std::uint32_t unpack_dst
     uint8_t unit_dim_2_forward_jump = bottom_face_offset - (2 * (TILE_NUM_FACES / 2) * FACE_R_DIM - 8);
 
     // jumping back to the offset for the next tile is logically -bottom_face_offset if dest RWC is at the correct offset for the bottom faces of the next tile
-    // only catch is the need to compensate for the current instruction, for unit_dim 1 that is MOVA2D while for unit_dim 2 and 3 that is MOVB2D
+    // only catch is the need to compensate for the current instruction, for unit_dim 1 that is MOVA2D while for unit_dim 2, 3 and 4 that is MOVB2D
     int16_t unit_dim_1_backward_jump = -bottom_face_offset + 8;
     int16_t unit_dim_2_backward_jump = -bottom_face_offset + 4;
 
-    // this follows MOVA2D in src and jumps to the offset for the bottom faces (for unit_dim 1 and 2, for unit_dim 3 that is handled the other way)
+    // this follows MOVA2D in src and jumps to the offset for the bottom faces (for unit_dim 1 and 2, for unit_dim 3 and 4 that is handled the other way)
     addr_mod_t {
         .srca = {.incr = 8},
         .dest = {.incr = unit_dim == 1 ? unit_dim_1_forward_jump : unit_dim_2_forward_jump},
@@ -430,6 +430,46 @@ inline void _llk_math_fast_tilize_block_(
             // clear both dvalids and src RWCs
             TTI_SETRWC(p_setrwc::CLR_AB, 0, 0, 0, 0, p_setrwc::SET_AB);
         }
+        else if (unit_dim == 4)
+        {
+            // srcA has the top 8 rows of the top faces (8 of them), copy them
+            // inside mop:
+            // for (uint j = 0; j < 8; j++)
+            // {
+            //     TTI_MOVA2D(p_mov::DEST_NORM, 0, ADDR_MOD_2, p_mova2d::MOV_8_ROWS, 0);
+            // }
+            TTI_MOP(p_mop::MASK_LOOP, 8 - 1, 0x0);
+            // srcB has the bottom 8 rows of the top faces (8 of them), copy them
+            // inside mop:
+            // for (uint j = 0; j < 16; j++)
+            // {
+            //     TTI_MOVB2D(p_mov::DEST_NORM, 0, ADDR_MOD_1, p_movb2d::MOV_4_ROWS, 0);
+            // }
+            TTI_MOP(p_mop::MASK_LOOP, 16 - 1, 0xFFFF);
+            // same as unit_dim 3, clear dvalids and all RWCs and use dest offset for the forward jump
+            TTI_SETRWC(p_setrwc::CLR_AB, 0, 0, 0, 0, p_setrwc::SET_ABD);
+            uint32_t top_face_offset    = dst_index + i * 4; // copy 4 tiles per iteration
+            uint32_t bottom_face_offset = top_face_offset + (unpack_dst_format == (uint)DataFormat::Tf32 ? 4 : 8);
+            math::set_dst_write_addr<DstTileLayout::Default, DstTileShape::Tile32x16>(bottom_face_offset);
+            // srcA has the top 8 rows of the bottom faces (8 of them), copy them
+            // inside mop:
+            // for (uint j = 0; j < 8; j++)
+            // {
+            //     TTI_MOVA2D(p_mov::DEST_NORM, 0, ADDR_MOD_2, p_mova2d::MOV_8_ROWS, 0);
+            // }
+            TTI_MOP(p_mop::MASK_LOOP, 8 - 1, 0x0);
+            // srcB has the bottom 8 rows of the bottom faces (8 of them), copy them
+            // inside mop:
+            // for (uint j = 0; j < 15; j++)
+            // {
+            //     TTI_MOVB2D(p_mov::DEST_NORM, 0, ADDR_MOD_1, p_movb2d::MOV_4_ROWS, 0);
+            // }
+            TTI_MOP(p_mop::MASK_LOOP, 15 - 1, 0xFFFF);
+            // finish with the bottom faces and jump back to the offset for the next tile
+            TTI_MOVB2D(p_mov::DEST_NORM, 0, ADDR_MOD_0, p_movb2d::MOV_4_ROWS, 0);
+            // clear both dvalids and src RWCs
+            TTI_SETRWC(p_setrwc::CLR_AB, 0, 0, 0, 0, p_setrwc::SET_AB);
+        }
     }
 
     math::clear_dst_reg_addr();
@@ -466,3 +466,114 @@ inline void _llk_math_reduce_init_([[maybe_unused]] const std::uint32_t within_f
 
     math::reset_counters(p_setrwc::SET_ABD_F);
 }
+
+template <PoolType type, bool HIGH_FIDELITY, uint clear_ab, uint dst_row_offset>
+inline void reduce_pool_face()
+{
+    if constexpr (type == PoolType::MAX)
+    {
+        TTI_GMPOOL(clear_ab, p_gpool::DIM_16X16, ADDR_MOD_0, p_gpool::INDEX_DIS, dst_row_offset);
+    }
+    else if constexpr (HIGH_FIDELITY)
+    {
+        // Fidelity phases are looped by the MOP programmed in reduce_configure_mop
+        ckernel_template::run();
+        TTI_CLEARDVALID(clear_ab, 0);
+    }
+    else
+    {
+        TTI_GAPOOL(clear_ab, p_gpool::DIM_16X16, ADDR_MOD_0, p_gpool::INDEX_DIS, dst_row_offset);
+    }
+}
+
+/**
+ * Pools all faces of one tile into the partial result held in Dest, without finalizing it.
+ *
+ * Every face releases its SrcA/SrcB banks, so the unpacker can stream the next tile of the strip
+ * straight away. The Dest layout of the partials matches the one _llk_math_reduce_ accumulates into:
+ * - REDUCE_ROW: F0/F1 are pooled into Dest row 0 and F2/F3 into the first row of F2
+ * - REDUCE_SCALAR: all faces are pooled into Dest row 4 (scratch row used by the final SrcA re-pool)
+ * REDUCE_COL has no finalization step, so it never needs this partial form.
+ */
+template <PoolType type, ReduceDim dim, int MATH_FIDELITY_DESC>
+inline void reduce_accumulate_tile(bool narrow_tile, const uint num_faces)
+{
+    constexpr bool HIGH_FIDELITY = get_math_num_fidelity_phases(MATH_FIDELITY_DESC) > 0;
+
+    if constexpr (dim == ReduceDim::REDUCE_ROW)
+    {
+        reduce_pool_face<type, HIGH_FIDELITY, p_setrwc::CLR_AB, 0>();
+        reduce_pool_face<type, HIGH_FIDELITY, p_setrwc::CLR_AB, 0>();
+
+        if (num_faces != 2 || narrow_tile)
+        {
+            // Increment dest by 32 or 16 if narrow tile, same as for the second tile row in _llk_math_reduce_
+            if (!narrow_tile)
+            {
+                TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+                TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+            }
+            TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+            TTI_SETRWC(p_setrwc::CLR_NONE, p_setrwc::CR_D, 8, 0, 0, p_setrwc::SET_D);
+
+            reduce_pool_face<type, HIGH_FIDELITY, p_setrwc::CLR_AB, 0>();
+            reduce_pool_face<type, HIGH_FIDELITY, p_setrwc::CLR_AB, 0>();
+        }
+
+        // Reset counters to 0 for next accumulation
+        TTI_SETRWC(p_setrwc::CLR_NONE, 0, 0, 0, 0, p_setrwc::SET_BD);
+    }
+    else if constexpr (dim == ReduceDim::REDUCE_SCALAR)
+    {
+        for (uint face = 0; face < num_faces; face++)
+        {
+            reduce_pool_face<type, HIGH_FIDELITY, p_setrwc::CLR_AB, 4>();
+        }
+    }
+}
+
+/**
+ * Reduces a strip of num_tiles tiles into a single output tile at dst_index.
+ *
+ * Uses the same init as _llk_math_reduce_ (_llk_math_reduce_init_), so the addrmods and the fidelity MOP
+ * are programmed once for the whole strip. Partial sums/maxima of the first num_tiles - 1 tiles stay resident
+ * in Dest; the Dest -> SrcB transpose (REDUCE_ROW) and the SrcA re-pool (REDUCE_SCALAR) run only once, on the
+ * last tile, which produces the final reduced tile directly. With enforce_fp32_accumulation the partials are
+ * kept in fp32 Dest for the whole strip and only the final transpose is split into hi/lo16 halves.
+ *
+ * The unpacker is expected to deliver the tiles of the strip back to back with the same scaler in SrcB.
+ * For PoolType::AVG the scaler has to account for the whole strip, e.g. 1 / (32 * num_tiles) for row/column
+ * reduction, and Dest at dst_index has to be cleared before the first tile, same as for _llk_math_reduce_.
+ */
+template <
+    PoolType type,
+    ReduceDim dim,
+    bool is_fp32_dest_acc_en,
+    int MATH_FIDELITY_DESC         = 0,
+    bool is_int_fpu_en             = false,
+    bool enforce_fp32_accumulation = false>
+inline void _llk_math_reduce_block_(const uint dst_index, const uint num_tiles, bool narrow_tile = false, const uint num_faces = 4)
+{
+    if constexpr (dim == ReduceDim::REDUCE_COL)
+    {
+        // Column reduction is complete after pooling, every tile accumulates into the same Dest rows
+        for (uint tile = 0; tile < num_tiles; tile++)
+        {
+            _llk_math_reduce_<type, dim, is_fp32_dest_acc_en, MATH_FIDELITY_DESC, is_int_fpu_en, enforce_fp32_accumulation>(dst_index, narrow_tile, num_faces);
+        }
+    }
+    else
+    {
+        if (num_tiles > 1)
+        {
+            math::set_dst_write_addr<DstTileLayout::Default, DstTileShape::Tile32x32>(dst_index);
+            for (uint tile = 0; tile < num_tiles - 1; tile++)
+            {
+                reduce_accumulate_tile<type, dim, MATH_FIDELITY_DESC>(narrow_tile, num_faces);
+            }
+        }
+
+        // Last tile is pooled on top of the partials and finalized
+        _llk_math_reduce_<type, dim, is_fp32_dest_acc_en, MATH_FIDELITY_DESC, is_int_fpu_en, enforce_fp32_accumulation>(dst_index, narrow_tile, num_faces);
+    }
+}
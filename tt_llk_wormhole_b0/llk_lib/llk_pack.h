@@ -271,6 +271,7 @@ inline void _llk_pack_(const std::uint32_t tile_index, const std::uint32_t addre
  * LLK PACK FAST TILIZE (Tilize single input using both unpackers and packer)
  * unit_dim is the number of tiles processed in a single iteration, num_units is the number of units processed in a single call
  * unit_dim and num_units must match the ones given to the unpacker and math (all unit_dim usage notes from the unpacker also apply here)
+ * unit_dim given to init selects the row stride, unit_dim 3 can be mixed with 2 or 4 but changing between 2 and 4 requires reconfiguration
  * tile_index is the index of the tile inside the destination register to read from
  * address is the 16B address of where to start packing to (usually the start of the tile row)
  * currently supports only 4 16x16 faces per tile
@@ -289,9 +290,10 @@ inline void _llk_pack_fast_tilize_hw_configure_(const std::uint32_t pack_src_for
 inline void _llk_pack_fast_tilize_addrmod_config_(const std::uint32_t unit_dim)
 {
     // first two address mods move to the next row, the stride depends on the number of contiguous faces loaded in the single unpacker instruction
-    // for unit_dim 1, that is 2 so the stride is 2, and analogously for unit_dims 2 and 3 its 4 and 6
+    // for unit_dim 1, that is 2 so the stride is 2, and analogously for unit_dims 2, 3 and 4 its 4, 6 and 8
+    // there are not enough address mods for all of them so unit_dim 1, 2 and 4 share the first one (hence they can't be mixed)
     addr_mod_pack_t {
-        .y_src = {.incr = (uint8_t)(unit_dim == 1 ? 2 : 4)},
+        .y_src = {.incr = (uint8_t)(unit_dim == 1 ? 2 : (unit_dim == 4 ? 8 : 4))},
     }
         .set(ADDR_MOD_0);
 
@@ -540,5 +542,42 @@ inline void _llk_pack_fast_tilize_block_(
             // address mod here resets to the beginning of the unit
             TTI_PACR_COMMON(ADDR_MOD_3, p_pacr::P_ZERO_OUTPUT_DISABLED, PACK_SEL(NUM_PACKERS), 1, 0);
         }
+        else if (unit_dim == 4)
+        {
+            for (uint j = 0; j < 3; j++)
+            {
+                // pack a single tile
+                // inside mop:
+                // for (uint k = 0; k < 15; k++)
+                // {
+                //     TTI_PACR_COMMON(ADDR_MOD_0, p_pacr::P_ZERO_OUTPUT_DISABLED, PACK_SEL(NUM_PACKERS), 0, 0);
+                // }
+                TTI_MOP(p_mop::MASK_LOOP, (FACE_R_DIM - 1) - 1, 0x0);
+                TTI_PACR_COMMON(ADDR_MOD_0, p_pacr::P_ZERO_OUTPUT_DISABLED, PACK_SEL(NUM_PACKERS), 0, 1);
+                // move to the next tile in L1
+                TTI_ADDDMAREG(p_adddmareg::REG_PLUS_REG, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR_OFFSET);
+                TTI_REG2FLOP_COMMON(p_reg2flop::WRITE_4B, REG2FLOP_FLOP_INDEX(THCON_SEC0_REG1_L1_Dest_addr_ADDR32), p_gpr_pack::OUTPUT_ADDR);
+                // same notes for the flush bit as above
+                // address mod here moves to the next tile in the same unit
+                TTI_PACR_COMMON(ADDR_MOD_1, p_pacr::P_ZERO_OUTPUT_DISABLED, PACK_SEL(NUM_PACKERS), 1, 0);
+            }
+            // pack the last tile of the unit
+            // inside mop:
+            // for (uint k = 0; k < 15; k++)
+            // {
+            //     TTI_PACR_COMMON(ADDR_MOD_0, p_pacr::P_ZERO_OUTPUT_DISABLED, PACK_SEL(NUM_PACKERS), 0, 0);
+            // }
+            TTI_MOP(p_mop::MASK_LOOP, (FACE_R_DIM - 1) - 1, 0x0);
+            TTI_PACR_COMMON(ADDR_MOD_0, p_pacr::P_ZERO_OUTPUT_DISABLED, PACK_SEL(NUM_PACKERS), 0, 1);
+            // move to the next unit in dest (4 * 2 faces, same thing as tile_index), the Z increment field tops out at 7
+            TTI_INCADCZW(p_setadc::PAC, 0, 0, 0, 4); // CH0Z += 4
+            TTI_INCADCZW(p_setadc::PAC, 0, 0, 0, 4); // CH0Z += 4
+            // move to the next tile in L1
+            TTI_ADDDMAREG(p_adddmareg::REG_PLUS_REG, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR_OFFSET);
+            TTI_REG2FLOP_COMMON(p_reg2flop::WRITE_4B, REG2FLOP_FLOP_INDEX(THCON_SEC0_REG1_L1_Dest_addr_ADDR32), p_gpr_pack::OUTPUT_ADDR);
+            // same notes for the flush bit as above
+            // address mod here resets to the beginning of the unit
+            TTI_PACR_COMMON(ADDR_MOD_3, p_pacr::P_ZERO_OUTPUT_DISABLED, PACK_SEL(NUM_PACKERS), 1, 0);
+        }
     }
 }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 
 #include "ckernel.h"
@@ -52,6 +53,66 @@ inline void _llk_pack_untilize_configure_addrmod_()
         .set(ADDR_MOD_3);
 }
 
+/*
+Runtime-dimension MOP configuration for the non-diagonal untilize paths.
+block_ct_dim is the number of tiles packed per call, full_ct_dim the width of the whole output row in tiles.
+The templated _llk_pack_untilize_mop_config_ forwards here, so widths no longer need their own instantiation.
+*/
+inline void _llk_pack_untilize_stream_mop_config_(
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t full_ct_dim,
+    const bool narrow_row          = false,
+    const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces  = 4)
+{
+    const uint PACKCNT              = (face_r_dim < FACE_R_DIM) ? 1 : num_faces;
+    constexpr uint MEGAROW          = 1;
+    constexpr uint ZERO_OUTPUT_FLAG = p_pacr::P_ZERO_OUTPUT_DISABLED;
+    const uint MOP_INNER_LOOP       = narrow_row ? (TILE_R_DIM / 4) : 1;
+    const uint MOP_OUTER_LOOP       = narrow_row ? 1 : block_ct_dim;
+
+    if (narrow_row)
+    { // always
+        ckernel::ckernel_template tmp(MOP_OUTER_LOOP, MOP_INNER_LOOP, TT_OP_PACR(ADDR_MOD_0, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, 0, 0, 0));
+        tmp.program();
+        return;
+    }
+
+    if (num_faces > 1)
+    {
+        // Inc ch0_y+=1 (addr_mod_0 will increment by 15)
+        ckernel::ckernel_template tmp(MOP_OUTER_LOOP, MOP_INNER_LOOP, TT_OP_INCADCXY(p_setadc::PAC, 0, 0, 1, 0));
+        tmp.set_start_op(TT_OP_PACR(ADDR_MOD_0, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, MEGAROW, 0, 0));
+        tmp.set_end_ops(
+            TT_OP_PACR(ADDR_MOD_1, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, MEGAROW, 0, 0),
+            TT_OP_INCADCZW(p_setadc::PAC, 0, 0, 1, 0)); // w cnt points to the next tile
+        tmp.program();
+    }
+    else
+    {
+        ckernel::ckernel_template tmp(MOP_OUTER_LOOP, MOP_INNER_LOOP, TT_OP_PACR(ADDR_MOD_1, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, MEGAROW, 0, 0));
+        tmp.set_end_op(TT_OP_INCADCZW(p_setadc::PAC, 0, 0, 1, 0)); // w cnt points to the next tile
+        tmp.program();
+    }
+
+    if (block_ct_dim != full_ct_dim)
+    {
+        const std::uint32_t replay_buf_len = 10;
+        lltt::record(ckernel::packer::replay_buf_offset, replay_buf_len);
+        TTI_PACR(ADDR_MOD_3, 0, 0xf, 0, 0, 1, 1); // close block
+        // update l1 address
+        TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR_OFFSET);
+        TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 1, p_gpr_pack::OUTPUT_ADDR + 1, p_gpr_pack::OUTPUT_ADDR_OFFSET);
+        TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 2, p_gpr_pack::OUTPUT_ADDR + 2, p_gpr_pack::OUTPUT_ADDR_OFFSET);
+        TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 3, p_gpr_pack::OUTPUT_ADDR + 3, p_gpr_pack::OUTPUT_ADDR_OFFSET);
+        TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR);
+        TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 1);
+        TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 2);
+        TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 3);
+        TTI_NOP;
+    }
+}
+
 template <
     std::uint32_t block_ct_dim,
     std::uint32_t full_ct_dim    = block_ct_dim,
@@ -60,14 +121,14 @@ template <
     std::uint32_t row_num_datums = TILE_C_DIM>
 inline void _llk_pack_untilize_mop_config_(const std::uint32_t face_r_dim = FACE_R_DIM, const std::uint32_t num_faces = 4)
 {
-    const uint PACKCNT              = diagonal ? (num_faces > 2 ? num_faces / 2 : num_faces) : ((face_r_dim < FACE_R_DIM) ? 1 : num_faces);
-    constexpr uint MEGAROW          = 1;
-    constexpr uint ZERO_OUTPUT_FLAG = p_pacr::P_ZERO_OUTPUT_DISABLED;
-    constexpr uint MOP_INNER_LOOP   = narrow_row ? (TILE_R_DIM / 4) : (diagonal ? FACE_R_DIM - 1 : 1);
-    constexpr uint MOP_OUTER_LOOP   = narrow_row ? 1 : block_ct_dim;
-
     if constexpr (diagonal)
     {
+        const uint PACKCNT              = num_faces > 2 ? num_faces / 2 : num_faces;
+        constexpr uint MEGAROW          = 1;
+        constexpr uint ZERO_OUTPUT_FLAG = p_pacr::P_ZERO_OUTPUT_DISABLED;
+        constexpr uint MOP_INNER_LOOP   = narrow_row ? (TILE_R_DIM / 4) : FACE_R_DIM - 1;
+        constexpr uint MOP_OUTER_LOOP   = narrow_row ? 1 : block_ct_dim;
+
         ckernel::ckernel_template tmp(
             MOP_OUTER_LOOP,
             MOP_INNER_LOOP,
@@ -80,47 +141,7 @@ inline void _llk_pack_untilize_mop_config_(const std::uint32_t face_r_dim = FACE
     }
     else
     {
-        if constexpr (narrow_row)
-        { // always
-            ckernel::ckernel_template tmp(MOP_OUTER_LOOP, MOP_INNER_LOOP, TT_OP_PACR(ADDR_MOD_0, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, 0, 0, 0));
-            tmp.program();
-        }
-        else
-        {
-            if (num_faces > 1)
-            {
-                // Inc ch0_y+=1 (addr_mod_0 will increment by 15)
-                ckernel::ckernel_template tmp(MOP_OUTER_LOOP, MOP_INNER_LOOP, TT_OP_INCADCXY(p_setadc::PAC, 0, 0, 1, 0));
-                tmp.set_start_op(TT_OP_PACR(ADDR_MOD_0, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, MEGAROW, 0, 0));
-                tmp.set_end_ops(
-                    TT_OP_PACR(ADDR_MOD_1, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, MEGAROW, 0, 0),
-                    TT_OP_INCADCZW(p_setadc::PAC, 0, 0, 1, 0)); // w cnt points to the next tile
-                tmp.program();
-            }
-            else
-            {
-                ckernel::ckernel_template tmp(MOP_OUTER_LOOP, MOP_INNER_LOOP, TT_OP_PACR(ADDR_MOD_1, ZERO_OUTPUT_FLAG, PACK_SEL(PACKCNT), 0, MEGAROW, 0, 0));
-                tmp.set_end_op(TT_OP_INCADCZW(p_setadc::PAC, 0, 0, 1, 0)); // w cnt points to the next tile
-                tmp.program();
-            }
-        }
-
-        if (block_ct_dim != full_ct_dim)
-        {
-            const std::uint32_t replay_buf_len = 10;
-            lltt::record(ckernel::packer::replay_buf_offset, replay_buf_len);
-            TTI_PACR(ADDR_MOD_3, 0, 0xf, 0, 0, 1, 1); // close block
-            // update l1 address
-            TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR, p_gpr_pack::OUTPUT_ADDR_OFFSET);
-            TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 1, p_gpr_pack::OUTPUT_ADDR + 1, p_gpr_pack::OUTPUT_ADDR_OFFSET);
-            TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 2, p_gpr_pack::OUTPUT_ADDR + 2, p_gpr_pack::OUTPUT_ADDR_OFFSET);
-            TTI_ADDDMAREG(0, p_gpr_pack::OUTPUT_ADDR + 3, p_gpr_pack::OUTPUT_ADDR + 3, p_gpr_pack::OUTPUT_ADDR_OFFSET);
-            TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR);
-            TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC0_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 1);
-            TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG1_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 2);
-            TTI_REG2FLOP(1, 0, 0, 0, THCON_SEC1_REG8_L1_Dest_addr_ADDR32 - THCON_CFGREG_BASE_ADDR32, p_gpr_pack::OUTPUT_ADDR + 3);
-            TTI_NOP;
-        }
+        _llk_pack_untilize_stream_mop_config_(block_ct_dim, full_ct_dim, narrow_row, face_r_dim, num_faces);
     }
 }
 
@@ -204,3 +225,99 @@ inline void _llk_pack_untilize_(
         TTI_PACR(ADDR_MOD_2, 0, 0xf, 0, 0, 1, 1); // close block
     }
 }
+
+/*
+Streaming untilize: block and row widths are runtime values, so any output width is served by one kernel.
+The output row of full_ct_dim tiles is produced block by block, each block is one Dest section of block_ct_dim tiles.
+block_ct_dim has to fit into the active Dest half; full_ct_dim does not need to be a multiple of block_ct_dim,
+the last (narrower) block is handled by reprogramming the MOP outer loop.
+*/
+inline void _llk_pack_untilize_stream_init_(
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t full_ct_dim,
+    const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces  = 4)
+{
+    _llk_pack_untilize_configure_addrmod_<false, false>();
+
+    _llk_pack_untilize_stream_mop_config_(block_ct_dim, full_ct_dim, false, face_r_dim, num_faces);
+
+    if (block_ct_dim != full_ct_dim)
+    {
+        const std::uint32_t output_addr_offset = SCALE_DATUM_SIZE(pack_dst_format, full_ct_dim * ((num_faces > 1) ? num_faces / 2 : 1) * FACE_C_DIM);
+        TT_SETDMAREG(0, LOWER_HALFWORD(output_addr_offset / 16), 0, LO_16(p_gpr_pack::OUTPUT_ADDR_OFFSET)); // store 16B aligned row offset address
+    }
+
+    // Pack row by row
+    TT_SETADCXX(p_setadc::PAC, FACE_C_DIM - 1, 0x0);
+}
+
+// Packs one block of block_ct_dim tiles from Dest into its column slice of the row-major output at address
+inline void _llk_pack_untilize_stream_block_(
+    const std::uint32_t address,
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t full_ct_dim,
+    const std::uint32_t face_r_dim      = FACE_R_DIM,
+    const std::uint32_t tile_dst_offset = 0)
+{
+    program_packer_untilized_destination(address, pack_dst_format, full_ct_dim);
+
+    const std::uint32_t num_rows = (face_r_dim < FACE_R_DIM) ? face_r_dim : TILE_R_DIM / 4;
+
+    for (std::uint32_t row = 0; row < num_rows; row++)
+    {
+        TT_SETADC(p_setadc::PAC, p_setadc::CH_0, p_setadc::SET_W, tile_dst_offset); // Clear tile counter
+        ckernel::ckernel_template::run();
+        TTI_ADDRCRXY(p_setadc::PAC, 0, 0, 1, 0, 0b0010); // Read new row in the tile
+        if (block_ct_dim != full_ct_dim)
+        {
+            lltt::replay(ckernel::packer::replay_buf_offset, 10); // update row address
+        }
+    }
+
+    if (block_ct_dim == full_ct_dim)
+    {
+        TTI_PACR(ADDR_MOD_2, 0, 0xf, 0, 0, 1, 1); // close block
+    }
+}
+
+/*
+Untilizes a full_ct_dim wide row of tiles into row-major L1 at address.
+Each block waits for its own Dest section, so with DstSync::SyncHalf math fills the other Dest half
+while the current one is packed. Column offsets of the blocks are computed here instead of on the host.
+*/
+template <DstSync Dst, bool is_fp32_dest_acc_en>
+inline void _llk_pack_untilize_stream_(
+    const std::uint32_t address,
+    const std::uint32_t pack_dst_format,
+    const std::uint32_t block_ct_dim,
+    const std::uint32_t full_ct_dim,
+    const std::uint32_t face_r_dim = FACE_R_DIM,
+    const std::uint32_t num_faces  = 4)
+{
+    const std::uint32_t tile_row_datums = ((num_faces > 1) ? num_faces / 2 : 1) * FACE_C_DIM;
+    std::uint32_t block_address         = address;
+
+    for (std::uint32_t block_start = 0; block_start < full_ct_dim; block_start += block_ct_dim)
+    {
+        const std::uint32_t tiles_in_block = std::min(block_ct_dim, full_ct_dim - block_start);
+        if (tiles_in_block != block_ct_dim)
+        {
+            _llk_pack_untilize_stream_mop_config_(tiles_in_block, full_ct_dim, false, face_r_dim, num_faces);
+        }
+
+        _llk_packer_wait_for_math_done_();
+        _llk_pack_untilize_stream_block_(block_address, pack_dst_format, tiles_in_block, full_ct_dim, face_r_dim);
+        _llk_pack_dest_section_done_<Dst, is_fp32_dest_acc_en>();
+
+        block_address += SCALE_DATUM_SIZE(pack_dst_format, tiles_in_block * tile_row_datums) / 16;
+    }
+
+    if (full_ct_dim % block_ct_dim != 0)
+    {
+        // Restore the MOP for the next row
+        _llk_pack_untilize_stream_mop_config_(block_ct_dim, full_ct_dim, false, face_r_dim, num_faces);
+    }
+}
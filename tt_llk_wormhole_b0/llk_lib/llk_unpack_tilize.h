@@ -12,6 +12,7 @@
 #include "ckernel_ops.h"
 #include "ckernel_template.h"
 #include "cunpack_common.h"
+#include "lltt.h"
 
 using namespace ckernel;
 using namespace ckernel::unpacker;
@@ -472,9 +473,9 @@ inline void _llk_unpack_tilizeA_B_uninit_(const std::uint32_t unpack_dst_format,
  * LLK UNPACK FAST TILIZE (Tilize single input using both unpackers and packer)
  * full_dim is the tensor width in number of tiles
  * unit_dim is the number of tiles processed in a single iteration, num_units is the number of units processed in a single call
- * unit_dim is 1 (only if full_dim is 1) or 2 and 3 (for any other full_dim)
- * each call can process unit_dim * num_units tiles but when unit_dim is 2 or 3 all tiles must be in a single row
- * changing between unit_dim 1 and 2/3 requires reconfiguration while changing between 2 and 3 does not
+ * unit_dim is 1 (only if full_dim is 1) or 2, 3 and 4 (for any other full_dim)
+ * each call can process unit_dim * num_units tiles but when unit_dim is 2, 3 or 4 all tiles must be in a single row
+ * changing between unit_dim 1 and 2/3/4 requires reconfiguration while changing between 2, 3 and 4 does not
  * base_address is the 16B base address of the start of the tile row
  * tile_index is the index of the tile inside that row
  * currently supports only 4 16x16 faces per tile
@@ -517,13 +518,15 @@ inline void _llk_unpack_fast_tilize_init_(const std::uint32_t unpack_dst_format,
 
     // save the following state that is going to be modified:
     // tile x, y, and z dims for both unpackers
-    // CH1 Z stride for both unpackers
+    // CH1 Y and Z strides for both unpackers
     TTI_RDCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_0, UNP0_ADDR_CTRL_ZW_REG_1_Zstride_ADDR32);
     TTI_RDCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_1, THCON_SEC0_REG5_Tile_x_dim_cntx0_ADDR32);
     TTI_RDCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_2, THCON_SEC0_REG0_TileDescriptor_ADDR32 + 1);
     TTI_RDCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_3, UNP1_ADDR_CTRL_ZW_REG_1_Zstride_ADDR32);
     TTI_RDCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_0, THCON_SEC1_REG0_TileDescriptor_ADDR32);
     TTI_RDCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_1, THCON_SEC1_REG0_TileDescriptor_ADDR32 + 1);
+    TTI_RDCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_2, UNP0_ADDR_CTRL_XY_REG_1_Ystride_ADDR32);
+    TTI_RDCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_3, UNP1_ADDR_CTRL_XY_REG_1_Ystride_ADDR32);
 
     // set x dim to single tile width, moving across y counter moves to the next tile in row major
     // set y dim to full dim, moving across z counter moves to the next row in row major
@@ -550,7 +553,22 @@ inline void _llk_unpack_fast_tilize_init_(const std::uint32_t unpack_dst_format,
     cfg_reg_rmw_tensix<UNP0_ADDR_CTRL_ZW_REG_1_Zstride_RMW>(TILE_C_DIM * ch1_x_stride);
     cfg_reg_rmw_tensix<UNP1_ADDR_CTRL_ZW_REG_1_Zstride_RMW>(TILE_C_DIM * ch1_x_stride);
 
+    // unit_dim 4 reads 128 datums per row which is more than CH1 Z increment can express (at most 3 * 32 datums)
+    // so it moves with CH1 Y instead, whose stride is set to the whole unit row
+    // CH1 Y is not used by any other unit_dim, the previous stride is restored by uninit
+    cfg_reg_rmw_tensix<UNP0_ADDR_CTRL_XY_REG_1_Ystride_RMW>(4 * TILE_C_DIM * ch1_x_stride);
+    cfg_reg_rmw_tensix<UNP1_ADDR_CTRL_XY_REG_1_Ystride_RMW>(4 * TILE_C_DIM * ch1_x_stride);
+
     _llk_unpack_fast_tilize_mop_config_();
+
+    // mop slots are taken by unit_dim 2 and 3 so the unit_dim 4 row loop lives in the replay buffer
+    constexpr uint8_t ADDRMOD_CH1Y_1_CH1Z_0_CH0Y_0_CH0Z_1 = 0b01'00'00'01;
+    lltt::record<lltt::NoExec>(0, 2 * ((FACE_R_DIM / 2) - 1));
+    for (std::uint32_t j = 0; j < (FACE_R_DIM / 2) - 1; j++)
+    {
+        TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_1_CH1Z_0_CH0Y_0_CH0Z_1, 0);
+        TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_1_CH1Z_0_CH0Y_0_CH0Z_1, 0);
+    }
 }
 
 template <bool is_fp32_dest_acc_en>
@@ -563,6 +581,8 @@ inline void _llk_unpack_fast_tilize_uninit_()
     TTI_WRCFG(p_gpr_unpack::SR_UNPACK_UNTILIZER_STATE_3, p_cfg::WRCFG_32b, UNP1_ADDR_CTRL_ZW_REG_1_Zstride_ADDR32);
     TTI_WRCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_0, p_cfg::WRCFG_32b, THCON_SEC1_REG0_TileDescriptor_ADDR32);
     TTI_WRCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_1, p_cfg::WRCFG_32b, THCON_SEC1_REG0_TileDescriptor_ADDR32 + 1);
+    TTI_WRCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_2, p_cfg::WRCFG_32b, UNP0_ADDR_CTRL_XY_REG_1_Ystride_ADDR32);
+    TTI_WRCFG(p_gpr_unpack::SR_UNPACK_TILIZER_STATE_3, p_cfg::WRCFG_32b, UNP1_ADDR_CTRL_XY_REG_1_Ystride_ADDR32);
 
     // reset all counters
     TTI_SETADCXY(p_setadc::UNP_AB, 0, 0, 0, 0, SETADC_CH01(p_setadc::XY));
@@ -581,7 +601,7 @@ inline void _llk_unpack_fast_tilize_block_(
 
     uint32_t address = base_address + (SCALE_DATUM_SIZE(unpack_src_format, tile_index * TILE_C_DIM) >> 4); // move by tile width in 16B words
     // for unit_dim 2 UNPA reads top faces and UNPB reads bottom faces
-    // for unit_dim 3 UNPA reads top 8 rows of top then bottom faces, UNPB reads bottom 8 rows of top then bottom faces
+    // for unit_dim 3 and 4 UNPA reads top 8 rows of top then bottom faces, UNPB reads bottom 8 rows of top then bottom faces
     uint32_t unpB_row_offset = unit_dim == 2 ? FACE_R_DIM : (FACE_R_DIM / 2);
     uint32_t unpB_address    = address + (SCALE_DATUM_SIZE(unpack_src_format, full_dim * TILE_C_DIM * unpB_row_offset) >> 4);
 
@@ -589,7 +609,7 @@ inline void _llk_unpack_fast_tilize_block_(
     TTI_SETADCXY(p_setadc::UNP_AB, 0, 0, 0, 0, SETADC_CH01(p_setadc::XY));
     TTI_SETADCZW(p_setadc::UNP_AB, 0, 0, 0, 0, SETADC_CH01(p_setadc::ZW));
 
-    // unit_dim 1 reads the whole tile while unit_dim 2 and 3 read one row from 2 or 3 tiles
+    // unit_dim 1 reads the whole tile while unit_dim 2, 3 and 4 read one row from 2, 3 or 4 tiles
     if (unit_dim == 1)
     {
         TTI_SETADCXX(p_setadc::UNP_AB, TILE_R_DIM * TILE_C_DIM - 1, 0x0);
@@ -602,6 +622,10 @@ inline void _llk_unpack_fast_tilize_block_(
     {
         TTI_SETADCXX(p_setadc::UNP_AB, 3 * TILE_C_DIM - 1, 0x0);
     }
+    else if (unit_dim == 4)
+    {
+        TTI_SETADCXX(p_setadc::UNP_AB, 4 * TILE_C_DIM - 1, 0x0);
+    }
     else
     {
         // replace this with a proper assert once it's available
@@ -683,6 +707,32 @@ inline void _llk_unpack_fast_tilize_block_(
             TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_3_CH0Z_0, 1);
             TTI_SETADCZW(p_setadc::UNP_AB, 0, 0, 0, 0, SETADC_CH01(p_setadc::ZW));
         }
+        else if (unit_dim == 4)
+        {
+            // read top 8(A)/bottom 8(B) rows of top faces of four tiles in a row (8 halves of a face each), switch bank,
+            // then move to the bottom faces (CH0W = 1) and back to the top of a face (CH1Y = 0, CH01Z = 0)
+            // inside replay:
+            // for (std::uint32_t j = 0; j < (FACE_R_DIM / 2) - 1; j++)
+            // {
+            //     TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_1_CH1Z_0_CH0Y_0_CH0Z_1, 0);
+            //     TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_1_CH1Z_0_CH0Y_0_CH0Z_1, 0);
+            // }
+            lltt::replay(0, 2 * ((FACE_R_DIM / 2) - 1));
+            TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_0_CH0Z_0, 1);
+            TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_0_CH0Z_0, 1);
+            TTI_SETADCXY(p_setadc::UNP_AB, 0, 0, 0, 0, SETADC_CH1(p_setadc::Y));
+            TTI_SETADCZW(p_setadc::UNP_AB, 0, 0, 1, 0, SETADC_CH01(p_setadc::ZW));
+
+            // read top 8(A)/bottom 8(B) rows of bottom faces of four tiles in a row (8 halves of a face each), switch bank,
+            // then move to the top faces of the next four tiles (CH0Y += 4) and back to top of a tile (CH1Y = 0, CH01Z = 0, CH0W = 0)
+            // CH0Y increment in the address mod tops out at 3 so it is done separately
+            lltt::replay(0, 2 * ((FACE_R_DIM / 2) - 1));
+            TTI_UNPACR_COMMON(SrcA, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_0_CH0Z_0, 1);
+            TTI_UNPACR_COMMON(SrcB, ADDRMOD_CH1Y_0_CH1Z_0_CH0Y_0_CH0Z_0, 1);
+            TTI_SETADCXY(p_setadc::UNP_AB, 0, 0, 0, 0, SETADC_CH1(p_setadc::Y));
+            TTI_INCADCXY(p_setadc::UNP_AB, 0, 0, 4, 0);
+            TTI_SETADCZW(p_setadc::UNP_AB, 0, 0, 0, 0, SETADC_CH01(p_setadc::ZW));
+        }
     }
 
     t6_semaphore_get(semaphore::UNPACK_SYNC);